@@ -1,6 +1,8 @@
 #include "contomap/application/Application.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
 
 using contomap::application::Application;
+using contomap::frontend::InputFrame;
 
 Application::Application(contomap::frontend::DisplayEnvironment &displayEnvironment)
    : mainWindow(displayEnvironment, editor, editor)
@@ -22,6 +24,28 @@ void Application::nextFrame()
    mainWindow.nextFrame();
 }
 
+void Application::nextFrame(InputFrame const &input)
+{
+   mainWindow.nextFrame(input);
+}
+
+void Application::load(std::string const &filePath)
+{
+   mainWindow.load(filePath);
+}
+
+uint64_t Application::stateHash()
+{
+   contomap::infrastructure::serial::BinaryEncoder encoder;
+   editor.saveState(encoder, true);
+   uint64_t hash = 0xCBF29CE484222325;
+   for (uint8_t value : encoder.getData())
+   {
+      hash = (hash ^ value) * 0x00000100000001B3;
+   }
+   return hash;
+}
+
 void Application::close()
 {
    mainWindow.close();
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+
 #include "contomap/editor/Editor.h"
+#include "contomap/frontend/InputFrame.h"
 #include "contomap/frontend/MainWindow.h"
 
 namespace contomap::application
@@ -34,6 +38,28 @@ public:
     */
    void nextFrame();
 
+   /**
+    * Processes the next frame with given input, instead of the current state of the input devices.
+    *
+    * @param input the input to process.
+    */
+   void nextFrame(contomap::frontend::InputFrame const &input);
+
+   /**
+    * Loads the map from given file.
+    *
+    * @param filePath the path of the file to load.
+    */
+   void load(std::string const &filePath);
+
+   /**
+    * Calculates a hash of the current map, view scope, and selection.
+    * Runs that perform the same operations on the same map result in the same hash.
+    *
+    * @return the FNV-1a hash of the serialized state.
+    */
+   [[nodiscard]] uint64_t stateHash();
+
    /**
     * Forces a shutdown of the application. This method is called last.
     */
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/editor/Editor.h"
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::editor::Editor;
+using contomap::infrastructure::serial::BinaryDecoder;
+using contomap::infrastructure::serial::BinaryEncoder;
+
+static Editor editorWithSyntheticMap(size_t topicCount)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = topicCount, .occurrencesPerTopic = 2, .associationFanOut = 3 });
+   return Editor(std::move(synthetic.getMap()));
+}
+
+static void saveEditorState(benchmark::State &state)
+{
+   auto editor = editorWithSyntheticMap(static_cast<size_t>(state.range(0)));
+   for (auto _ : state)
+   {
+      BinaryEncoder encoder;
+      editor.saveState(encoder, true);
+      benchmark::DoNotOptimize(encoder.getData().data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(saveEditorState)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void loadEditorState(benchmark::State &state)
+{
+   auto source = editorWithSyntheticMap(static_cast<size_t>(state.range(0)));
+   BinaryEncoder encoder;
+   source.saveState(encoder, true);
+   auto const &data = encoder.getData();
+   Editor editor;
+   for (auto _ : state)
+   {
+      BinaryDecoder decoder(data.data(), data.data() + data.size());
+      benchmark::DoNotOptimize(editor.loadState(decoder));
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(loadEditorState)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
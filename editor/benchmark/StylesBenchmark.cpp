@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/editor/Styles.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::editor::Styles;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Occurrence;
+using contomap::model::OptionalIdentifier;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Style;
+
+// Each type topic has one occurrence, which is typed by the next topic of the chain.
+static void resolveStyleOfTypeChain(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = 1000 });
+   auto &map = synthetic.getMap();
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   std::vector<Identifier> typeIds;
+   std::vector<std::reference_wrapper<Occurrence>> typeOccurrences;
+   for (int64_t i = 0; i < state.range(0); i++)
+   {
+      auto &typeTopic = map.newTopic();
+      auto &occurrence = typeTopic.newOccurrence(scope, SpacialCoordinate::absoluteAt(0.0f, 0.0f));
+      occurrence.setAppearance(Style().with(Style::ColorType::Fill, Style::Color { .red = 0x10, .green = 0x20, .blue = 0x30, .alpha = 0xFF }));
+      if (!typeOccurrences.empty())
+      {
+         typeOccurrences.back().get().setType(typeTopic.getId());
+      }
+      typeIds.push_back(typeTopic.getId());
+      typeOccurrences.emplace_back(occurrence);
+   }
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(Styles::resolve(Style(), OptionalIdentifier::of(typeIds.front()), scope, map));
+   }
+}
+BENCHMARK(resolveStyleOfTypeChain)->Arg(1)->Arg(4)->Arg(9)->Unit(benchmark::kMicrosecond);
+
+// A map with a realistic number of types for its items. Half of the types are styled within the view scope,
+// the other half only within their own scope, as with type topics that are not placed in the view.
+struct TypedMap
+{
+   static size_t constexpr ITEM_COUNT = 10000;
+   static size_t constexpr TYPE_COUNT = 64;
+
+   TypedMap()
+      : synthetic(SyntheticMap::Parameters { .topicCount = 1000, .scopeDepth = 2 })
+   {
+      auto &map = synthetic.getMap();
+      auto const &scope = synthetic.getDeepestScope();
+      std::vector<Identifier> typeIds;
+      for (size_t i = 0; i < TYPE_COUNT; i++)
+      {
+         auto &typeTopic = map.newTopic();
+         auto styleScope = ((i % 2) == 0) ? scope : Identifiers::ofSingle(typeTopic.getId());
+         auto &styleOccurrence = typeTopic.newOccurrence(styleScope, SpacialCoordinate::absoluteAt(0.0f, 0.0f));
+         Style::Color fill { .red = static_cast<uint8_t>(i), .green = 0x20, .blue = 0x30, .alpha = 0xFF };
+         styleOccurrence.setAppearance(Style().with(Style::ColorType::Fill, fill));
+         typeIds.push_back(typeTopic.getId());
+      }
+      for (size_t i = 0; i < ITEM_COUNT; i++)
+      {
+         auto &occurrence = map.newTopic().newOccurrence(scope, SpacialCoordinate::absoluteAt(static_cast<float>(i), 0.0f));
+         occurrence.setType(typeIds[i % TYPE_COUNT]);
+         items.emplace_back(occurrence);
+      }
+   }
+
+   static TypedMap const &shared()
+   {
+      static TypedMap const instance;
+      return instance;
+   }
+
+   SyntheticMap synthetic;
+   std::vector<std::reference_wrapper<Occurrence const>> items;
+};
+
+// The styles of all items, as for one frame, with each thread resolving its share of them. Each style looks up the scope table.
+static void resolveStylesOfItemsByScope(benchmark::State &state)
+{
+   auto const &typed = TypedMap::shared();
+   auto const &map = typed.synthetic.getMap();
+   auto const &scope = typed.synthetic.getDeepestScope();
+   auto threadCount = static_cast<size_t>(state.threads());
+   auto threadIndex = static_cast<size_t>(state.thread_index());
+   for (auto _ : state)
+   {
+      for (size_t index = threadIndex; index < typed.items.size(); index += threadCount)
+      {
+         Occurrence const &item = typed.items[index];
+         benchmark::DoNotOptimize(Styles::resolve(item.getAppearance(), item.getType(), scope, map));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(typed.items.size() / threadCount));
+}
+BENCHMARK(resolveStylesOfItemsByScope)->Threads(1)->Threads(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// As above, with the scopes selected once for the frame and shared by all threads.
+static void resolveStylesOfItemsBySelection(benchmark::State &state)
+{
+   auto const &typed = TypedMap::shared();
+   auto const &map = typed.synthetic.getMap();
+   auto scopeSelection = map.getScopes().selectWithin(typed.synthetic.getDeepestScope());
+   auto threadCount = static_cast<size_t>(state.threads());
+   auto threadIndex = static_cast<size_t>(state.thread_index());
+   for (auto _ : state)
+   {
+      for (size_t index = threadIndex; index < typed.items.size(); index += threadCount)
+      {
+         Occurrence const &item = typed.items[index];
+         benchmark::DoNotOptimize(Styles::resolve(item.getAppearance(), item.getType(), *scopeSelection, map));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(typed.items.size() / threadCount));
+}
+BENCHMARK(resolveStylesOfItemsBySelection)->Threads(1)->Threads(4)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -1,10 +1,15 @@
 #include "contomap/editor/Editor.h"
 #include "contomap/editor/Selections.h"
+#include "contomap/infrastructure/Trace.h"
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
 #include "contomap/model/Topics.h"
 
 using contomap::editor::Editor;
 using contomap::editor::SelectedType;
 using contomap::editor::SelectionAction;
+using contomap::infrastructure::serial::BinaryDecoder;
+using contomap::infrastructure::serial::BinaryEncoder;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
@@ -23,9 +28,14 @@ using contomap::model::Topics;
 uint8_t const Editor::CURRENT_SERIAL_VERSION = 0x00;
 
 Editor::Editor()
-   : map(Contomap::newMap())
+   : Editor(Contomap::newMap())
 {
-   viewScope.add(map.getDefaultScope());
+}
+
+Editor::Editor(Contomap map)
+   : map(std::move(map))
+{
+   viewScope.add(this->map.getDefaultScope());
 }
 
 void Editor::newMap()
@@ -115,6 +125,18 @@ void Editor::modifySelection(SelectedType type, Identifier id, SelectionAction a
    }
 }
 
+void Editor::modifySelection(Selection const &items, SelectionAction action)
+{
+   if (action == SelectionAction::Set)
+   {
+      selection = items;
+   }
+   else if (action == SelectionAction::Toggle)
+   {
+      selection.toggle(items);
+   }
+}
+
 void Editor::linkSelection()
 {
    auto &associationIds = selection.of(SelectedType::Association);
@@ -157,6 +179,7 @@ void Editor::linkSelection()
 
 void Editor::deleteSelection()
 {
+   CONTOMAP_TRACE_ZONE("Editor::deleteSelection");
    map.deleteRoles(selection.of(SelectedType::Role));
    map.deleteAssociations(selection.of(SelectedType::Association));
    map.deleteOccurrences(selection.of(SelectedType::Occurrence));
@@ -437,8 +460,27 @@ void Editor::selectClosestOccurrenceOf(Identifier topicId)
    selection.setSole(SelectedType::Occurrence, occurrence.getId());
 }
 
+void Editor::performBatch(BatchOperations const &operations)
+{
+   CONTOMAP_TRACE_ZONE("Editor::performBatch");
+   BinaryEncoder encoder;
+   saveState(encoder, true);
+   try
+   {
+      operations(*this);
+   }
+   catch (...)
+   {
+      auto const &data = encoder.getData();
+      BinaryDecoder decoder(data.data(), data.data() + data.size());
+      static_cast<void>(loadState(decoder));
+      throw;
+   }
+}
+
 void Editor::saveState(Encoder &encoder, bool withSelection)
 {
+   CONTOMAP_TRACE_ZONE("Editor::saveState");
    encoder.code("version", CURRENT_SERIAL_VERSION);
    map.encode(encoder);
    viewScope.encode(encoder, "viewScope");
@@ -455,6 +497,7 @@ void Editor::saveState(Encoder &encoder, bool withSelection)
 
 bool Editor::loadState(Decoder &decoder)
 {
+   CONTOMAP_TRACE_ZONE("Editor::loadState");
    Contomap newMap = contomap::model::Contomap::newMap();
    Identifiers newViewScope;
    Selection newSelection;
@@ -98,6 +98,22 @@ void Selection::toggle(SelectedType type, Identifier id)
    }
 }
 
+void Selection::toggle(Selection const &other)
+{
+   for (auto const &[type, otherIds] : other.identifiers)
+   {
+      for (auto id : otherIds)
+      {
+         toggle(type, id);
+      }
+   }
+}
+
+void Selection::add(SelectedType type, Identifier id)
+{
+   identifiers[type].add(id);
+}
+
 bool Selection::contains(SelectedType type, Identifier id) const
 {
    auto it = identifiers.find(type);
@@ -6,15 +6,22 @@ using contomap::model::Identifier;
 using contomap::model::Identifiers;
 using contomap::model::Occurrence;
 using contomap::model::OptionalIdentifier;
+using contomap::model::ScopeTable;
 using contomap::model::Style;
 using contomap::model::Topic;
 
 Style Styles::resolve(Style const &localStyle, OptionalIdentifier localTypeId, Identifiers const &scope, ContomapView const &view)
 {
-   return resolve(localStyle, localTypeId, scope, view, 0);
+   return resolve(localStyle, localTypeId, *view.getScopes().selectWithin(scope), view, 0);
 }
 
-Style Styles::resolve(Style const &localStyle, OptionalIdentifier localTypeId, Identifiers const &scope, ContomapView const &view, size_t depth) // NOLINT
+Style Styles::resolve(Style const &localStyle, OptionalIdentifier localTypeId, ScopeTable::Selection const &scopeSelection, ContomapView const &view)
+{
+   return resolve(localStyle, localTypeId, scopeSelection, view, 0);
+}
+
+Style Styles::resolve(
+   Style const &localStyle, OptionalIdentifier localTypeId, ScopeTable::Selection const &scopeSelection, ContomapView const &view, size_t depth) // NOLINT
 {
    if ((depth >= 10) || !localTypeId.isAssigned())
    {
@@ -27,12 +34,19 @@ Style Styles::resolve(Style const &localStyle, OptionalIdentifier localTypeId, I
       return localStyle;
    }
    Topic const &topic = potentialTopic.value();
-   auto scopedView = std::ranges::common_view(topic.occurrencesIn(scope));
+   auto scopedView = std::ranges::common_view(topic.occurrencesIn(scopeSelection));
    std::vector<std::reference_wrapper<Occurrence const>> occurrences(scopedView.begin(), scopedView.end());
    if (occurrences.empty())
    {
-      auto ownView = std::ranges::common_view(topic.occurrencesIn(Identifiers::ofSingle(topic.getId())));
-      occurrences.assign(ownView.begin(), ownView.end());
+      // The own scope of the type is checked directly, as a selection of it would only ever serve this one topic.
+      auto ownScope = Identifiers::ofSingle(topic.getId());
+      for (Occurrence const &occurrence : topic.allOccurrences())
+      {
+         if (occurrence.isIn(ownScope))
+         {
+            occurrences.emplace_back(occurrence);
+         }
+      }
    }
    if (occurrences.empty())
    {
@@ -46,7 +60,7 @@ Style Styles::resolve(Style const &localStyle, OptionalIdentifier localTypeId, I
    {
       if (occurrence.hasSameScopeSizeAs(reference))
       {
-         typeStyles.emplace_back(resolve(occurrence.getAppearance(), occurrence.getType(), scope, view, depth + 1));
+         typeStyles.emplace_back(resolve(occurrence.getAppearance(), occurrence.getType(), scopeSelection, view, depth + 1));
       }
    }
    return localStyle.withDefaultsFrom(Style::averageOf(typeStyles));
@@ -18,6 +18,12 @@ class Editor : public contomap::editor::InputRequestHandler, public contomap::ed
 {
 public:
    Editor();
+   /**
+    * Constructor, for editing an existing map within its default scope.
+    *
+    * @param map the map to edit.
+    */
+   explicit Editor(contomap::model::Contomap map);
 
    void newMap() override;
 
@@ -30,6 +36,7 @@ public:
    contomap::model::Identifier newAssociationRequested(contomap::model::SpacialCoordinate location) override;
    void clearSelection() override;
    void modifySelection(contomap::editor::SelectedType type, contomap::model::Identifier id, contomap::editor::SelectionAction action) override;
+   void modifySelection(contomap::editor::Selection const &items, contomap::editor::SelectionAction action) override;
    void linkSelection() override;
    void deleteSelection() override;
    void setAppearanceOfSelection(contomap::model::Style style) override;
@@ -49,6 +56,7 @@ public:
    void cycleSelectedOccurrenceForward() override;
    void cycleSelectedOccurrenceReverse() override;
    void selectClosestOccurrenceOf(contomap::model::Identifier topicId) override;
+   void performBatch(BatchOperations const &operations) override;
 
    void saveState(contomap::infrastructure::serial::Encoder &encoder, bool withSelection) override;
    [[nodiscard]] bool loadState(contomap::infrastructure::serial::Decoder &decoder) override;
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <functional>
+
 #include "contomap/editor/SelectedType.h"
+#include "contomap/editor/Selection.h"
 #include "contomap/editor/SelectionAction.h"
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
@@ -18,6 +21,11 @@ namespace contomap::editor
 class InputRequestHandler
 {
 public:
+   /**
+    * BatchOperations performs several requests on the provided handler, as part of a batch.
+    */
+   using BatchOperations = std::function<void(InputRequestHandler &handler)>;
+
    virtual ~InputRequestHandler() = default;
 
    /**
@@ -87,6 +95,16 @@ public:
     */
    virtual void modifySelection(contomap::editor::SelectedType type, contomap::model::Identifier id, contomap::editor::SelectionAction action) = 0;
 
+   /**
+    * Called to modify the active selection with several items at once, such as those within an area.
+    * The items are applied as one request, which is equal to modifying the selection with each of the items.
+    * With SelectionAction::Set, the selection consists of exactly the given items afterwards.
+    *
+    * @param items the items to apply to the selection.
+    * @param action what kind of selection action is requested.
+    */
+   virtual void modifySelection(contomap::editor::Selection const &items, contomap::editor::SelectionAction action) = 0;
+
    /**
     * Called to request a link between the selected items.
     * In case the selection contains one (or more) associations, all the topics from the selected occurrences will be assigned to them.
@@ -205,6 +223,14 @@ public:
     */
    virtual void selectClosestOccurrenceOf(contomap::model::Identifier topicId) = 0;
 
+   /**
+    * Performs several requests as one operation. The operations must only use the provided handler.
+    * Should the operations throw an exception, all of their changes are rolled back and the exception is passed on.
+    *
+    * @param operations the function that performs the requests.
+    */
+   virtual void performBatch(BatchOperations const &operations) = 0;
+
    /**
     * Requests to save the current state using the given coder.
     *
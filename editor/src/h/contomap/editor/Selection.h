@@ -86,6 +86,21 @@ public:
     */
    void toggle(contomap::editor::SelectedType type, contomap::model::Identifier id);
 
+   /**
+    * Toggles each item of the other selection.
+    *
+    * @param other the selection with the items to toggle.
+    */
+   void toggle(contomap::editor::Selection const &other);
+
+   /**
+    * Adds the identified item, in addition to any other item.
+    *
+    * @param type the type of the identified item.
+    * @param id the identifier of the item.
+    */
+   void add(contomap::editor::SelectedType type, contomap::model::Identifier id);
+
    /**
     * Determines whether a specific thing is part of the selection.
     *
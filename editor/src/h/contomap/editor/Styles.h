@@ -1,6 +1,7 @@
 #pragma once
 
 #include "contomap/model/ContomapView.h"
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/Style.h"
 
 namespace contomap::editor
@@ -23,9 +24,23 @@ public:
    [[nodiscard]] static contomap::model::Style resolve(contomap::model::Style const &localStyle, contomap::model::OptionalIdentifier localTypeId,
       contomap::model::Identifiers const &scope, contomap::model::ContomapView const &view);
 
+   /**
+    * Resolves the style for a local item, within the view scope of a selection of the scopes of the view.
+    * Resolving many items with the same selection spares looking up the scope table for each of them,
+    * which also allows resolving from several threads at once.
+    *
+    * @param localStyle the style set for the local item.
+    * @param localTypeId the type set for the local item.
+    * @param scopeSelection the selection of the scope within which to resolve the style.
+    * @param view the view from which to retrieve further types.
+    * @return the final style.
+    */
+   [[nodiscard]] static contomap::model::Style resolve(contomap::model::Style const &localStyle, contomap::model::OptionalIdentifier localTypeId,
+      contomap::model::ScopeTable::Selection const &scopeSelection, contomap::model::ContomapView const &view);
+
 private:
    [[nodiscard]] static contomap::model::Style resolve(contomap::model::Style const &localStyle, contomap::model::OptionalIdentifier localTypeId,
-      contomap::model::Identifiers const &scope, contomap::model::ContomapView const &view, size_t depth);
+      contomap::model::ScopeTable::Selection const &scopeSelection, contomap::model::ContomapView const &view, size_t depth);
 };
 
 } // namespace contomap::editor
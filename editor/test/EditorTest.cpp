@@ -23,6 +23,7 @@ using contomap::editor::SelectionAction;
 using contomap::infrastructure::serial::BinaryDecoder;
 using contomap::infrastructure::serial::BinaryEncoder;
 using contomap::model::Association;
+using contomap::model::Contomap;
 using contomap::model::ContomapView;
 using contomap::model::Filter;
 using contomap::model::Identifier;
@@ -262,6 +263,16 @@ public:
          handler.modifySelection(type, id, SelectionAction::Toggle);
       }
 
+      void selectsAll(Selection const &items)
+      {
+         handler.modifySelection(items, SelectionAction::Set);
+      }
+
+      void togglesSelectionOfAll(Selection const &items)
+      {
+         handler.modifySelection(items, SelectionAction::Toggle);
+      }
+
       void movesTheSelectionBy(SpacialCoordinate::Offset offset)
       {
          handler.moveSelectionBy(offset);
@@ -292,6 +303,11 @@ public:
          handler.cycleSelectedOccurrenceReverse();
       }
 
+      void performsBatch(InputRequestHandler::BatchOperations const &operations)
+      {
+         handler.performBatch(operations);
+      }
+
    private:
       InputRequestHandler &handler;
    };
@@ -503,6 +519,36 @@ TEST_P(EditorTest, newAssociationsCreatedByLinkingThroughSelectionIsCentredBetwe
    then().view().ofMap().shouldHaveOneAssociationNear(SpacialCoordinate::absoluteAt(-2.5f, 15.0f));
 }
 
+TEST_P(EditorTest, selectingSeveralItemsReplacesTheSelection)
+{
+   Identifier topicId1 = given().user().requestsANewTopic();
+   Identifier topicId2 = given().user().requestsANewTopic();
+   Identifier associationId = given().user().requestsANewAssociation();
+   Selection items;
+   items.add(SelectedType::Occurrence, occurrenceOf(topicId1).getId());
+   items.add(SelectedType::Occurrence, occurrenceOf(topicId2).getId());
+   when().user().selectsAll(items);
+   then().view().ofSelection().should([associationId](Selection const &selection) {
+      EXPECT_THAT(selection.of(SelectedType::Occurrence), testing::SizeIs(2));
+      EXPECT_FALSE(selection.contains(SelectedType::Association, associationId));
+   });
+}
+
+TEST_P(EditorTest, togglingSeveralItemsTogglesEachOfThem)
+{
+   Identifier topicId1 = given().user().requestsANewTopic();
+   Identifier topicId2 = given().user().requestsANewTopic();
+   given().user().selects(SelectedType::Occurrence, occurrenceOf(topicId1).getId());
+   Selection items;
+   items.add(SelectedType::Occurrence, occurrenceOf(topicId1).getId());
+   items.add(SelectedType::Occurrence, occurrenceOf(topicId2).getId());
+   when().user().togglesSelectionOfAll(items);
+   then().view().ofSelection().should([this, topicId1, topicId2](Selection const &selection) {
+      EXPECT_FALSE(selection.contains(SelectedType::Occurrence, occurrenceOf(topicId1).getId()));
+      EXPECT_TRUE(selection.contains(SelectedType::Occurrence, occurrenceOf(topicId2).getId()));
+   });
+}
+
 TEST_P(EditorTest, newTopicHasItsOccurrenceSelected)
 {
    when().user().requestsANewTopic();
@@ -1025,3 +1071,53 @@ TEST_P(EditorTest, movingSelection)
       EXPECT_THAT(occurrence->get().getLocation().getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(expected.X(), expected.Y())));
    });
 }
+
+TEST_P(EditorTest, batchAppliesAllOperations)
+{
+   auto position = someSpacialCoordinate();
+   auto offset = SpacialCoordinate::Offset::of(10.0f, 20.0f);
+   Identifier topicId = given().user().requestsANewTopic().at(position);
+   Identifier occurrenceId = occurrenceOf(topicId).getId();
+   when().user().performsBatch([topicId, offset](InputRequestHandler &handler) {
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      handler.selectClosestOccurrenceOf(topicId);
+      handler.moveSelectionBy(offset);
+   });
+   then().view().ofMap().shouldHaveTopicCountOf(4);
+   then().view().ofMap().shouldHaveTopicThat(topicId, [occurrenceId, position, offset](Topic const &topic) {
+      auto occurrence = topic.getOccurrence(occurrenceId);
+      ASSERT_TRUE(occurrence.has_value());
+      auto expected = position.getAbsoluteReference().plus(offset);
+      EXPECT_THAT(occurrence->get().getLocation().getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(expected.X(), expected.Y())));
+   });
+}
+
+TEST_P(EditorTest, failingBatchIsRolledBack)
+{
+   Identifier topicId = given().user().requestsANewTopic();
+   Identifier occurrenceId = occurrenceOf(topicId).getId();
+   given().user().selects(SelectedType::Occurrence, occurrenceId);
+   auto failingOperations = [](InputRequestHandler &handler) {
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      handler.deleteSelection();
+      throw std::runtime_error("aborted");
+   };
+   EXPECT_THROW(when().user().performsBatch(failingOperations), std::runtime_error);
+   then().view().ofMap().shouldHaveTopicCountOf(2);
+   then().view().ofMap().shouldHaveTopicThat(topicId, [occurrenceId](Topic const &topic) { EXPECT_TRUE(topic.getOccurrence(occurrenceId).has_value()); });
+   then().view().ofSelection().should(
+      [occurrenceId](Selection const &selection) { EXPECT_TRUE(selection.contains(SelectedType::Occurrence, occurrenceId)); });
+}
+
+TEST(EditorConstructionTest, existingMapIsEditedInItsDefaultScope)
+{
+   auto map = Contomap::newMap();
+   auto topicId = map.newTopic().getId();
+   auto defaultScope = map.getDefaultScope();
+
+   Editor editor(std::move(map));
+   EXPECT_EQ(1, editor.ofViewScope().size());
+   EXPECT_TRUE(editor.ofViewScope().contains(defaultScope));
+   EXPECT_TRUE(editor.ofMap().findTopic(topicId).has_value());
+}
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include "contomap/frontend/BatchingMapRenderer.h"
+#include "contomap/frontend/LevelOfDetail.h"
+
+using contomap::frontend::BatchingMapRenderer;
+using contomap::frontend::LevelOfDetail;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+// A screen full of occurrences in rows, none of which cover the titles of the others.
+static void renderSeparateOccurrences(benchmark::State &state)
+{
+   auto count = static_cast<size_t>(state.range(0));
+   size_t constexpr COLUMNS = 20;
+   BatchingMapRenderer renderer(LevelOfDetail::full());
+   Style style;
+   InternedString text;
+   auto id = Identifier::random();
+   for (auto _ : state)
+   {
+      renderer.restart(LevelOfDetail::full());
+      for (size_t i = 0; i < count; i++)
+      {
+         Rectangle area { .x = static_cast<float>(i % COLUMNS) * 120.0f, .y = static_cast<float>(i / COLUMNS) * 30.0f, .width = 100.0f, .height = 20.0f };
+         renderer.renderOccurrencePlate(id, area, style, area, 1.0f, false);
+         renderer.renderText(area, style, text, Font {}, 20.0f, 1.0f);
+      }
+      renderer.flush();
+      benchmark::DoNotOptimize(renderer.getStatistics());
+   }
+   state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(renderSeparateOccurrences)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
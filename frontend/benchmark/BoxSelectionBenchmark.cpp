@@ -0,0 +1,44 @@
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/editor/Editor.h"
+#include "contomap/editor/Selection.h"
+#include "contomap/frontend/MapHitIndex.h"
+
+using contomap::editor::Editor;
+using contomap::editor::Selection;
+using contomap::editor::SelectionAction;
+using contomap::frontend::MapHitIndex;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+// A box around all plates of a square grid, as with a rubber band dragged over a dense area of the map.
+static void selectItemsWithinBox(benchmark::State &state)
+{
+   auto itemCount = static_cast<size_t>(state.range(0));
+   auto columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(itemCount))));
+   float constexpr SPACING = 40.0f;
+   MapHitIndex hitIndex;
+   Style style;
+   for (size_t i = 0; i < itemCount; i++)
+   {
+      Rectangle area { .x = static_cast<float>(i % columns) * SPACING, .y = static_cast<float>(i / columns) * SPACING, .width = 30.0f, .height = 20.0f };
+      hitIndex.renderOccurrencePlate(Identifier::random(), area, style, area, 1.0f, false);
+   }
+   Rectangle box { .x = -1.0f, .y = -1.0f, .width = static_cast<float>(columns) * SPACING, .height = static_cast<float>(columns) * SPACING };
+   Editor editor;
+
+   for (auto _ : state)
+   {
+      Selection items;
+      for (auto const &item : hitIndex.platesWithin(box))
+      {
+         items.add(item.type, item.id);
+      }
+      editor.modifySelection(items, SelectionAction::Set);
+      benchmark::DoNotOptimize(editor.ofSelection());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(selectItemsWithinBox)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,67 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/editor/Editor.h"
+#include "contomap/frontend/EditBuffer.h"
+#include "contomap/frontend/MapCamera.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::editor::Editor;
+using contomap::editor::SelectedType;
+using contomap::editor::SelectionAction;
+using contomap::frontend::EditBuffer;
+using contomap::frontend::MapCamera;
+using contomap::model::SpacialCoordinate;
+
+// Each operation records the complete state of the editor, which makes the size of the map the dominant factor.
+static void recordOperation(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = static_cast<size_t>(state.range(0)) });
+   auto topicId = synthetic.getTopicIds().front();
+   Editor editor(std::move(synthetic.getMap()));
+   MapCamera camera(std::make_shared<MapCamera::ImmediateGearbox>());
+   EditBuffer buffer(editor, camera);
+   auto occurrenceId = (*editor.ofMap().findTopic(topicId).value().get().occurrencesIn(editor.ofViewScope()).begin()).get().getId();
+   buffer.modifySelection(SelectedType::Occurrence, occurrenceId, SelectionAction::Set);
+
+   for (auto _ : state)
+   {
+      buffer.moveSelectionBy(SpacialCoordinate::Offset::of(1.0f, 0.0f));
+      // Undoing keeps the history short, as the next operation replaces the undone one.
+      state.PauseTiming();
+      buffer.undo();
+      state.ResumeTiming();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(recordOperation)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// A batch of operations records the state once, regardless of how many requests it contains.
+static void recordBatch(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = 10000 });
+   auto topicId = synthetic.getTopicIds().front();
+   Editor editor(std::move(synthetic.getMap()));
+   MapCamera camera(std::make_shared<MapCamera::ImmediateGearbox>());
+   EditBuffer buffer(editor, camera);
+   auto occurrenceId = (*editor.ofMap().findTopic(topicId).value().get().occurrencesIn(editor.ofViewScope()).begin()).get().getId();
+   buffer.modifySelection(SelectedType::Occurrence, occurrenceId, SelectionAction::Set);
+   auto requestCount = state.range(0);
+
+   for (auto _ : state)
+   {
+      buffer.performBatch([requestCount](contomap::editor::InputRequestHandler &handler) {
+         for (int64_t i = 0; i < requestCount; i++)
+         {
+            handler.moveSelectionBy(SpacialCoordinate::Offset::of(1.0f, 0.0f));
+         }
+      });
+      state.PauseTiming();
+      buffer.undo();
+      state.ResumeTiming();
+   }
+   state.SetItemsProcessed(state.iterations() * requestCount);
+}
+BENCHMARK(recordBatch)->Arg(1)->Arg(1000)->Unit(benchmark::kMillisecond);
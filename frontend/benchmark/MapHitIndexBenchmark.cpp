@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+
+#include "contomap/frontend/MapHitIndex.h"
+
+using contomap::frontend::MapHitIndex;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+// Diagonal role lines of given length, as between items that are far apart on the map.
+static void captureDiagonalRoleLines(benchmark::State &state)
+{
+   auto length = static_cast<float>(state.range(0));
+   size_t constexpr LINE_COUNT = 100;
+   Style style;
+   for (auto _ : state)
+   {
+      MapHitIndex hitIndex;
+      for (size_t i = 0; i < LINE_COUNT; i++)
+      {
+         auto offset = static_cast<float>(i) * 10.0f;
+         hitIndex.renderRoleLine(Identifier::random(), Vector2 { .x = offset, .y = 0.0f }, Vector2 { .x = offset + length, .y = length }, style, 1.0f, false);
+      }
+      benchmark::DoNotOptimize(hitIndex);
+   }
+   state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * LINE_COUNT));
+}
+BENCHMARK(captureDiagonalRoleLines)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
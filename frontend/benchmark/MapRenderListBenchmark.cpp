@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/editor/Selection.h"
+#include "contomap/editor/View.h"
+#include "contomap/frontend/Focus.h"
+#include "contomap/frontend/LevelOfDetail.h"
+#include "contomap/frontend/MapCamera.h"
+#include "contomap/frontend/MapRenderWalk.h"
+#include "contomap/frontend/OffsetMapRenderer.h"
+#include "contomap/infrastructure/TaskScheduler.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::editor::Selection;
+using contomap::editor::View;
+using contomap::frontend::Focus;
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::MapCamera;
+using contomap::frontend::MapRenderer;
+using contomap::frontend::MapRenderWalk;
+using contomap::frontend::OffsetMapRenderer;
+using contomap::infrastructure::InternedString;
+using contomap::infrastructure::TaskScheduler;
+using contomap::model::ContomapView;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Style;
+
+class NoOpRenderer : public MapRenderer
+{
+public:
+   void renderText(Rectangle, Style const &, InternedString const &, Font, float, float) override
+   {
+   }
+   void renderOccurrencePlate(Identifier, Rectangle, Style const &, Rectangle, float, bool) override
+   {
+   }
+   void renderAssociationPlate(Identifier, Rectangle, Style const &, Rectangle, float, bool) override
+   {
+   }
+   void renderRoleLine(Identifier, Vector2, Vector2, Style const &, float, bool) override
+   {
+   }
+   void renderClusterGlyph(Rectangle, Style const &, size_t) override
+   {
+   }
+};
+
+// Shows a synthetic map through its deepest scope, without a selection.
+class SyntheticView : public View
+{
+public:
+   explicit SyntheticView(SyntheticMap const &synthetic)
+      : synthetic(synthetic)
+   {
+   }
+
+   [[nodiscard]] Identifiers const &ofViewScope() const override
+   {
+      return synthetic.getDeepestScope();
+   }
+
+   [[nodiscard]] ContomapView const &ofMap() const override
+   {
+      return synthetic.getMap();
+   }
+
+   [[nodiscard]] Selection const &ofSelection() const override
+   {
+      return selection;
+   }
+
+private:
+   SyntheticMap const &synthetic;
+   Selection selection;
+};
+
+// Follows the main window for a frame: the view is walked at the level of detail of a zoom factor, given in percent,
+// and the optimized list is replayed.
+static void buildRenderList(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters {
+      .topicCount = static_cast<size_t>(state.range(0)), .occurrencesPerTopic = 2, .associationFanOut = 3, .scopeDepth = 2 });
+   SyntheticView view(synthetic);
+   TaskScheduler scheduler(TaskScheduler::defaultWorkerCount());
+   MapRenderWalk walk(view, scheduler);
+   auto detail = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::from(static_cast<float>(state.range(1)) / 100.0f));
+   NoOpRenderer renderer;
+   for (auto _ : state)
+   {
+      MapRenderWalk::Layers layers;
+      static_cast<void>(walk.renderMap(layers, view.ofSelection(), Focus {}, detail, false));
+      layers.fixed.optimize();
+      layers.fixed.renderTo(renderer);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(buildRenderList)->Args({ 1000, 100 })->Args({ 10000, 100 })->Args({ 10000, 25 })->Unit(benchmark::kMillisecond);
+
+// Follows the main window while dragging: the list is built once, and only replayed with the current drag offset.
+static void replayTranslatedRenderList(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters {
+      .topicCount = static_cast<size_t>(state.range(0)), .occurrencesPerTopic = 2, .associationFanOut = 3, .scopeDepth = 2 });
+   SyntheticView view(synthetic);
+   TaskScheduler scheduler(TaskScheduler::defaultWorkerCount());
+   MapRenderWalk walk(view, scheduler);
+   MapRenderWalk::Layers layers;
+   static_cast<void>(walk.renderMap(layers, view.ofSelection(), Focus {}, LevelOfDetail::full(), false));
+   auto &list = layers.fixed;
+   list.optimize();
+   NoOpRenderer renderer;
+   float offset = 0.0f;
+   for (auto _ : state)
+   {
+      offset += 1.0f;
+      OffsetMapRenderer translated(renderer, Vector2 { .x = offset, .y = offset });
+      list.renderTo(translated);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(replayTranslatedRenderList)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,32 @@
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/frontend/Names.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::frontend::Names;
+using contomap::model::Topic;
+
+static void namesForScopedDisplay(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = 1000, .scopeDepth = static_cast<size_t>(state.range(0)) });
+   auto const &map = synthetic.getMap();
+   auto const &scope = synthetic.getDeepestScope();
+   std::vector<std::reference_wrapper<Topic const>> topics;
+   for (auto topicId : synthetic.getTopicIds())
+   {
+      topics.emplace_back(map.findTopic(topicId).value());
+   }
+   for (auto _ : state)
+   {
+      for (Topic const &topic : topics)
+      {
+         benchmark::DoNotOptimize(Names::forScopedDisplay(topic, scope, map.getDefaultScope()));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(topics.size()));
+}
+BENCHMARK(namesForScopedDisplay)->Arg(0)->Arg(4)->Unit(benchmark::kMicrosecond);
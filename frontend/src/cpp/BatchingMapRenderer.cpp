@@ -0,0 +1,393 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+#pragma GCC diagnostic pop
+
+#include "contomap/frontend/BatchingMapRenderer.h"
+#include "contomap/frontend/Colors.h"
+#include "contomap/frontend/Geometry.h"
+
+using contomap::frontend::BatchingMapRenderer;
+using contomap::frontend::Colors;
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::geometry::boxSpanning;
+using contomap::frontend::geometry::overlaps;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+BatchingMapRenderer::BatchingMapRenderer(LevelOfDetail detail)
+   : detail(detail)
+{
+}
+
+void BatchingMapRenderer::restart(LevelOfDetail newDetail)
+{
+   detail = newDetail;
+   currentLayer = Layer::Unknown;
+   triangles.clear();
+   clearPendingTexts();
+   statistics = Statistics();
+}
+
+void BatchingMapRenderer::flush()
+{
+   submitTriangles();
+   submitTexts();
+}
+
+BatchingMapRenderer::Statistics BatchingMapRenderer::getStatistics() const
+{
+   return statistics;
+}
+
+void BatchingMapRenderer::renderText(Rectangle area, Style const &style, InternedString const &text, Font font, float fontSize, float spacing)
+{
+   statistics.requestCount++;
+   flushTextsCoveredBy(area);
+   triangles.addRectangle(area, Colors::toUiColor(style.get(Style::ColorType::Fill)));
+   auto textColor = Colors::toUiColor(style.get(Style::ColorType::Text));
+   if (!detail.showsTextOfSize(fontSize))
+   {
+      // Illegible glyphs are only noise - a bar still hints at the length of the text.
+      float barHeight = area.height * 0.4f;
+      Rectangle bar { .x = area.x, .y = area.y + (area.height - barHeight) / 2.0f, .width = area.width, .height = barHeight };
+      triangles.addRectangle(bar, Fade(textColor, 0.5f));
+      return;
+   }
+   if (pendingTextCount == texts.size())
+   {
+      texts.emplace_back();
+   }
+   if (pendingTextCount == 0)
+   {
+      pendingTextBounds = area;
+      // The grid is centered on the first text, as the following ones are typically around it on the screen.
+      float halfGridSize = TEXT_CELL_SIZE * static_cast<float>(TEXT_GRID_SIZE) / 2.0f;
+      textGridOrigin = Vector2 { .x = area.x + area.width / 2.0f - halfGridSize, .y = area.y + area.height / 2.0f - halfGridSize };
+   }
+   else
+   {
+      float right = std::max(pendingTextBounds.x + pendingTextBounds.width, area.x + area.width);
+      float bottom = std::max(pendingTextBounds.y + pendingTextBounds.height, area.y + area.height);
+      pendingTextBounds.x = std::min(pendingTextBounds.x, area.x);
+      pendingTextBounds.y = std::min(pendingTextBounds.y, area.y);
+      pendingTextBounds.width = right - pendingTextBounds.x;
+      pendingTextBounds.height = bottom - pendingTextBounds.y;
+   }
+   addPendingTextCells(pendingTextCount, area);
+   auto &pending = texts[pendingTextCount++];
+   pending.area = area;
+   pending.position = Vector2 { .x = area.x, .y = area.y };
+   pending.color = textColor;
+   pending.text = text;
+   pending.font = font;
+   pending.fontSize = fontSize;
+   pending.spacing = spacing;
+}
+
+void BatchingMapRenderer::renderOccurrencePlate(Identifier, Rectangle area, Style const &style, Rectangle plate, float lineThickness, bool reified)
+{
+   enterLayer(Layer::Occurrences);
+   statistics.requestCount++;
+   flushTextsCoveredBy(area);
+   triangles.addRectangle(plate, Colors::toUiColor(style.get(Style::ColorType::Fill)));
+   std::array<Vector2, 10> vertices {
+      Vector2 { .x = plate.x - lineThickness, .y = plate.y - lineThickness },
+      Vector2 { .x = plate.x, .y = plate.y },
+      Vector2 { .x = plate.x + plate.width + lineThickness, .y = plate.y - lineThickness },
+      Vector2 { .x = plate.x + plate.width, .y = plate.y },
+      Vector2 { .x = plate.x + plate.width + lineThickness, .y = plate.y + plate.height + lineThickness },
+      Vector2 { .x = plate.x + plate.width, .y = plate.y + plate.height },
+      Vector2 { .x = plate.x - lineThickness, .y = plate.y + plate.height + lineThickness },
+      Vector2 { .x = plate.x, .y = plate.y + plate.height },
+      Vector2 { .x = plate.x - lineThickness, .y = plate.y - lineThickness },
+      Vector2 { .x = plate.x, .y = plate.y },
+   };
+   auto lineColor = Colors::toUiColor(style.get(Style::ColorType::Line));
+   triangles.addTriangleStrip(vertices, lineColor);
+   if (reified && detail.showsDecorations())
+   {
+      float half = lineThickness / 2.0f;
+      triangles.addLine(
+         Vector2 { .x = area.x + half, .y = area.y }, lineColor, Vector2 { .x = area.x + half, .y = area.y + area.height }, lineColor, lineThickness);
+      triangles.addLine(Vector2 { .x = area.x + area.width - half, .y = area.y }, lineColor,
+         Vector2 { .x = area.x + area.width - half, .y = area.y + area.height }, lineColor, lineThickness);
+   }
+}
+
+void BatchingMapRenderer::renderAssociationPlate(Identifier, Rectangle area, Style const &style, Rectangle plate, float lineThickness, bool reified)
+{
+   enterLayer(Layer::Associations);
+   statistics.requestCount++;
+   flushTextsCoveredBy(area);
+   float centerY = plate.y + (plate.height / 2.0f);
+   {
+      float halfHeight = plate.height / 2.0f;
+      Vector2 center { .x = plate.x + (plate.width / 2.0f), .y = centerY };
+      auto color = Colors::toUiColor(style.get(Style::ColorType::Fill));
+      Vector2 topLeft { .x = plate.x, .y = plate.y };
+      Vector2 topRight { .x = plate.x + plate.width, .y = plate.y };
+      Vector2 bottomLeft { .x = plate.x, .y = plate.y + plate.height };
+      Vector2 bottomRight { .x = plate.x + plate.width, .y = plate.y + plate.height };
+      Vector2 leftTip { .x = plate.x - halfHeight, .y = centerY };
+      Vector2 rightTip { .x = plate.x + plate.width + halfHeight, .y = centerY };
+
+      triangles.addTriangle(center, topRight, topLeft, color);
+      triangles.addTriangle(center, rightTip, topRight, color);
+      triangles.addTriangle(center, bottomRight, rightTip, color);
+      triangles.addTriangle(center, bottomLeft, bottomRight, color);
+      triangles.addTriangle(center, leftTip, bottomLeft, color);
+      triangles.addTriangle(center, topLeft, leftTip, color);
+   }
+   {
+      float halfHeight = plate.height / 2.0f;
+      float slant = lineThickness * 0.4f;
+      std::array<Vector2, 14> lineVertices {
+         Vector2 { .x = plate.x, .y = plate.y - lineThickness },
+         Vector2 { .x = plate.x + slant, .y = plate.y },
+         Vector2 { .x = plate.x + plate.width, .y = plate.y - lineThickness },
+         Vector2 { .x = plate.x + plate.width - slant, .y = plate.y },
+         Vector2 { .x = plate.x + plate.width + halfHeight + lineThickness, .y = centerY },
+         Vector2 { .x = plate.x + plate.width + halfHeight - slant, .y = centerY },
+         Vector2 { .x = plate.x + plate.width, .y = plate.y + plate.height + lineThickness },
+         Vector2 { .x = plate.x + plate.width - slant, .y = plate.y + plate.height },
+         Vector2 { .x = plate.x, .y = plate.y + plate.height + lineThickness },
+         Vector2 { .x = plate.x + slant, .y = plate.y + plate.height },
+         Vector2 { .x = plate.x - halfHeight - lineThickness, .y = centerY },
+         Vector2 { .x = plate.x - halfHeight + slant, .y = centerY },
+         Vector2 { .x = plate.x, .y = plate.y - lineThickness },
+         Vector2 { .x = plate.x + slant, .y = plate.y },
+      };
+      auto lineColor = Colors::toUiColor(style.get(Style::ColorType::Line));
+      triangles.addTriangleStrip(lineVertices, lineColor);
+      if (reified && detail.showsDecorations())
+      {
+         std::array<Vector2, 6> leftVertices {
+            Vector2 { .x = area.x + halfHeight + lineThickness, .y = area.y + area.height },
+            Vector2 { .x = area.x + halfHeight + (lineThickness * 2.0f) + slant, .y = area.y + area.height },
+            Vector2 { .x = area.x, .y = centerY },
+            Vector2 { .x = area.x + lineThickness + slant, .y = centerY },
+            Vector2 { .x = area.x + halfHeight + lineThickness, .y = area.y },
+            Vector2 { .x = area.x + halfHeight + (lineThickness * 2.0f) + slant, .y = area.y },
+         };
+         std::array<Vector2, 6> rightVertices {
+            Vector2 { .x = area.x + area.width - halfHeight - lineThickness, .y = area.y },
+            Vector2 { .x = area.x + area.width - halfHeight - (lineThickness * 2.0f) - slant, .y = area.y },
+            Vector2 { .x = area.x + area.width, .y = centerY },
+            Vector2 { .x = area.x + area.width - lineThickness - slant, .y = centerY },
+            Vector2 { .x = area.x + area.width - halfHeight - lineThickness, .y = area.y + area.height },
+            Vector2 { .x = area.x + area.width - halfHeight - (lineThickness * 2.0f) - slant, .y = area.y + area.height },
+         };
+         triangles.addTriangleStrip(leftVertices, lineColor);
+         triangles.addTriangleStrip(rightVertices, lineColor);
+      }
+   }
+}
+
+void BatchingMapRenderer::renderRoleLine(Identifier, Vector2 a, Vector2 b, Style const &style, float lineThickness, bool reified)
+{
+   enterLayer(Layer::Roles);
+   statistics.requestCount++;
+   {
+      // The margin includes the offset lines of reified roles.
+      float margin = lineThickness + 3.0f;
+      auto bounds = boxSpanning(a, b);
+      flushTextsCoveredBy(Rectangle {
+         .x = bounds.x - margin,
+         .y = bounds.y - margin,
+         .width = bounds.width + (margin * 2.0f),
+         .height = bounds.height + (margin * 2.0f),
+      });
+   }
+   auto color = Colors::toUiColor(style.get(Style::ColorType::Line));
+   if (!detail.showsDecorations())
+   {
+      triangles.addLine(a, color, b, color, lineThickness);
+      return;
+   }
+   auto drawLineShadedEnds = [this, lineThickness, color](Vector2 a, Vector2 b) {
+      float const shadeLength = 7.5f;
+      Vector2 centerPoint { .x = (b.x + a.x) / 2.0f, .y = (b.y + a.y) / 2.0f };
+      Vector2 centerToA = Vector2Subtract(a, centerPoint);
+      float halfLength = Vector2Length(centerToA);
+      Vector2 centerToShadeA { .x = 0.0f, .y = 0.0f };
+      uint8_t shadeAlpha = 0xFF;
+      if (halfLength >= shadeLength)
+      {
+         centerToShadeA = Vector2Scale(centerToA, (halfLength - shadeLength) / halfLength);
+      }
+      else
+      {
+         shadeAlpha = static_cast<uint8_t>(std::roundf((255.0f * halfLength) / shadeLength));
+      }
+      Vector2 shadeAPoint = Vector2Add(centerPoint, centerToShadeA);
+      Vector2 shadeBPoint = Vector2Subtract(centerPoint, centerToShadeA);
+      Color endColor { .r = color.r, .g = color.g, .b = color.b, .a = 0x00 };
+      Color shadeColor { .r = color.r, .g = color.g, .b = color.b, .a = shadeAlpha };
+
+      triangles.addLine(Vector2Add(centerPoint, centerToA), endColor, shadeAPoint, shadeColor, lineThickness);
+      triangles.addLine(Vector2Subtract(centerPoint, centerToA), endColor, shadeBPoint, shadeColor, lineThickness);
+      triangles.addLine(shadeAPoint, shadeColor, shadeBPoint, shadeColor, lineThickness);
+   };
+   drawLineShadedEnds(a, b);
+   float diffX = a.x - b.x;
+   float diffY = a.y - b.y;
+   float length = Vector2Length(Vector2 { .x = diffX, .y = diffY });
+   if ((length > 0.0001f) && reified)
+   {
+      auto drawWithOffset = [&drawLineShadedEnds, length, a, b](float offset) {
+         Vector2 shiftedA {
+            .x = a.x + offset * (b.y - a.y) / length,
+            .y = a.y + offset * (a.x - b.x) / length,
+         };
+         Vector2 shiftedB {
+            .x = b.x + offset * (b.y - a.y) / length,
+            .y = b.y + offset * (a.x - b.x) / length,
+         };
+         float diffX = shiftedB.x - shiftedA.x;
+         float diffY = shiftedB.y - shiftedA.y;
+         shiftedA.x += diffX / 3;
+         shiftedA.y += diffY / 3;
+         shiftedB.x += -diffX / 3;
+         shiftedB.y += -diffY / 3;
+         drawLineShadedEnds(shiftedA, shiftedB);
+      };
+
+      drawWithOffset(+3.0f);
+      drawWithOffset(-3.0f);
+   }
+}
+
+void BatchingMapRenderer::renderClusterGlyph(Rectangle area, Style const &style, size_t)
+{
+   enterLayer(Layer::Clusters);
+   statistics.requestCount++;
+   flushTextsCoveredBy(area);
+   triangles.addRectangle(area, Colors::toUiColor(style.get(Style::ColorType::Fill)));
+   triangles.addRectangleLines(area, area.width / 8.0f, Colors::toUiColor(style.get(Style::ColorType::Line)));
+}
+
+void BatchingMapRenderer::enterLayer(Layer layer)
+{
+   if (layer != currentLayer)
+   {
+      flush();
+      currentLayer = layer;
+   }
+}
+
+void BatchingMapRenderer::flushTextsCoveredBy(Rectangle bounds)
+{
+   // Texts are only pending while they are legible, which limits them to what fits on the screen.
+   // The common bounds of all pending texts spare the grid lookup for shapes next to them.
+   if ((pendingTextCount == 0) || !overlaps(bounds, pendingTextBounds))
+   {
+      return;
+   }
+   auto range = textCellsOf(bounds);
+   for (size_t row = range.firstRow; row <= range.lastRow; row++)
+   {
+      for (size_t column = range.firstColumn; column <= range.lastColumn; column++)
+      {
+         for (size_t index : textCells[row * TEXT_GRID_SIZE + column])
+         {
+            if (overlaps(bounds, texts[index].area))
+            {
+               flush();
+               statistics.overlapFlushCount++;
+               return;
+            }
+         }
+      }
+   }
+}
+
+void BatchingMapRenderer::addPendingTextCells(size_t index, Rectangle area)
+{
+   if (textCells.empty())
+   {
+      textCells.resize(TEXT_GRID_SIZE * TEXT_GRID_SIZE);
+   }
+   auto range = textCellsOf(area);
+   for (size_t row = range.firstRow; row <= range.lastRow; row++)
+   {
+      for (size_t column = range.firstColumn; column <= range.lastColumn; column++)
+      {
+         size_t cellIndex = row * TEXT_GRID_SIZE + column;
+         auto &cell = textCells[cellIndex];
+         if (cell.empty())
+         {
+            occupiedTextCells.emplace_back(cellIndex);
+         }
+         cell.emplace_back(index);
+      }
+   }
+}
+
+BatchingMapRenderer::TextCellRange BatchingMapRenderer::textCellsOf(Rectangle area) const
+{
+   return TextCellRange {
+      .firstColumn = textCellOf(area.x, textGridOrigin.x),
+      .lastColumn = textCellOf(area.x + area.width, textGridOrigin.x),
+      .firstRow = textCellOf(area.y, textGridOrigin.y),
+      .lastRow = textCellOf(area.y + area.height, textGridOrigin.y),
+   };
+}
+
+size_t BatchingMapRenderer::textCellOf(float value, float origin)
+{
+   // Areas beyond the grid are kept in its border cells. As texts and shapes are clamped alike,
+   // overlapping areas still share a cell - the border cells merely become less selective.
+   auto cell = std::floor((value - origin) / TEXT_CELL_SIZE);
+   return static_cast<size_t>(std::clamp(cell, 0.0f, static_cast<float>(TEXT_GRID_SIZE - 1)));
+}
+
+void BatchingMapRenderer::clearPendingTexts()
+{
+   for (size_t cellIndex : occupiedTextCells)
+   {
+      textCells[cellIndex].clear();
+   }
+   occupiedTextCells.clear();
+   pendingTextCount = 0;
+}
+
+void BatchingMapRenderer::submitTriangles()
+{
+   auto const &positions = triangles.getPositions();
+   auto const &colors = triangles.getColors();
+   for (size_t start = 0; start < positions.size(); start += VERTICES_PER_SUBMISSION)
+   {
+      size_t end = std::min(start + VERTICES_PER_SUBMISSION, positions.size());
+      static_cast<void>(rlCheckRenderBatchLimit(static_cast<int>(end - start)));
+      rlBegin(RL_TRIANGLES);
+      for (size_t index = start; index < end; index++)
+      {
+         Color const &color = colors[index];
+         rlColor4ub(color.r, color.g, color.b, color.a);
+         rlVertex2f(positions[index].x, positions[index].y);
+      }
+      rlEnd();
+      statistics.drawCallCount++;
+   }
+   statistics.vertexCount += positions.size();
+   triangles.clear();
+}
+
+void BatchingMapRenderer::submitTexts()
+{
+   for (size_t index = 0; index < pendingTextCount; index++)
+   {
+      auto const &pending = texts[index];
+      DrawTextEx(pending.font, pending.text.c_str(), pending.position, pending.fontSize, pending.spacing, pending.color);
+      statistics.drawCallCount++;
+   }
+   clearPendingTexts();
+}
@@ -1,4 +1,5 @@
 #include "contomap/frontend/EditBuffer.h"
+#include "contomap/infrastructure/Trace.h"
 #include "contomap/infrastructure/serial/BinaryDecoder.h"
 #include "contomap/infrastructure/serial/BinaryEncoder.h"
 
@@ -13,6 +14,8 @@ using contomap::model::SpacialCoordinate;
 using contomap::model::Style;
 using contomap::model::TopicNameValue;
 
+char const *const EditBuffer::MemoryTag::NAME = "undoHistory";
+
 EditBuffer::Recorder::Recorder(EditBuffer &buffer)
    : buffer(buffer)
    , oldCameraPosition(buffer.camera.getCurrentPosition())
@@ -48,6 +51,7 @@ void EditBuffer::undo()
    if (nested.loadState(decoder))
    {
       operationIndex--;
+      revision++;
       camera.panTo(lastOperation.oldCameraPosition);
    }
 }
@@ -68,10 +72,16 @@ void EditBuffer::redo()
    if (nested.loadState(decoder))
    {
       operationIndex++;
+      revision++;
       camera.panTo(nextOperation.newCameraPosition);
    }
 }
 
+size_t EditBuffer::getRevision() const
+{
+   return revision;
+}
+
 void EditBuffer::reset()
 {
    operations.clear();
@@ -82,16 +92,19 @@ void EditBuffer::reset()
 
 void EditBuffer::recordOperation(Vector2 oldCameraPosition)
 {
+   CONTOMAP_TRACE_ZONE("EditBuffer::recordOperation");
    Operation operation;
    BinaryEncoder encoder;
    nested.saveState(encoder, true);
    operation.oldCameraPosition = oldCameraPosition;
-   operation.stateData = encoder.getData();
+   auto const &data = encoder.getData();
+   operation.stateData.assign(data.begin(), data.end());
    operation.newCameraPosition = camera.getCurrentPosition();
    if ((operationIndex > 0) && (operations[operationIndex - 1].stateData == operation.stateData))
    {
       return;
    }
+   revision++;
    if (operationIndex == operations.size())
    {
       operations.emplace_back(std::move(operation));
@@ -164,6 +177,11 @@ void EditBuffer::modifySelection(contomap::editor::SelectedType type, Identifier
    nested.modifySelection(type, id, action);
 }
 
+void EditBuffer::modifySelection(contomap::editor::Selection const &items, contomap::editor::SelectionAction action)
+{
+   nested.modifySelection(items, action);
+}
+
 void EditBuffer::linkSelection()
 {
    Recorder rec(*this);
@@ -278,6 +296,13 @@ void EditBuffer::selectClosestOccurrenceOf(Identifier topicId)
    nested.selectClosestOccurrenceOf(topicId);
 }
 
+void EditBuffer::performBatch(BatchOperations const &batch)
+{
+   Recorder rec(*this);
+   // The nested handler rolls back to its exact state, as changes of the selection are not recorded here.
+   nested.performBatch(batch);
+}
+
 void EditBuffer::saveState(contomap::infrastructure::serial::Encoder &encoder, bool withSelection)
 {
    nested.saveState(encoder, withSelection);
@@ -12,20 +12,20 @@ Focus::Focus()
 {
 }
 
-void Focus::registerItem(std::shared_ptr<FocusItem> newItem, float newDistance)
+void Focus::registerItem(FocusItem newItem, float newDistance)
 {
    if (newDistance < distance)
    {
-      item = std::move(newItem);
+      item = newItem;
       distance = newDistance;
    }
 }
 
 void Focus::modifySelection(InputRequestHandler &handler, SelectionAction action) const
 {
-   if (item != nullptr)
+   if (item.has_value())
    {
-      item->modifySelection(handler, action);
+      handler.modifySelection(item->type, item->id, action);
    }
    else
    {
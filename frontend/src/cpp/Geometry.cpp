@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <array>
+#include <cmath>
 
 #include <raylib.h>
 
@@ -49,3 +50,19 @@ Vector2 contomap::frontend::geometry::centerOf(Rectangle area)
 {
    return Vector2 { .x = area.x + (area.width / 2.0f), .y = area.y + (area.height / 2.0f) };
 }
+
+Rectangle contomap::frontend::geometry::boxSpanning(Vector2 a, Vector2 b)
+{
+   return Rectangle { .x = std::min(a.x, b.x), .y = std::min(a.y, b.y), .width = std::abs(a.x - b.x), .height = std::abs(a.y - b.y) };
+}
+
+bool contomap::frontend::geometry::overlaps(Rectangle a, Rectangle b)
+{
+   return (a.x < (b.x + b.width)) && (b.x < (a.x + a.width)) && (a.y < (b.y + b.height)) && (b.y < (a.y + a.height));
+}
+
+bool contomap::frontend::geometry::encloses(Rectangle outer, Rectangle inner)
+{
+   return (outer.x <= inner.x) && ((inner.x + inner.width) <= (outer.x + outer.width)) && (outer.y <= inner.y)
+      && ((inner.y + inner.height) <= (outer.y + outer.height));
+}
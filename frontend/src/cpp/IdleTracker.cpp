@@ -0,0 +1,22 @@
+#include "contomap/frontend/IdleTracker.h"
+
+using contomap::frontend::IdleTracker;
+
+size_t const IdleTracker::SETTLING_FRAME_COUNT = 3;
+
+void IdleTracker::frameDone(bool changed)
+{
+   if (changed || isIdle())
+   {
+      quietFrameCount = 0;
+   }
+   else
+   {
+      quietFrameCount++;
+   }
+}
+
+bool IdleTracker::isIdle() const
+{
+   return quietFrameCount >= SETTLING_FRAME_COUNT;
+}
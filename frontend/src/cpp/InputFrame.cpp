@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <optional>
+
+#include "contomap/frontend/InputFrame.h"
+#include "contomap/frontend/RenderContext.h"
+
+using contomap::frontend::FrameTime;
+using contomap::frontend::InputFrame;
+using contomap::frontend::RenderContext;
+using contomap::infrastructure::serial::Coder;
+using contomap::infrastructure::serial::Decoder;
+using contomap::infrastructure::serial::Encoder;
+
+namespace
+{
+
+// The order defines the serialized form. New keys must be appended.
+std::array<int, 18> const OBSERVED_KEYS {
+   KEY_LEFT,
+   KEY_UP,
+   KEY_RIGHT,
+   KEY_DOWN,
+   KEY_HOME,
+   KEY_LEFT_CONTROL,
+   KEY_RIGHT_CONTROL,
+   KEY_LEFT_SHIFT,
+   KEY_INSERT,
+   KEY_I,
+   KEY_T,
+   KEY_L,
+   KEY_DELETE,
+   KEY_S,
+   KEY_F3,
+   KEY_F4,
+   KEY_F5,
+   KEY_ESCAPE,
+};
+
+uint8_t const FLAG_DOWN = 0x01;
+uint8_t const FLAG_PRESSED = 0x02;
+uint8_t const FLAG_RELEASED = 0x04;
+
+std::optional<size_t> indexOf(int key)
+{
+   auto it = std::find(OBSERVED_KEYS.begin(), OBSERVED_KEYS.end(), key);
+   if (it == OBSERVED_KEYS.end())
+   {
+      return {};
+   }
+   return static_cast<size_t>(std::distance(OBSERVED_KEYS.begin(), it));
+}
+
+void setFlag(uint32_t &mask, size_t index, bool value)
+{
+   uint32_t bit = static_cast<uint32_t>(1) << index;
+   mask = value ? (mask | bit) : (mask & ~bit);
+}
+
+uint8_t flagIf(bool condition, uint8_t flag)
+{
+   return condition ? flag : static_cast<uint8_t>(0x00);
+}
+
+}
+
+InputFrame::InputFrame(float frameSeconds)
+   : frameSeconds(frameSeconds)
+{
+}
+
+InputFrame InputFrame::fromCurrentState()
+{
+   InputFrame frame(FrameTime::fromLastFrame().rawSeconds());
+   frame.contentSize = RenderContext::fromCurrentState().getContentSize();
+   frame.mousePosition = GetMousePosition();
+   frame.mouseWheelMove = GetMouseWheelMove();
+   frame.mouseButtonPressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+   frame.mouseButtonDown = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+   for (size_t index = 0; index < OBSERVED_KEYS.size(); index++)
+   {
+      int key = OBSERVED_KEYS[index];
+      setFlag(frame.keysDown, index, IsKeyDown(key));
+      setFlag(frame.keysPressed, index, IsKeyPressed(key));
+      setFlag(frame.keysReleased, index, IsKeyReleased(key));
+   }
+   return frame;
+}
+
+InputFrame InputFrame::idleFor(FrameTime frameTime)
+{
+   return InputFrame(frameTime.rawSeconds());
+}
+
+InputFrame InputFrame::from(Decoder &coder, std::string const &name, uint8_t)
+{
+   Coder::Scope scope(coder, name);
+   float frameSeconds = 0.0f;
+   coder.code("frameTime", frameSeconds);
+   InputFrame frame(FrameTime::fromSeconds(frameSeconds).rawSeconds());
+   coder.code("contentWidth", frame.contentSize.x);
+   coder.code("contentHeight", frame.contentSize.y);
+   coder.code("mouseX", frame.mousePosition.x);
+   coder.code("mouseY", frame.mousePosition.y);
+   coder.code("wheel", frame.mouseWheelMove);
+   uint8_t buttonFlags = 0x00;
+   coder.code("button", buttonFlags);
+   frame.mouseButtonDown = (buttonFlags & FLAG_DOWN) != 0;
+   frame.mouseButtonPressed = (buttonFlags & FLAG_PRESSED) != 0;
+   coder.codeArray("keys", [&frame](Decoder &nested, size_t index) {
+      uint8_t keyFlags = 0x00;
+      nested.code("", keyFlags);
+      if (index < OBSERVED_KEYS.size())
+      {
+         setFlag(frame.keysDown, index, (keyFlags & FLAG_DOWN) != 0);
+         setFlag(frame.keysPressed, index, (keyFlags & FLAG_PRESSED) != 0);
+         setFlag(frame.keysReleased, index, (keyFlags & FLAG_RELEASED) != 0);
+      }
+   });
+   return frame;
+}
+
+bool InputFrame::isObserved(int key)
+{
+   return indexOf(key).has_value();
+}
+
+void InputFrame::encode(Encoder &coder, std::string const &name) const
+{
+   Coder::Scope scope(coder, name);
+   coder.code("frameTime", frameSeconds);
+   coder.code("contentWidth", contentSize.x);
+   coder.code("contentHeight", contentSize.y);
+   coder.code("mouseX", mousePosition.x);
+   coder.code("mouseY", mousePosition.y);
+   coder.code("wheel", mouseWheelMove);
+   auto buttonFlags = static_cast<uint8_t>(flagIf(mouseButtonDown, FLAG_DOWN) | flagIf(mouseButtonPressed, FLAG_PRESSED));
+   coder.code("button", buttonFlags);
+   coder.codeArray("keys", OBSERVED_KEYS.begin(), OBSERVED_KEYS.end(), [this](Encoder &nested, int key) {
+      auto keyFlags
+         = static_cast<uint8_t>(flagIf(isKeyDown(key), FLAG_DOWN) | flagIf(isKeyPressed(key), FLAG_PRESSED) | flagIf(isKeyReleased(key), FLAG_RELEASED));
+      nested.code("", keyFlags);
+   });
+}
+
+InputFrame InputFrame::withContentSize(Vector2 size) const
+{
+   InputFrame frame(*this);
+   frame.contentSize = size;
+   return frame;
+}
+
+InputFrame InputFrame::withMouse(Vector2 position, bool buttonDown, bool buttonPressed) const
+{
+   InputFrame frame(*this);
+   frame.mousePosition = position;
+   frame.mouseButtonDown = buttonDown;
+   frame.mouseButtonPressed = buttonPressed;
+   return frame;
+}
+
+InputFrame InputFrame::withMouseWheelMove(float move) const
+{
+   InputFrame frame(*this);
+   frame.mouseWheelMove = move;
+   return frame;
+}
+
+InputFrame InputFrame::withKey(int key, bool down, bool pressed, bool released) const
+{
+   InputFrame frame(*this);
+   auto index = indexOf(key);
+   if (index.has_value())
+   {
+      setFlag(frame.keysDown, index.value(), down);
+      setFlag(frame.keysPressed, index.value(), pressed);
+      setFlag(frame.keysReleased, index.value(), released);
+   }
+   return frame;
+}
+
+FrameTime InputFrame::getFrameTime() const
+{
+   return FrameTime::fromSeconds(frameSeconds);
+}
+
+Vector2 InputFrame::getContentSize() const
+{
+   return contentSize;
+}
+
+Vector2 InputFrame::getMousePosition() const
+{
+   return mousePosition;
+}
+
+float InputFrame::getMouseWheelMove() const
+{
+   return mouseWheelMove;
+}
+
+bool InputFrame::isMouseButtonPressed() const
+{
+   return mouseButtonPressed;
+}
+
+bool InputFrame::isMouseButtonDown() const
+{
+   return mouseButtonDown;
+}
+
+bool InputFrame::isKeyDown(int key) const
+{
+   return hasKeyFlag(key, keysDown);
+}
+
+bool InputFrame::isKeyPressed(int key) const
+{
+   return hasKeyFlag(key, keysPressed);
+}
+
+bool InputFrame::isKeyReleased(int key) const
+{
+   return hasKeyFlag(key, keysReleased);
+}
+
+bool InputFrame::hasKeyFlag(int key, uint32_t mask)
+{
+   auto index = indexOf(key);
+   return index.has_value() && ((mask & (static_cast<uint32_t>(1) << index.value())) != 0);
+}
@@ -0,0 +1,70 @@
+#include <array>
+#include <exception>
+
+#include "contomap/frontend/InputRecording.h"
+
+using contomap::frontend::InputFrame;
+using contomap::frontend::InputRecording;
+using contomap::infrastructure::serial::Decoder;
+using contomap::infrastructure::serial::Encoder;
+
+uint8_t const InputRecording::CURRENT_SERIAL_VERSION = 0x01;
+
+InputRecording::InputRecording(uint32_t identifierSeed)
+   : identifierSeed(identifierSeed)
+{
+}
+
+uint32_t InputRecording::getIdentifierSeed() const
+{
+   return identifierSeed;
+}
+
+void InputRecording::add(InputFrame const &frame)
+{
+   frames.emplace_back(frame);
+}
+
+std::vector<InputFrame> const &InputRecording::getFrames() const
+{
+   return frames;
+}
+
+void InputRecording::encode(Encoder &coder) const
+{
+   coder.code("version", CURRENT_SERIAL_VERSION);
+   std::array<uint8_t, 4> seedBytes {};
+   for (size_t index = 0; index < seedBytes.size(); index++)
+   {
+      seedBytes[index] = static_cast<uint8_t>(identifierSeed >> (index * 8));
+   }
+   coder.codeArray("identifierSeed", seedBytes.begin(), seedBytes.end(), [](Encoder &nested, uint8_t value) { nested.code("", value); });
+   coder.codeArray("frames", frames.begin(), frames.end(), [](Encoder &nested, InputFrame const &frame) { frame.encode(nested, ""); });
+}
+
+bool InputRecording::decode(Decoder &coder)
+{
+   identifierSeed = 0;
+   frames.clear();
+   try
+   {
+      uint8_t version = 0x00;
+      coder.code("version", version);
+      if (version != CURRENT_SERIAL_VERSION)
+      {
+         return false;
+      }
+      coder.codeArray("identifierSeed", [this](Decoder &nested, size_t index) {
+         uint8_t value = 0x00;
+         nested.code("", value);
+         identifierSeed |= static_cast<uint32_t>(value) << ((index % 4) * 8);
+      });
+      coder.codeArray("frames", [this, version](Decoder &nested, size_t) { frames.emplace_back(InputFrame::from(nested, "", version)); });
+   }
+   catch (std::exception &)
+   {
+      frames.clear();
+      return false;
+   }
+   return true;
+}
@@ -0,0 +1,52 @@
+#include <raylib.h>
+
+#include "contomap/frontend/LevelOfDetail.h"
+
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::MapCamera;
+
+LevelOfDetail::LevelOfDetail(float scale)
+   : scale(scale)
+{
+}
+
+LevelOfDetail LevelOfDetail::full()
+{
+   return forZoomFactor(MapCamera::ZoomFactor::NEAR_LIMIT);
+}
+
+LevelOfDetail LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor zoomFactor)
+{
+   return LevelOfDetail(zoomFactor.raw());
+}
+
+bool LevelOfDetail::showsTextOfSize(float fontSize) const
+{
+   return (fontSize * scale) >= MIN_TEXT_PIXEL_SIZE;
+}
+
+bool LevelOfDetail::showsDecorations() const
+{
+   return scale >= MIN_DECORATION_SCALE;
+}
+
+bool LevelOfDetail::aggregatesIntoClusters() const
+{
+   return scale < MAX_CLUSTER_SCALE;
+}
+
+float LevelOfDetail::clusterCellSize() const
+{
+   return CLUSTER_CELL_PIXEL_SIZE / scale;
+}
+
+Vector2 LevelOfDetail::measureText(Font font, std::string const &text, float fontSize, float spacing) const
+{
+   if (showsTextOfSize(fontSize))
+   {
+      return MeasureTextEx(font, text.c_str(), fontSize, spacing);
+   }
+   auto glyphCount = static_cast<float>(text.size());
+   float gapCount = (glyphCount > 0.0f) ? (glyphCount - 1.0f) : 0.0f;
+   return Vector2 { .x = (glyphCount * fontSize * ESTIMATED_GLYPH_WIDTH_RATIO) + (gapCount * spacing), .y = fontSize };
+}
@@ -2,7 +2,6 @@
 
 #include "contomap/frontend/LocateTopicAndActDialog.h"
 #include "contomap/frontend/Names.h"
-#include "contomap/model/Topics.h"
 
 using contomap::editor::InputRequestHandler;
 using contomap::frontend::LocateTopicAndActDialog;
@@ -14,7 +13,6 @@ using contomap::model::SpacialCoordinate;
 using contomap::model::Topic;
 using contomap::model::TopicName;
 using contomap::model::TopicNameValue;
-using contomap::model::Topics;
 
 LocateTopicAndActDialog::TopicList::TopicList(ContomapView const &view)
    : view(view)
@@ -51,7 +49,24 @@ void LocateTopicAndActDialog::TopicList::reset()
    focusedTopicId.reset();
 }
 
-std::optional<Identifier> LocateTopicAndActDialog::TopicList::draw(Rectangle bounds, contomap::infrastructure::Search<contomap::model::Topic const> topics)
+void LocateTopicAndActDialog::TopicList::setTopics(std::vector<Identifier> const &topicIds)
+{
+   entries.clear();
+   for (auto const &topicId : topicIds)
+   {
+      auto topic = view.findTopic(topicId);
+      if (!topic.has_value())
+      {
+         continue;
+      }
+      for (auto const &name : Names::forDisplay(topic.value(), view.getDefaultScope()))
+      {
+         entries.emplace_back(topicId, name);
+      }
+   }
+}
+
+std::optional<Identifier> LocateTopicAndActDialog::TopicList::draw(Rectangle bounds)
 {
    Rectangle itemBounds = {
       .x = bounds.x + guiStyleFloat(LISTVIEW, LIST_ITEMS_SPACING),
@@ -64,16 +79,12 @@ std::optional<Identifier> LocateTopicAndActDialog::TopicList::draw(Rectangle bou
    guiDrawRectangle(
       bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, 0)), 1.0f), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
 
-   size_t nameIndex = 0;
-   size_t totalCount = 0;
+   size_t totalCount = entries.size();
    auto visibleCount = static_cast<size_t>(bounds.height / itemIntervalHeight);
    Vector2 mousePoint = GetMousePosition();
 
-   // This implementation of iterating over the topics and their names immediately draws the entries.
-   // This has the following properties:
-   // - no intermediate memory needed - regardless of how big the search is.
-   // - sorting is not possible, since the full set is not clear. (likewise: no scroll bar possible)
-   // - it depends on a stable iteration order over time. Should maps in model be reordered, this would jump around.
+   // The entries are prepared once per search result, already ranked by relevance.
+   // Drawing only needs to consider the visible ones.
 
    if (IsKeyReleased(KEY_UP))
    {
@@ -84,57 +95,48 @@ std::optional<Identifier> LocateTopicAndActDialog::TopicList::draw(Rectangle bou
       offsetSelection(SelectionOffset::Next, visibleCount);
    }
 
+   if (!selectedIndex.has_value() && (totalCount > 0))
+   {
+      selectedIndex = 0;
+   }
+   if (!selectedTopicId.has_value() && selectedIndex.has_value() && (selectedIndex.value() < totalCount))
+   {
+      selectedTopicId = entries[selectedIndex.value()].first;
+   }
    auto currentlySelectedTopicId = selectedTopicId;
 
    bool somethingFocused = false;
-   for (Topic const &topic : topics)
+   for (size_t entryIndex = scrollIndex; entryIndex < totalCount; entryIndex++)
    {
-      for (std::string const &name : Names::forDisplay(topic, view.getDefaultScope()))
+      if (bool isBeyondVisibleArea = (itemBounds.y + itemBounds.height) > (bounds.y + bounds.height); isBeyondVisibleArea)
       {
-         if (!selectedIndex.has_value())
-         {
-            selectedIndex = totalCount;
-         }
-         totalCount++;
-         if (!selectedTopicId.has_value() && (selectedIndex.value() == nameIndex))
-         {
-            selectedTopicId = topic.getId();
-         }
-         if (bool isNotYetVisible = nameIndex < scrollIndex; isNotYetVisible)
-         {
-            nameIndex++;
-            continue;
-         }
-         nameIndex++;
-         if (bool isBeyondVisibleArea = (itemBounds.y + itemBounds.height) > (bounds.y + bounds.height); isBeyondVisibleArea)
-         {
-            continue;
-         }
+         break;
+      }
+      auto const &[topicId, name] = entries[entryIndex];
 
-         if (CheckCollisionPointRec(mousePoint, itemBounds))
-         {
-            focusedTopicId = topic.getId();
-            somethingFocused = true;
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
-            {
-               selectedIndex = nameIndex;
-               selectedTopicId = topic.getId();
-            }
-         }
-         if (currentlySelectedTopicId == topic.getId())
-         {
-            guiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), 1.0f),
-               Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)), 1.0f));
-         }
-         else if (focusedTopicId == topic.getId())
+      if (CheckCollisionPointRec(mousePoint, itemBounds))
+      {
+         focusedTopicId = topicId;
+         somethingFocused = true;
+         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
          {
-            guiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), 1.0f),
-               Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)), 1.0f));
+            selectedIndex = entryIndex;
+            selectedTopicId = topicId;
          }
-         GuiLabel(itemBounds, name.c_str());
-
-         itemBounds.y += itemIntervalHeight;
       }
+      if (currentlySelectedTopicId == topicId)
+      {
+         guiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), 1.0f),
+            Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)), 1.0f));
+      }
+      else if (focusedTopicId == topicId)
+      {
+         guiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), 1.0f),
+            Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)), 1.0f));
+      }
+      GuiLabel(itemBounds, name.c_str());
+
+      itemBounds.y += itemIntervalHeight;
    }
    if (!somethingFocused)
    {
@@ -283,7 +285,14 @@ bool LocateTopicAndActDialog::draw(RenderContext const &context)
    };
    listBounds.height -= listBounds.y;
 
-   auto selectedTopicId = topicList.draw(listBounds, view.find(Topics::withANameLike(searchInput.data())));
+   std::string searchValue(searchInput.data());
+   auto const &nameIndex = view.getTopicNameIndex();
+   if (!searchResult.has_value() || (searchResult->getRevision() != nameIndex.getRevision()) || (searchResult->getSearchValue() != searchValue))
+   {
+      searchResult = searchResult.has_value() ? nameIndex.find(searchValue, searchResult.value()) : nameIndex.find(searchValue);
+      topicList.setTopics(searchResult->getTopics());
+   }
+   auto selectedTopicId = topicList.draw(listBounds);
    std::optional<TopicNameValue> enteredName;
    auto enteredText = TopicNameValue::from(std::string(searchInput.data()));
    if (std::holds_alternative<TopicNameValue>(enteredText))
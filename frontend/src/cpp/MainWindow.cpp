@@ -1,5 +1,6 @@
+#include <algorithm>
 #include <cmath>
-#include <memory.h>
+#include <fstream>
 #include <sstream>
 
 #pragma GCC diagnostic push
@@ -8,58 +9,58 @@
 #include <raymath.h>
 #pragma GCC diagnostic pop
 #include <raygui/raygui.h>
-#include <rpng/rpng.h>
 
 #include "contomap/editor/Selections.h"
-#include "contomap/editor/Styles.h"
-#include "contomap/frontend/Colors.h"
-#include "contomap/frontend/DirectMapRenderer.h"
-#include "contomap/frontend/FocusInterceptor.h"
+#include "contomap/frontend/BatchingMapRenderer.h"
 #include "contomap/frontend/Geometry.h"
 #include "contomap/frontend/HelpDialog.h"
 #include "contomap/frontend/LoadDialog.h"
 #include "contomap/frontend/LocateTopicAndActDialog.h"
 #include "contomap/frontend/MainWindow.h"
+#include "contomap/frontend/MapClusters.h"
+#include "contomap/frontend/MapFile.h"
+#include "contomap/frontend/MapRenderCounter.h"
 #include "contomap/frontend/MapRenderList.h"
 #include "contomap/frontend/MapRenderMeasurer.h"
+#include "contomap/frontend/MapRenderWalk.h"
 #include "contomap/frontend/Names.h"
+#include "contomap/frontend/OffsetMapRenderer.h"
 #include "contomap/frontend/RenameTopicDialog.h"
 #include "contomap/frontend/SaveAsDialog.h"
 #include "contomap/frontend/StyleDialog.h"
+#include "contomap/infrastructure/Trace.h"
 #include "contomap/infrastructure/serial/BinaryDecoder.h"
 #include "contomap/infrastructure/serial/BinaryEncoder.h"
-#include "contomap/model/Associations.h"
-#include "contomap/model/Topics.h"
 
 using contomap::editor::InputRequestHandler;
 using contomap::editor::SelectedType;
 using contomap::editor::SelectionAction;
 using contomap::editor::Selections;
-using contomap::editor::Styles;
-using contomap::frontend::Colors;
-using contomap::frontend::DirectMapRenderer;
-using contomap::frontend::FocusInterceptor;
+using contomap::frontend::BatchingMapRenderer;
+using contomap::frontend::InputFrame;
+using contomap::frontend::LevelOfDetail;
 using contomap::frontend::LocateTopicAndActDialog;
 using contomap::frontend::MainWindow;
 using contomap::frontend::MapCamera;
-using contomap::frontend::MapRenderer;
+using contomap::frontend::MapClusters;
+using contomap::frontend::MapFile;
+using contomap::frontend::MapRenderList;
+using contomap::frontend::MapRenderWalk;
 using contomap::frontend::Names;
+using contomap::frontend::OffsetMapRenderer;
 using contomap::frontend::RenameTopicDialog;
 using contomap::frontend::RenderContext;
-using contomap::frontend::geometry::centerOf;
-using contomap::frontend::geometry::intersectLineIntoBoxCenter;
-using contomap::model::Association;
-using contomap::model::Associations;
+using contomap::frontend::geometry::boxSpanning;
+using contomap::infrastructure::InternedString;
+using contomap::infrastructure::MemoryAccount;
+using contomap::infrastructure::Profiler;
+using contomap::infrastructure::TaskScheduler;
+using contomap::model::CoordinateTable;
 using contomap::model::Identifier;
-using contomap::model::Identifiers;
-using contomap::model::Occurrence;
-using contomap::model::Role;
 using contomap::model::SpacialCoordinate;
-using contomap::model::Style;
 using contomap::model::Topic;
 using contomap::model::TopicName;
 using contomap::model::TopicNameValue;
-using contomap::model::Topics;
 
 MainWindow::LengthInPixel::LengthInPixel(MainWindow::LengthInPixel::ValueType value)
    : value(value)
@@ -94,16 +95,37 @@ MainWindow::LengthInPixel MainWindow::Size::getHeight() const
 
 MainWindow::Size const MainWindow::DEFAULT_SIZE = MainWindow::Size::ofPixel(1280, 720);
 char const MainWindow::DEFAULT_TITLE[] = "contomap";
-// According to http://www.libpng.org/pub/png/spec/1.2/PNG-Structure.html#Chunk-naming-conventions ,
-// the chunk type is ancillary (lower), private (lower), conforming (upper), safe-to-copy (lower).
-std::array<char, 5> const MainWindow::PNG_MAP_TYPE { 'c', 'm', 'P', 'm', 0x00 };
+char const MainWindow::PROFILE_FILE_NAME[] = "contomap-profile.csv";
+char const MainWindow::TRACE_FILE_NAME[] = "contomap-trace.json";
+float const MainWindow::MIN_SELECTION_BOX_PIXEL_SIZE = 4.0f;
+
+MainWindow::ProfiledSeries::ProfiledSeries(Profiler &profiler)
+   : frame(profiler.series("frame", Profiler::Unit::Milliseconds))
+   , processInput(profiler.series("processInput", Profiler::Unit::Milliseconds))
+   , renderMap(profiler.series("renderMap", Profiler::Unit::Milliseconds))
+   , optimize(profiler.series("optimize", Profiler::Unit::Milliseconds))
+   , renderToHitIndex(profiler.series("renderTo(hitIndex)", Profiler::Unit::Milliseconds))
+   , renderToScreen(profiler.series("renderTo(screen)", Profiler::Unit::Milliseconds))
+   , drawUserInterface(profiler.series("drawUserInterface", Profiler::Unit::Milliseconds))
+   , load(profiler.series("load", Profiler::Unit::Milliseconds))
+   , save(profiler.series("save", Profiler::Unit::Milliseconds))
+   , visibleTopics(profiler.series("visibleTopics", Profiler::Unit::Count))
+   , visibleOccurrences(profiler.series("visibleOccurrences", Profiler::Unit::Count))
+   , visibleRoles(profiler.series("visibleRoles", Profiler::Unit::Count))
+   , drawCommands(profiler.series("drawCommands", Profiler::Unit::Count))
+{
+}
 
 MainWindow::MainWindow(DisplayEnvironment &environment, contomap::editor::View &view, contomap::editor::InputRequestHandler &inputRequestHandler)
    : mapCamera(std::make_shared<MapCamera::SmoothGearbox>())
    , environment(environment)
    , view(view)
    , editBuffer(inputRequestHandler, mapCamera)
+   , mapRenderer(LevelOfDetail::full())
+   , renderScheduler(TaskScheduler::defaultWorkerCount())
+   , renderWalk(view, renderScheduler)
    , selectionDrawOffset(SpacialCoordinate::Offset::of(0.0f, 0.0f))
+   , profiled(profiler)
 {
    mouseHandler = [this](MouseInput const &input) { handleMouseIdle(input); };
 }
@@ -126,31 +148,70 @@ void MainWindow::closeRequested()
 
 void MainWindow::nextFrame()
 {
-   updateState();
+   processFrame(InputFrame::fromCurrentState(), true);
+}
 
-   BeginDrawing();
+void MainWindow::nextFrame(InputFrame const &input)
+{
+   // Only the drawing depends on the actual window size; processing the input relies on the size of the frame alone.
+   auto size = input.getContentSize();
+   auto width = static_cast<int>(std::lround(size.x));
+   auto height = static_cast<int>(std::lround(size.y));
+   if ((width > 0) && (height > 0) && ((width != GetScreenWidth()) || (height != GetScreenHeight())))
+   {
+      SetWindowSize(width, height);
+   }
+   processFrame(input, false);
+}
+
+void MainWindow::processFrame(InputFrame const &input, bool mayWaitForEvents)
+{
+   CONTOMAP_TRACE_ZONE("MainWindow::nextFrame");
+   updateState(input);
 
-   drawBackground();
+   BeginDrawing();
 
-   auto renderContext = RenderContext::fromCurrentState();
+   // The size is taken from the input, so that replayed frames are processed as they were recorded.
+   auto renderContext = RenderContext::withContentSize(input.getContentSize());
    {
-      auto contentSize = renderContext.getContentSize();
-      auto projection = mapCamera.beginProjection(contentSize);
-      auto currentMousePos = GetMousePosition();
-      auto focusCoordinate = projection.unproject(currentMousePos);
-      auto lastFocusCoordinate = lastMousePos.has_value() ? projection.unproject(lastMousePos.value()) : focusCoordinate;
-      lastMousePos = currentMousePos;
+      Profiler::Timer frameTimer(profiler, profiled.frame);
+      drawBackground();
+      {
+         auto contentSize = renderContext.getContentSize();
+         auto projection = mapCamera.beginProjection(contentSize);
+         auto currentMousePos = input.getMousePosition();
+         auto focusCoordinate = projection.unproject(currentMousePos);
+         auto lastFocusCoordinate = lastMousePos.has_value() ? projection.unproject(lastMousePos.value()) : focusCoordinate;
+         lastMousePos = currentMousePos;
 
-      processInput(renderContext, focusCoordinate, Vector2Subtract(focusCoordinate, lastFocusCoordinate));
+         {
+            Profiler::Timer timer(profiler, profiled.processInput);
+            processInput(renderContext, input, focusCoordinate, Vector2Subtract(focusCoordinate, lastFocusCoordinate));
+         }
 
-      drawMap(focusCoordinate);
+         auto topLeft = projection.unproject(Vector2 { .x = 0.0f, .y = 0.0f });
+         auto bottomRight = projection.unproject(contentSize);
+         drawMap(focusCoordinate, boxSpanning(topLeft, bottomRight));
+      }
+      Profiler::Timer userInterfaceTimer(profiler, profiled.drawUserInterface);
+      drawUserInterface(renderContext);
+   }
+   if (profiler.isEnabled())
+   {
+      sampleMemory();
    }
-   drawUserInterface(renderContext);
+   else
+   {
+      // Sampling starts anew once the profiler is enabled, so that allocations while it was off do not show up as a spike.
+      accountedMemory.clear();
+   }
+   drawProfilerOverlay(renderContext);
 
+   trackActivity(mayWaitForEvents);
    EndDrawing();
 }
 
-void MainWindow::processInput(RenderContext const &context, Vector2, Vector2 focusDelta)
+void MainWindow::processInput(RenderContext const &context, InputFrame const &frame, Vector2 focusCoordinate, Vector2 focusDelta)
 {
    if (currentDialog != nullptr)
    {
@@ -159,32 +220,32 @@ void MainWindow::processInput(RenderContext const &context, Vector2, Vector2 foc
 
    // TODO: probably needs some better checks here -> hotkey system
    // TODO: consider pinch zoom as well?
-   if (GetMouseWheelMove() > 0.0f)
+   if (frame.getMouseWheelMove() > 0.0f)
    {
       mapCamera.zoom(doubledRelative(true));
    }
-   else if (GetMouseWheelMove() < 0.0f)
+   else if (frame.getMouseWheelMove() < 0.0f)
    {
       mapCamera.zoom(doubledRelative(false));
    }
 
-   bool panLeft = IsKeyDown(KEY_LEFT);
-   bool panUp = IsKeyDown(KEY_UP);
-   bool panRight = IsKeyDown(KEY_RIGHT);
-   bool panDown = IsKeyDown(KEY_DOWN);
+   bool panLeft = frame.isKeyDown(KEY_LEFT);
+   bool panUp = frame.isKeyDown(KEY_UP);
+   bool panRight = frame.isKeyDown(KEY_RIGHT);
+   bool panDown = frame.isKeyDown(KEY_DOWN);
    mapCamera.pan(panLeft, panUp, panRight, panDown);
 
-   if (IsKeyPressed(KEY_HOME))
+   if (frame.isKeyPressed(KEY_HOME))
    {
-      if (IsKeyDown(KEY_LEFT_CONTROL))
+      if (frame.isKeyDown(KEY_LEFT_CONTROL))
       {
          editBuffer.setViewScopeToDefault();
       }
       mapCamera.panTo(MapCamera::HOME_POSITION);
    }
 
-   bool isInsertOperation = IsKeyReleased(KEY_INSERT) || IsKeyReleased(KEY_I);
-   bool isAssociationContext = IsKeyDown(KEY_LEFT_SHIFT);
+   bool isInsertOperation = frame.isKeyReleased(KEY_INSERT) || frame.isKeyReleased(KEY_I);
+   bool isAssociationContext = frame.isKeyDown(KEY_LEFT_SHIFT);
    if (isInsertOperation)
    {
       if (isAssociationContext)
@@ -196,45 +257,86 @@ void MainWindow::processInput(RenderContext const &context, Vector2, Vector2 foc
          openNewTopicDialog();
       }
    }
-   if (IsKeyReleased(KEY_T))
+   if (frame.isKeyReleased(KEY_T))
    {
       openNewLocateTopicAndActDialog();
    }
 
-   if (IsKeyReleased(KEY_L))
+   if (frame.isKeyReleased(KEY_L))
    {
       editBuffer.linkSelection();
    }
 
-   if (IsKeyReleased(KEY_DELETE))
+   if (frame.isKeyReleased(KEY_DELETE))
    {
       editBuffer.deleteSelection();
    }
 
-   if (IsKeyPressed(KEY_S) && (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)))
+   if (frame.isKeyPressed(KEY_S) && (frame.isKeyDown(KEY_LEFT_CONTROL) || frame.isKeyDown(KEY_RIGHT_CONTROL)))
    {
       requestSave();
    }
 
-   auto mousePos = GetMousePosition();
+   if (frame.isKeyPressed(KEY_F3))
+   {
+      profiler.setEnabled(!profiler.isEnabled());
+   }
+   if (frame.isKeyPressed(KEY_F4) && profiler.isEnabled())
+   {
+      saveProfile();
+   }
+#ifdef CONTOMAP_TRACING
+   if (frame.isKeyPressed(KEY_F5))
+   {
+      saveTrace();
+   }
+#endif
+
+   auto mousePos = frame.getMousePosition();
    auto barHeight = layout.buttonHeight() + layout.padding() + 2.0f;
    auto contentSize = context.getContentSize();
    MouseInput input {
-      .buttonPressed = IsMouseButtonPressed(MOUSE_BUTTON_LEFT),
-      .buttonDown = IsMouseButtonDown(MOUSE_BUTTON_LEFT),
-      .ctrlDown = IsKeyDown(KEY_LEFT_CONTROL),
-      .abortPressed = IsKeyPressed(KEY_ESCAPE),
+      .buttonPressed = frame.isMouseButtonPressed(),
+      .buttonDown = frame.isMouseButtonDown(),
+      .ctrlDown = frame.isKeyDown(KEY_LEFT_CONTROL),
+      .shiftDown = frame.isKeyDown(KEY_LEFT_SHIFT),
+      .abortPressed = frame.isKeyPressed(KEY_ESCAPE),
       .pixelPos = mousePos,
+      .worldPos = focusCoordinate,
       .worldMoveDelta = focusDelta,
       .overMap = (mousePos.y > barHeight) && (mousePos.y < (contentSize.y - barHeight)),
    };
    mouseHandler(input);
 }
 
-void MainWindow::updateState()
+void MainWindow::updateState(InputFrame const &input)
 {
-   auto frameTime = contomap::frontend::FrameTime::fromLastFrame();
-   mapCamera.timePassed(frameTime);
+   mapCamera.timePassed(input.getFrameTime());
+}
+
+void MainWindow::trackActivity(bool mayWaitForEvents)
+{
+   // Dialogs are always considered active, as their widgets animate and repeat keys based on drawn frames.
+   bool changed = mapCamera.isMoving() || (editBuffer.getRevision() != lastFrameRevision) || (currentDialog != nullptr) || (pendingDialog != nullptr);
+   lastFrameRevision = editBuffer.getRevision();
+   idleTracker.frameDone(changed);
+
+#ifndef __EMSCRIPTEN__
+   // While idle, the end of the frame blocks until the next input event. In the browser, frames are driven by the page instead.
+   bool shouldWait = mayWaitForEvents && idleTracker.isIdle();
+   if (shouldWait != waitingForEvents)
+   {
+      waitingForEvents = shouldWait;
+      if (waitingForEvents)
+      {
+         EnableEventWaiting();
+      }
+      else
+      {
+         DisableEventWaiting();
+      }
+   }
+#endif
 }
 
 void MainWindow::cycleSelectedOccurrence(bool forward)
@@ -268,7 +370,14 @@ void MainWindow::panCameraToSelectedOccurrence()
 
 void MainWindow::handleMouseIdle(MouseInput const &input)
 {
-   if (input.buttonPressed && input.overMap)
+   if (input.buttonPressed && input.overMap && input.shiftDown)
+   {
+      selectionBoxAnchor = input.worldPos;
+      selectionBoxAnchorPixel = input.pixelPos;
+      mouseHandler = [this](MouseInput const &nested) { handleMouseSelectingBox(nested); };
+      mouseHandler(input);
+   }
+   else if (input.buttonPressed && input.overMap)
    {
       auto action = input.ctrlDown ? SelectionAction::Toggle : SelectionAction::Set;
       currentFocus.modifySelection(editBuffer, action);
@@ -308,220 +417,171 @@ void MainWindow::handleMouseDownMoving(MouseInput const &input)
    }
 }
 
-void MainWindow::drawBackground()
-{
-   ClearBackground(WHITE);
-}
-
-void MainWindow::drawMap(Vector2 focusCoordinate)
+void MainWindow::handleMouseSelectingBox(MouseInput const &input)
 {
-   DirectMapRenderer directMapRenderer;
-   FocusInterceptor focusInterceptor(directMapRenderer, focusCoordinate);
-   MapRenderList renderList;
-   renderMap(renderList, view.ofSelection(), currentFocus, selectionDrawOffset);
-   renderList.optimize();
-   renderList.renderTo(focusInterceptor);
-   currentFocus = focusInterceptor.getNewFocus();
+   selectionBox = boxSpanning(selectionBoxAnchor, input.worldPos);
+   bool done = false;
+   if (!input.buttonDown)
+   {
+      // A box that was hardly dragged is taken as a click that missed, which leaves the selection as it is.
+      if (Vector2Distance(selectionBoxAnchorPixel, input.pixelPos) >= MIN_SELECTION_BOX_PIXEL_SIZE)
+      {
+         selectItemsWithin(selectionBox.value(), input.ctrlDown ? SelectionAction::Toggle : SelectionAction::Set);
+      }
+      done = true;
+   }
+   else if (input.abortPressed)
+   {
+      done = true;
+   }
+   if (done)
+   {
+      selectionBox.reset();
+      mouseHandler = [this](MouseInput const &nested) { handleMouseIdle(nested); };
+   }
 }
 
-void MainWindow::renderMap(MapRenderer &renderer, contomap::editor::Selection const &selection, Focus const &focus, SpacialCoordinate::Offset selectionOffset)
+void MainWindow::selectItemsWithin(Rectangle area, SelectionAction action)
 {
-   static Style const defaultStyle = Style()
-                                        .with(Style::ColorType::Text, Style::Color { .red = 0x00, .green = 0x00, .blue = 0x00, .alpha = 0xFF })
-                                        .with(Style::ColorType::Fill, Style::Color { .red = 0xE0, .green = 0xE0, .blue = 0xE0, .alpha = 0xFF })
-                                        .with(Style::ColorType::Line, Style::Color { .red = 0x00, .green = 0x00, .blue = 0x00, .alpha = 0xFF });
-
-   auto const &viewScope = view.ofViewScope();
-   auto const &map = view.ofMap();
-
-   Font font = GetFontDefault();
-   float spacing = 1.0f;
-
-   Identifiers associationIds;
-   std::map<Identifier, Rectangle> associationAreasById;
-   auto drawOffsetIf = [&selectionOffset](bool isSelected) { return isSelected ? selectionOffset : SpacialCoordinate::Offset::of(0.0f, 0.0f); };
-
-   auto visibleAssociations = map.find(Associations::thatAreIn(viewScope));
-   for (Association const &visibleAssociation : visibleAssociations)
+   CONTOMAP_TRACE_ZONE("MainWindow::selectItemsWithin");
+   // All items are applied in one request, so that the selection only changes once, regardless of how many items are within.
+   // At any zoom, only occurrences and associations that lie within the area are selected, and no roles.
+   contomap::editor::Selection items;
+   if (LevelOfDetail::forZoomFactor(mapCamera.getCurrentZoomFactor()).aggregatesIntoClusters())
+   {
+      // Clusters are not part of the hit index, so the items are taken from their points instead, as their plates are too small to matter.
+      auto const &map = view.ofMap();
+      MapClusters::collectWithin(map, *map.getScopes().selectWithin(view.ofViewScope()), area, items);
+   }
+   else
    {
-      bool associationIsSelected = selection.contains(SelectedType::Association, visibleAssociation.getId());
-      auto optionalTypeId = visibleAssociation.getType();
-      std::string nameText;
-      if (optionalTypeId.isAssigned())
+      for (auto const &item : hitIndex.platesWithin(area))
       {
-         auto typeTopic = view.ofMap().findTopic(optionalTypeId.value());
-         nameText = bestTitleFor(typeTopic.value());
+         items.add(item.type, item.id);
       }
+   }
+   editBuffer.modifySelection(items, action);
+}
 
-      auto spacialLocation = visibleAssociation.getLocation().getSpacial().getAbsoluteReference().plus(drawOffsetIf(associationIsSelected));
-      Vector2 projectedLocation { .x = spacialLocation.X(), .y = spacialLocation.Y() };
-
-      float fontSize = 16.0f;
-      auto textSize = MeasureTextEx(font, nameText.c_str(), fontSize, spacing);
-      float lineThickness = 2.0f;
-
-      Rectangle textArea {
-         .x = projectedLocation.x - textSize.x / 2.0f,
-         .y = projectedLocation.y - textSize.y / 2.0f,
-         .width = textSize.x,
-         .height = textSize.y,
-      };
+void MainWindow::drawBackground()
+{
+   ClearBackground(WHITE);
+}
 
-      float platePadding = 2.0f;
-      Rectangle plate {
-         .x = textArea.x - platePadding,
-         .y = textArea.y - platePadding,
-         .width = textArea.width + platePadding * 2.0f,
-         .height = textArea.height + platePadding * 2.0f,
-      };
-      float halfHeight = plate.height / 2.0f;
-      float reifierPadding = 2.0f + (lineThickness * 0.4f);
-      float reifierOffset = lineThickness + reifierPadding;
-      Rectangle area {
-         .x = plate.x - reifierOffset - lineThickness - halfHeight,
-         .y = plate.y - lineThickness,
-         .width = plate.width + (reifierOffset + lineThickness + halfHeight) * 2.0f,
-         .height = plate.height + lineThickness * 2.0f,
-      };
+void MainWindow::drawMap(Vector2 focusCoordinate, Rectangle visibleArea)
+{
+   auto zoomFactor = mapCamera.getCurrentZoomFactor();
+   auto detail = LevelOfDetail::forZoomFactor(zoomFactor);
+   bool dragging = Vector2Length(Vector2 { .x = selectionDrawOffset.X(), .y = selectionDrawOffset.Y() }) > 0.0f;
+   if (dragging && !detail.aggregatesIntoClusters())
+   {
+      drawDraggedSelection(zoomFactor, detail);
+   }
+   else
+   {
+      dragLayers.reset();
+      drawWholeMap(focusCoordinate, visibleArea, zoomFactor, detail);
+   }
 
-      associationIds.add(visibleAssociation.getId());
-      associationAreasById[visibleAssociation.getId()] = area;
+   if (selectionBox.has_value())
+   {
+      DrawRectangleRec(selectionBox.value(), Fade(BLUE, 0.1f));
+      DrawRectangleLinesEx(selectionBox.value(), 1.0f / zoomFactor.raw(), BLUE);
+   }
+}
 
-      auto associationStyle
-         = Styles::resolve(visibleAssociation.getAppearance(), visibleAssociation.getType(), view.ofViewScope(), view.ofMap()).withDefaultsFrom(defaultStyle);
-      if (associationIsSelected)
+void MainWindow::drawWholeMap(Vector2 focusCoordinate, Rectangle visibleArea, MapCamera::ZoomFactor zoomFactor, LevelOfDetail const &detail)
+{
+   MapRenderWalk::Layers layers;
+   auto &renderList = layers.fixed;
+   {
+      CONTOMAP_TRACE_ZONE("MainWindow::renderMap");
+      Profiler::Timer timer(profiler, profiled.renderMap);
+      if (detail.aggregatesIntoClusters())
       {
-         associationStyle = selectedStyle(associationStyle);
+         renderWalk.renderClusters(renderList, view.ofSelection(), selectionDrawOffset, visibleArea, detail);
       }
-      if (focus.isAssociation(visibleAssociation.getId()))
+      else
       {
-         associationStyle = highlightedStyle(associationStyle);
+         auto visibleTopicCount = renderWalk.renderMap(layers, view.ofSelection(), currentFocus, detail, false);
+         profiler.record(profiled.visibleTopics, static_cast<double>(visibleTopicCount));
       }
+   }
+   {
+      CONTOMAP_TRACE_ZONE("MapRenderList::optimize");
+      Profiler::Timer timer(profiler, profiled.optimize);
+      renderList.optimize();
+   }
+   if (profiler.isEnabled())
+   {
+      MapRenderCounter counter;
+      renderList.renderTo(counter);
+      profiler.record(profiled.visibleOccurrences, static_cast<double>(counter.getOccurrenceCount()));
+      profiler.record(profiled.visibleRoles, static_cast<double>(counter.getRoleCount()));
+      profiler.record(profiled.drawCommands, static_cast<double>(counter.getCallCount()));
+   }
 
-      renderer.renderAssociationPlate(visibleAssociation.getId(), area, associationStyle, plate, lineThickness, visibleAssociation.hasReifier());
-      renderer.renderText(textArea, Style().with(Style::ColorType::Text, associationStyle.get(Style::ColorType::Text)), nameText, font, fontSize, spacing);
+   // The geometry of the map only changes with recorded operations, the level of detail, or while dragging clusters.
+   HitIndexState newHitIndexState { .revision = editBuffer.getRevision(), .zoomFactor = zoomFactor };
+   bool dragging = Vector2Length(Vector2 { .x = selectionDrawOffset.X(), .y = selectionDrawOffset.Y() }) > 0.0f;
+   if (dragging || (hitIndexState != newHitIndexState))
+   {
+      CONTOMAP_TRACE_ZONE("MapRenderList::renderTo(hitIndex)");
+      Profiler::Timer timer(profiler, profiled.renderToHitIndex);
+      hitIndex.clear();
+      renderList.renderTo(hitIndex);
+      hitIndexState = dragging ? std::optional<HitIndexState>() : newHitIndexState;
    }
 
-   auto visibleTopics = map.find(Topics::thatAreIn(viewScope));
-   for (Topic const &visibleTopic : visibleTopics)
    {
-      std::string nameText = bestTitleFor(visibleTopic);
-      std::vector<std::reference_wrapper<Role const>> roles;
-      for (Role const &role : visibleTopic.rolesAssociatedWith(associationIds))
+      CONTOMAP_TRACE_ZONE("MapRenderList::renderTo(screen)");
+      Profiler::Timer timer(profiler, profiled.renderToScreen);
+      mapRenderer.restart(detail);
+      renderList.renderTo(mapRenderer);
+      mapRenderer.flush();
+   }
+   currentFocus = hitIndex.focusAt(focusCoordinate);
+}
+
+void MainWindow::drawDraggedSelection(MapCamera::ZoomFactor zoomFactor, LevelOfDetail const &detail)
+{
+   // Neither the map, nor the selection, nor the focus change while dragging. The layers are rendered once, and the moving one
+   // is only displayed at the offset. Only the roles between a moving and a fixed item are rendered anew for each frame.
+   // The hit index and the focus stay as they were when the drag started, and are updated after the selection was moved.
+   Vector2 offset { .x = selectionDrawOffset.X(), .y = selectionDrawOffset.Y() };
+   MapRenderList spanningRoles;
+   {
+      CONTOMAP_TRACE_ZONE("MainWindow::renderMap(drag)");
+      Profiler::Timer timer(profiler, profiled.renderMap);
+      if (!dragLayers.has_value() || (dragLayersZoomFactor != zoomFactor))
       {
-         roles.emplace_back(role);
+         dragLayers.emplace();
+         dragLayersZoomFactor = zoomFactor;
+         auto visibleTopicCount = renderWalk.renderMap(dragLayers.value(), view.ofSelection(), currentFocus, detail, true);
+         profiler.record(profiled.visibleTopics, static_cast<double>(visibleTopicCount));
+         dragLayers->fixed.optimize();
+         dragLayers->moving.optimize();
       }
-
-      for (Occurrence const &occurrence : visibleTopic.occurrencesIn(viewScope))
+      for (auto const &spanning : dragLayers->spanningRoles)
       {
-         bool occurrenceIsSelected = selection.contains(SelectedType::Occurrence, occurrence.getId());
-         auto spacialLocation = occurrence.getLocation().getSpacial().getAbsoluteReference().plus(drawOffsetIf(occurrenceIsSelected));
-         Vector2 projectedLocation { .x = spacialLocation.X(), .y = spacialLocation.Y() };
-
-         float occurrenceFontSize = 16.0f;
-         auto occurrenceTextSize = MeasureTextEx(font, nameText.c_str(), occurrenceFontSize, spacing);
-
-         float occurrenceBorderThickness = 2.0f;
-
-         Rectangle occurrenceTextArea {
-            .x = projectedLocation.x - occurrenceTextSize.x / 2.0f,
-            .y = projectedLocation.y - occurrenceTextSize.y / 2.0f,
-            .width = occurrenceTextSize.x,
-            .height = occurrenceTextSize.y,
-         };
-         float occurrencePlatePadding = 2.0f;
-         Rectangle occurrencePlate {
-            .x = occurrenceTextArea.x - occurrencePlatePadding,
-            .y = occurrenceTextArea.y - occurrencePlatePadding,
-            .width = occurrenceTextArea.width + occurrencePlatePadding * 2.0f,
-            .height = occurrenceTextArea.height + occurrencePlatePadding * 2.0f,
-         };
-         float occurrenceReifierPadding = 2.0f;
-         float occurrenceReifierOffset = occurrenceBorderThickness + occurrenceReifierPadding;
-         Rectangle occurrenceArea {
-            .x = occurrencePlate.x - occurrenceReifierOffset - occurrenceBorderThickness,
-            .y = occurrencePlate.y - occurrenceBorderThickness,
-            .width = occurrencePlate.width + (occurrenceReifierOffset * 2.0f) + (occurrenceBorderThickness * 2.0f),
-            .height = occurrencePlate.height + (occurrenceBorderThickness * 2.0f),
-         };
-
-         for (Role const &role : roles)
-         {
-            bool roleIsSelected = selection.contains(SelectedType::Role, role.getId());
-            std::string roleTitle;
-            auto optionalTypeId = role.getType();
-            if (optionalTypeId.isAssigned())
-            {
-               auto typeTopic = view.ofMap().findTopic(optionalTypeId.value());
-               roleTitle = bestTitleFor(typeTopic.value());
-            }
-
-            auto roleStyle = Styles::resolve(role.getAppearance(), role.getType(), view.ofViewScope(), view.ofMap()).withDefaultsFrom(defaultStyle);
-
-            float roleLineThickness = 1.0f;
-            if (roleIsSelected)
-            {
-               roleStyle = selectedStyle(roleStyle);
-               roleLineThickness += 2.0f;
-            }
-            if (focus.isRole(role.getId()))
-            {
-               roleStyle = highlightedStyle(roleStyle);
-               roleLineThickness += 0.5f;
-            }
-
-            auto associationArea = associationAreasById[role.getParent()];
-            auto rolePointApproxOccurrence = intersectLineIntoBoxCenter(centerOf(associationArea), occurrenceArea);
-            auto rolePointApproxAssociation = intersectLineIntoBoxCenter(centerOf(occurrenceArea), associationArea);
-            if (!rolePointApproxOccurrence.has_value() || !rolePointApproxAssociation.has_value()) [[unlikely]]
-            {
-               // can happen if either has its center within the area of the other
-               continue;
-            }
-            auto rolePointOccurrence = intersectLineIntoBoxCenter(rolePointApproxAssociation.value(), occurrenceArea);
-            auto rolePointAssociation = intersectLineIntoBoxCenter(rolePointApproxOccurrence.value(), associationArea);
-            if (!rolePointOccurrence.has_value() || !rolePointAssociation.has_value()) [[unlikely]]
-            {
-               // can happen if the point on the area border is within the area of the other
-               continue;
-            }
-
-            renderer.renderRoleLine(role.getId(), rolePointOccurrence.value(), rolePointAssociation.value(), roleStyle, roleLineThickness, role.hasReifier());
-
-            if (!roleTitle.empty())
-            {
-               float roleFontSize = 10.0f;
-               auto roleTextSize = MeasureTextEx(font, roleTitle.c_str(), roleFontSize, spacing);
-               float plateHeight = roleTextSize.y;
-
-               Rectangle roleArea {
-                  .x = (rolePointOccurrence.value().x + rolePointAssociation.value().x) / 2,
-                  .y = (rolePointOccurrence.value().y + rolePointAssociation.value().y) / 2 - roleTextSize.y / 2.0f,
-                  .width = roleTextSize.x,
-                  .height = plateHeight,
-               };
-
-               renderer.renderText(roleArea, roleStyle.without(Style::ColorType::Line), roleTitle, font, roleFontSize, spacing);
-            }
-         }
-
-         auto occurrenceStyle
-            = Styles::resolve(occurrence.getAppearance(), occurrence.getType(), view.ofViewScope(), view.ofMap()).withDefaultsFrom(defaultStyle);
-         if (occurrenceIsSelected)
-         {
-            occurrenceStyle = selectedStyle(occurrenceStyle);
-         }
-         if (focus.isOccurrence(occurrence.getId()))
-         {
-            occurrenceStyle = highlightedStyle(occurrenceStyle);
-         }
-
-         renderer.renderOccurrencePlate(
-            occurrence.getId(), occurrenceArea, occurrenceStyle, occurrencePlate, occurrenceBorderThickness, occurrence.hasReifier());
-         renderer.renderText(
-            occurrenceTextArea, Style().with(Style::ColorType::Text, occurrenceStyle.get(Style::ColorType::Text)), nameText, font, occurrenceFontSize, spacing);
+         MapRenderWalk::RoleLine line = spanning.line;
+         Rectangle &movingArea = spanning.occurrenceMoves ? line.occurrenceArea : line.associationArea;
+         movingArea.x += offset.x;
+         movingArea.y += offset.y;
+         MapRenderWalk::renderRole(spanningRoles, line);
       }
    }
+
+   {
+      CONTOMAP_TRACE_ZONE("MapRenderList::renderTo(screen)");
+      Profiler::Timer timer(profiler, profiled.renderToScreen);
+      mapRenderer.restart(detail);
+      dragLayers->fixed.renderTo(mapRenderer);
+      spanningRoles.renderTo(mapRenderer);
+      OffsetMapRenderer movingRenderer(mapRenderer, offset);
+      dragLayers->moving.renderTo(movingRenderer);
+      mapRenderer.flush();
+   }
 }
 
 void MainWindow::drawUserInterface(RenderContext const &context)
@@ -786,7 +846,7 @@ void MainWindow::drawUserInterface(RenderContext const &context)
             continue;
          }
          auto const &topic = view.ofMap().findTopic(id);
-         add(id, topic.has_value() ? bestTitleFor(topic.value()) : "???");
+         add(id, topic.has_value() ? bestTitleFor(topic.value()).str() : "???");
       }
    }
 
@@ -802,6 +862,85 @@ void MainWindow::drawUserInterface(RenderContext const &context)
    }
 }
 
+void MainWindow::drawProfilerOverlay(RenderContext const &context)
+{
+   if (!profiler.isEnabled())
+   {
+      return;
+   }
+   int fontSize = 10;
+   int lineHeight = fontSize + 2;
+   int columnWidth = 60;
+   int nameWidth = 130;
+   int padding = 4;
+   std::vector<Profiler::Series const *> allSeries;
+   profiler.forEach([&allSeries](Profiler::Series const &series) { allSeries.push_back(&series); });
+
+   int width = nameWidth + (columnWidth * 3) + (padding * 2);
+   int height = (lineHeight * static_cast<int>(allSeries.size() + 1 + accountedMemory.size() + 1)) + (padding * 3);
+   int x = static_cast<int>(context.getContentSize().x) - width - padding;
+   int y = static_cast<int>(layout.buttonHeight() + (layout.padding() * 3.0f));
+   DrawRectangle(x, y, width, height, Fade(BLACK, 0.7f));
+
+   auto drawRow = [x, padding, nameWidth, columnWidth, fontSize](int rowY, char const *name, std::array<std::string, 3> const &values) {
+      DrawText(name, x + padding, rowY, fontSize, WHITE);
+      for (size_t i = 0; i < values.size(); i++)
+      {
+         DrawText(values[i].c_str(), x + padding + nameWidth + (columnWidth * static_cast<int>(i)), rowY, fontSize, WHITE);
+      }
+   };
+   int rowY = y + padding;
+   drawRow(rowY, "F3: hide, F4: save CSV", { "min", "avg", "p99" });
+   for (auto const *series : allSeries)
+   {
+      rowY += lineHeight;
+      auto stats = series->statistics();
+      auto format = [series](double value) {
+         std::ostringstream text;
+         text.setf(std::ios::fixed);
+         text.precision((series->getUnit() == Profiler::Unit::Milliseconds) ? 2 : ((series->getUnit() == Profiler::Unit::Kibibytes) ? 1 : 0));
+         text << value;
+         return text.str();
+      };
+      drawRow(rowY, series->getName().c_str(), { format(stats.minimum), format(stats.average), format(stats.percentile99) });
+   }
+
+   rowY += lineHeight + padding;
+   drawRow(rowY, "memory (KiB)", { "live", "peak", "allocs" });
+   for (auto const &memory : accountedMemory)
+   {
+      rowY += lineHeight;
+      auto snapshot = memory.account->snapshot();
+      auto kibibytes = [](size_t bytes) {
+         std::ostringstream text;
+         text.setf(std::ios::fixed);
+         text.precision(1);
+         text << (static_cast<double>(bytes) / 1024.0);
+         return text.str();
+      };
+      drawRow(rowY, memory.account->getName().c_str(),
+         { kibibytes(snapshot.liveBytes), kibibytes(snapshot.peakBytes), std::to_string(snapshot.allocationCount) });
+   }
+}
+
+void MainWindow::sampleMemory()
+{
+   // Accounts are only ever added, so the known ones keep their position.
+   size_t index = 0;
+   MemoryAccount::forEach([this, &index](MemoryAccount const &account) {
+      if (index == accountedMemory.size())
+      {
+         accountedMemory.emplace_back(AccountedMemory { .account = &account,
+            .allocatedPerFrame = &profiler.series("alloc " + account.getName(), Profiler::Unit::Kibibytes),
+            .lastAllocatedBytes = account.snapshot().allocatedBytes });
+      }
+      auto &memory = accountedMemory[index++];
+      auto allocatedBytes = memory.account->snapshot().allocatedBytes;
+      profiler.record(*memory.allocatedPerFrame, static_cast<double>(allocatedBytes - memory.lastAllocatedBytes) / 1024.0);
+      memory.lastAllocatedBytes = allocatedBytes;
+   });
+}
+
 void MainWindow::requestNewFile()
 {
    editBuffer.newMap();
@@ -905,24 +1044,27 @@ void MainWindow::openEditStyleDialog()
 
 void MainWindow::load(std::string const &filePath)
 {
-   auto chunk = rpng_chunk_read(filePath.c_str(), PNG_MAP_TYPE.data());
-   if (chunk.length == 0)
+   CONTOMAP_TRACE_ZONE("MainWindow::load");
+   Profiler::Timer timer(profiler, profiled.load);
+   auto state = MapFile::load(filePath);
+   if (state.empty())
    {
       return;
    }
-   contomap::infrastructure::serial::BinaryDecoder decoder(chunk.data, chunk.data + chunk.length);
+   contomap::infrastructure::serial::BinaryDecoder decoder(state.data(), state.data() + state.size());
    if (editBuffer.loadState(decoder))
    {
       mapRestored(filePath);
    }
-
-   RPNG_FREE(chunk.data);
 }
 
 void MainWindow::save()
 {
-   contomap::frontend::MapRenderList renderList;
-   renderMap(renderList, {}, {}, SpacialCoordinate::Offset::of(0.0f, 0.0f));
+   CONTOMAP_TRACE_ZONE("MainWindow::save");
+   Profiler::Timer timer(profiler, profiled.save);
+   MapRenderWalk::Layers layers;
+   auto &renderList = layers.fixed;
+   static_cast<void>(renderWalk.renderMap(layers, {}, {}, LevelOfDetail::full(), false));
    renderList.optimize();
    contomap::frontend::MapRenderMeasurer measurer;
    renderList.renderTo(measurer);
@@ -936,13 +1078,14 @@ void MainWindow::save()
    auto renderTexture = LoadRenderTexture(std::ceil(mapArea.width * dpiScale.x), std::ceil(mapArea.height * dpiScale.y));
 
    {
-      DirectMapRenderer directRenderer;
+      BatchingMapRenderer textureRenderer(LevelOfDetail::full());
       BeginTextureMode(renderTexture);
       drawBackground();
       MapCamera camera(std::make_unique<MapCamera::ImmediateGearbox>());
       camera.panTo(Vector2 { .x = mapArea.x + (mapArea.width / 2.0f), .y = mapArea.y + (mapArea.height / 2.0f) });
       auto projection = camera.beginProjection(Vector2 { mapArea.width, mapArea.height });
-      renderList.renderTo(directRenderer);
+      renderList.renderTo(textureRenderer);
+      textureRenderer.flush();
       EndTextureMode();
    }
 
@@ -956,28 +1099,35 @@ void MainWindow::save()
    {
       return;
    }
+   contomap::infrastructure::serial::BinaryEncoder encoder;
+   editBuffer.saveState(encoder, false);
+   bool saved = MapFile::save(currentFilePath, exported, encoder.getData());
+   RL_FREE(exported);
+   if (saved)
    {
-      int outputSize = 0;
-      contomap::infrastructure::serial::BinaryEncoder encoder;
-      rpng_chunk chunk;
-      memset(&chunk, 0x00, sizeof(chunk));
-      editBuffer.saveState(encoder, false);
-      auto const &data = encoder.getData();
-      chunk.data = const_cast<uint8_t *>(data.data());
-      chunk.length = static_cast<int>(data.size());
-      memcpy(chunk.type, PNG_MAP_TYPE.data(), 4);
-
-      auto newExported = rpng_chunk_write_from_memory(reinterpret_cast<char const *>(exported), chunk, &outputSize);
-      RL_FREE(exported);
-      exported = reinterpret_cast<uint8_t *>(newExported);
-      fileSize = outputSize;
+      environment.fileSaved(currentFilePath);
    }
-   if (exported != nullptr)
+}
+
+void MainWindow::saveProfile()
+{
+   std::ofstream out(PROFILE_FILE_NAME);
+   profiler.writeCsv(out);
+   out.close();
+   if (out)
    {
-      SaveFileData(currentFilePath.c_str(), exported, fileSize);
-      RPNG_FREE(exported);
+      environment.fileSaved(PROFILE_FILE_NAME);
+   }
+}
 
-      environment.fileSaved(currentFilePath);
+void MainWindow::saveTrace()
+{
+   std::ofstream out(TRACE_FILE_NAME);
+   contomap::infrastructure::Trace::writeChromeJson(out);
+   out.close();
+   if (out)
+   {
+      environment.fileSaved(TRACE_FILE_NAME);
    }
 }
 
@@ -1000,7 +1150,7 @@ std::vector<std::pair<int, MapCamera::ZoomFactor>> MainWindow::generateZoomLevel
 {
    std::vector<std::pair<int, MapCamera::ZoomFactor>> levels;
    int stepSize = 5;
-   for (int i = -20; i < 40; i += stepSize)
+   for (int i = -40; i < 40; i += stepSize)
    {
       levels.emplace_back(i, MapCamera::ZoomFactor::from(std::pow(2.0f, static_cast<float>(i) / 10.0f)));
    }
@@ -1026,28 +1176,7 @@ MapCamera::ZoomOperation MainWindow::doubledRelative(bool nearer)
    };
 }
 
-std::string MainWindow::bestTitleFor(Topic const &topic)
-{
-   return Names::forScopedDisplay(topic, view.ofViewScope(), view.ofMap().getDefaultScope())[0];
-}
-
-Style MainWindow::selectedStyle(Style style)
-{
-   float factor = 0.5f;
-   Style copy = std::move(style);
-   return copy.with(Style::ColorType::Fill, brightenColor(copy.get(Style::ColorType::Fill), factor))
-      .with(Style::ColorType::Line, brightenColor(copy.get(Style::ColorType::Line), factor));
-}
-
-Style MainWindow::highlightedStyle(Style style)
-{
-   float factor = 0.75f;
-   Style copy = std::move(style);
-   return copy.with(Style::ColorType::Fill, brightenColor(copy.get(Style::ColorType::Fill), factor))
-      .with(Style::ColorType::Line, brightenColor(copy.get(Style::ColorType::Line), factor));
-}
-
-Style::Color MainWindow::brightenColor(Style::Color base, float factor)
+InternedString MainWindow::bestTitleFor(Topic const &topic)
 {
-   return Colors::fromUiColor(ColorBrightness(Colors::toUiColor(base), factor));
+   return Names::bestForScopedDisplay(topic, view.ofViewScope(), view.ofMap().getDefaultScope());
 }
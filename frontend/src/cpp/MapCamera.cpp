@@ -86,6 +86,11 @@ void MapCamera::ImmediateGearbox::pan(bool left, bool up, bool right, bool down)
    panningDown = down;
 }
 
+bool MapCamera::ImmediateGearbox::isMoving() const
+{
+   return panningLeft || panningUp || panningRight || panningDown;
+}
+
 MapCamera::SmoothGearbox::SmoothGearbox()
    : currentPosition(MapCamera::HOME_POSITION)
    , requestedZoomFactor(ZoomFactor::UNIT)
@@ -187,6 +192,12 @@ void MapCamera::SmoothGearbox::pan(bool left, bool up, bool right, bool down)
    }
 }
 
+bool MapCamera::SmoothGearbox::isMoving() const
+{
+   return panningLeft || panningUp || panningRight || panningDown || requestedPosition.has_value() || targetPosition.has_value()
+      || (requestedZoomFactor != currentZoomFactor) || (Vector2Length(currentPanningSpeed) > 0.0f);
+}
+
 contomap::frontend::MapCamera::Projection::Projection(MapCamera::Projection &&other) noexcept
 {
    moveFrom(std::move(other));
@@ -274,4 +285,14 @@ Vector2 MapCamera::getTargetPosition() const
 Vector2 MapCamera::getCurrentPosition() const
 {
    return gearbox->getCurrentPosition();
-}
\ No newline at end of file
+}
+
+MapCamera::ZoomFactor MapCamera::getCurrentZoomFactor() const
+{
+   return gearbox->getCurrentZoomFactor();
+}
+
+bool MapCamera::isMoving() const
+{
+   return gearbox->isMoving();
+}
@@ -0,0 +1,123 @@
+#include <cmath>
+
+#include "contomap/frontend/MapClusters.h"
+
+using contomap::editor::SelectedType;
+using contomap::frontend::MapClusters;
+using contomap::model::CoordinateTable;
+using contomap::model::SpacialCoordinate;
+
+void MapClusters::collect(contomap::model::ContomapView const &map, contomap::model::ScopeTable::Selection const &scopeSelection,
+   contomap::editor::Selection const &selection, SpacialCoordinate::Offset selectionOffset, Rectangle visibleArea, float cellSize)
+{
+   this->cellSize = cellSize;
+   firstColumn = static_cast<int64_t>(std::floor(visibleArea.x / cellSize));
+   firstRow = static_cast<int64_t>(std::floor(visibleArea.y / cellSize));
+   columnCount = static_cast<int64_t>(std::floor((visibleArea.x + visibleArea.width) / cellSize)) - firstColumn + 1;
+   rowCount = static_cast<int64_t>(std::floor((visibleArea.y + visibleArea.height) / cellSize)) - firstRow + 1;
+   cells.assign(static_cast<size_t>(columnCount * rowCount), Cell {});
+   clusters.clear();
+
+   // Items are culled by whole cells, so that the clusters at the border of the visible area keep their center while panning.
+   Rectangle cellArea {
+      .x = static_cast<float>(firstColumn) * cellSize,
+      .y = static_cast<float>(firstRow) * cellSize,
+      .width = static_cast<float>(columnCount) * cellSize,
+      .height = static_cast<float>(rowCount) * cellSize,
+   };
+   bool dragging = (selectionOffset.X() != 0.0f) || (selectionOffset.Y() != 0.0f);
+   Rectangle draggedArea { .x = cellArea.x - selectionOffset.X(), .y = cellArea.y - selectionOffset.Y(), .width = cellArea.width, .height = cellArea.height };
+
+   auto addAllOf = [this, &scopeSelection, &selection, &cellArea, &draggedArea, &selectionOffset, dragging](
+                      CoordinateTable const &locations, SelectedType type) {
+      rows.clear();
+      locations.collectWithin(boundsOf(cellArea), rows);
+      for (size_t row : rows)
+      {
+         if (!scopeSelection.contains(locations.scopeAt(row)))
+         {
+            continue;
+         }
+         bool isSelected = selection.contains(type, locations.idAt(row));
+         if (!isSelected || !dragging)
+         {
+            add(locations.pointAt(row), isSelected);
+         }
+      }
+      if (!dragging)
+      {
+         return;
+      }
+      // Dragged items are found where they are, and shown where they are moved to.
+      rows.clear();
+      locations.collectWithin(boundsOf(draggedArea), rows);
+      for (size_t row : rows)
+      {
+         if (scopeSelection.contains(locations.scopeAt(row)) && selection.contains(type, locations.idAt(row)))
+         {
+            add(locations.pointAt(row).plus(selectionOffset), true);
+         }
+      }
+   };
+   addAllOf(map.getAssociationLocations(), SelectedType::Association);
+   addAllOf(map.getOccurrenceLocations(), SelectedType::Occurrence);
+
+   for (auto const &cell : cells)
+   {
+      if (cell.count == 0)
+      {
+         continue;
+      }
+      auto count = static_cast<float>(cell.count);
+      clusters.emplace_back(Cluster {
+         .center = Vector2 { .x = cell.sumX / count, .y = cell.sumY / count },
+         .count = cell.count,
+         .containsSelection = cell.containsSelection,
+      });
+   }
+}
+
+std::vector<MapClusters::Cluster> const &MapClusters::getClusters() const
+{
+   return clusters;
+}
+
+void MapClusters::collectWithin(contomap::model::ContomapView const &map, contomap::model::ScopeTable::Selection const &scopeSelection, Rectangle area,
+   contomap::editor::Selection &items)
+{
+   std::vector<size_t> rows;
+   auto addAllOf = [&scopeSelection, &area, &items, &rows](CoordinateTable const &locations, SelectedType type) {
+      rows.clear();
+      locations.collectWithin(boundsOf(area), rows);
+      for (size_t row : rows)
+      {
+         if (scopeSelection.contains(locations.scopeAt(row)))
+         {
+            items.add(type, locations.idAt(row));
+         }
+      }
+   };
+   addAllOf(map.getAssociationLocations(), SelectedType::Association);
+   addAllOf(map.getOccurrenceLocations(), SelectedType::Occurrence);
+}
+
+CoordinateTable::Bounds MapClusters::boundsOf(Rectangle area)
+{
+   return CoordinateTable::Bounds { .minX = area.x, .minY = area.y, .maxX = area.x + area.width, .maxY = area.y + area.height };
+}
+
+void MapClusters::add(SpacialCoordinate::AbsolutePoint point, bool isSelected)
+{
+   auto column = static_cast<int64_t>(std::floor(point.X() / cellSize)) - firstColumn;
+   auto row = static_cast<int64_t>(std::floor(point.Y() / cellSize)) - firstRow;
+   // Points on the far edge of the culled area belong to the next cell, which is not visible.
+   if ((column < 0) || (column >= columnCount) || (row < 0) || (row >= rowCount))
+   {
+      return;
+   }
+   auto &cell = cells[static_cast<size_t>((row * columnCount) + column)];
+   cell.sumX += point.X();
+   cell.sumY += point.Y();
+   cell.count++;
+   cell.containsSelection = cell.containsSelection || isSelected;
+}
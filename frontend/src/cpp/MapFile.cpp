@@ -0,0 +1,44 @@
+#include <cstring>
+
+#include <raylib.h>
+
+#include <rpng/rpng.h>
+
+#include "contomap/frontend/MapFile.h"
+
+using contomap::frontend::MapFile;
+
+// According to http://www.libpng.org/pub/png/spec/1.2/PNG-Structure.html#Chunk-naming-conventions ,
+// the chunk type is ancillary (lower), private (lower), conforming (upper), safe-to-copy (lower).
+std::array<char, 5> const MapFile::CHUNK_TYPE { 'c', 'm', 'P', 'm', 0x00 };
+
+std::vector<uint8_t> MapFile::load(std::string const &filePath)
+{
+   auto chunk = rpng_chunk_read(filePath.c_str(), CHUNK_TYPE.data());
+   if (chunk.length <= 0)
+   {
+      return {};
+   }
+   std::vector<uint8_t> state(chunk.data, chunk.data + chunk.length);
+   RPNG_FREE(chunk.data);
+   return state;
+}
+
+bool MapFile::save(std::string const &filePath, uint8_t const *image, std::vector<uint8_t> const &state)
+{
+   rpng_chunk chunk;
+   memset(&chunk, 0x00, sizeof(chunk));
+   chunk.data = const_cast<uint8_t *>(state.data());
+   chunk.length = static_cast<int>(state.size());
+   memcpy(chunk.type, CHUNK_TYPE.data(), 4);
+
+   int outputSize = 0;
+   auto output = rpng_chunk_write_from_memory(reinterpret_cast<char const *>(image), chunk, &outputSize);
+   if (output == nullptr)
+   {
+      return false;
+   }
+   bool saved = SaveFileData(filePath.c_str(), output, outputSize);
+   RPNG_FREE(output);
+   return saved;
+}
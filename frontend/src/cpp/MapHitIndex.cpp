@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cmath>
+
+#include "contomap/frontend/Geometry.h"
+#include "contomap/frontend/MapHitIndex.h"
+
+using contomap::editor::SelectedType;
+using contomap::frontend::Focus;
+using contomap::frontend::FocusItem;
+using contomap::frontend::MapHitIndex;
+using contomap::frontend::geometry::centerOf;
+using contomap::frontend::geometry::encloses;
+using contomap::frontend::geometry::intersectLines;
+using contomap::frontend::geometry::overlaps;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+MapHitIndex::MapHitIndex() = default;
+
+void MapHitIndex::clear()
+{
+   entries.clear();
+   cells.clear();
+}
+
+bool MapHitIndex::empty() const
+{
+   return entries.empty();
+}
+
+Focus MapHitIndex::focusAt(Vector2 point) const
+{
+   Focus focus;
+   auto cell = cells.find(CellKey { cellOf(point.x), cellOf(point.y) });
+   if (cell == cells.end())
+   {
+      return focus;
+   }
+   for (size_t index : cell->second)
+   {
+      auto const &entry = entries[index];
+      if (isLine(entry))
+      {
+         if (distanceToLine(point, entry.start, entry.end) <= ROLE_LINE_TOLERANCE)
+         {
+            focus.registerItem(entry.item, 0.0f);
+         }
+      }
+      else if (contains(entry.bounds, point))
+      {
+         auto center = centerOf(entry.bounds);
+         focus.registerItem(entry.item, std::hypot(point.x - center.x, point.y - center.y));
+      }
+   }
+   return focus;
+}
+
+std::vector<FocusItem> MapHitIndex::itemsIntersecting(Rectangle area) const
+{
+   std::vector<size_t> indices;
+   collectCandidates(area, indices);
+   std::sort(indices.begin(), indices.end());
+   indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+   std::vector<FocusItem> result;
+   for (size_t index : indices)
+   {
+      auto const &entry = entries[index];
+      bool hit = isLine(entry) ? lineIntersects(entry.start, entry.end, area) : overlaps(entry.bounds, area);
+      if (hit)
+      {
+         result.emplace_back(entry.item);
+      }
+   }
+   return result;
+}
+
+std::vector<FocusItem> MapHitIndex::platesWithin(Rectangle area) const
+{
+   std::vector<size_t> indices;
+   collectCandidates(area, indices);
+   std::sort(indices.begin(), indices.end());
+   indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+   std::vector<FocusItem> result;
+   for (size_t index : indices)
+   {
+      auto const &entry = entries[index];
+      if (!isLine(entry) && encloses(area, entry.bounds))
+      {
+         result.emplace_back(entry.item);
+      }
+   }
+   return result;
+}
+
+void MapHitIndex::renderText(Rectangle, Style const &, InternedString const &, Font, float, float)
+{
+}
+
+void MapHitIndex::renderOccurrencePlate(Identifier id, Rectangle area, Style const &, Rectangle, float, bool)
+{
+   addPlate(FocusItem { .type = SelectedType::Occurrence, .id = id }, area);
+}
+
+void MapHitIndex::renderAssociationPlate(Identifier id, Rectangle area, Style const &, Rectangle, float, bool)
+{
+   addPlate(FocusItem { .type = SelectedType::Association, .id = id }, area);
+}
+
+void MapHitIndex::renderRoleLine(Identifier id, Vector2 a, Vector2 b, Style const &, float, bool)
+{
+   Rectangle bounds {
+      .x = std::min(a.x, b.x) - ROLE_LINE_TOLERANCE,
+      .y = std::min(a.y, b.y) - ROLE_LINE_TOLERANCE,
+      .width = std::abs(b.x - a.x) + (ROLE_LINE_TOLERANCE * 2.0f),
+      .height = std::abs(b.y - a.y) + (ROLE_LINE_TOLERANCE * 2.0f),
+   };
+   addEntry(Entry { .item = FocusItem { .type = SelectedType::Role, .id = id }, .bounds = bounds, .start = a, .end = b });
+}
+
+void MapHitIndex::renderClusterGlyph(Rectangle, Style const &, size_t)
+{
+   // Clusters stand for several items, none of which could be focused on its own. See MapClusters.
+}
+
+int64_t MapHitIndex::cellOf(float value)
+{
+   return static_cast<int64_t>(std::floor(value / CELL_SIZE));
+}
+
+bool MapHitIndex::isLine(Entry const &entry)
+{
+   return entry.item.type == SelectedType::Role;
+}
+
+bool MapHitIndex::contains(Rectangle area, Vector2 point)
+{
+   return (point.x >= area.x) && (point.x < (area.x + area.width)) && (point.y >= area.y) && (point.y < (area.y + area.height));
+}
+
+float MapHitIndex::distanceToLine(Vector2 point, Vector2 start, Vector2 end)
+{
+   Vector2 delta { .x = end.x - start.x, .y = end.y - start.y };
+   float lengthSquared = (delta.x * delta.x) + (delta.y * delta.y);
+   float t = 0.0f;
+   if (lengthSquared > 0.0f)
+   {
+      t = std::clamp((((point.x - start.x) * delta.x) + ((point.y - start.y) * delta.y)) / lengthSquared, 0.0f, 1.0f);
+   }
+   return std::hypot(point.x - (start.x + (t * delta.x)), point.y - (start.y + (t * delta.y)));
+}
+
+bool MapHitIndex::lineIntersects(Vector2 start, Vector2 end, Rectangle area)
+{
+   if (contains(area, start) || contains(area, end))
+   {
+      return true;
+   }
+   Vector2 topLeft { .x = area.x, .y = area.y };
+   Vector2 topRight { .x = area.x + area.width, .y = area.y };
+   Vector2 bottomLeft { .x = area.x, .y = area.y + area.height };
+   Vector2 bottomRight { .x = area.x + area.width, .y = area.y + area.height };
+   auto line = std::make_tuple(start, end);
+   return intersectLines(line, std::make_tuple(topLeft, topRight)).has_value() || intersectLines(line, std::make_tuple(topRight, bottomRight)).has_value()
+      || intersectLines(line, std::make_tuple(bottomRight, bottomLeft)).has_value() || intersectLines(line, std::make_tuple(bottomLeft, topLeft)).has_value();
+}
+
+void MapHitIndex::addPlate(FocusItem item, Rectangle area)
+{
+   addEntry(Entry { .item = item, .bounds = area, .start = Vector2 { .x = 0.0f, .y = 0.0f }, .end = Vector2 { .x = 0.0f, .y = 0.0f } });
+}
+
+void MapHitIndex::addEntry(Entry const &entry)
+{
+   size_t index = entries.size();
+   entries.emplace_back(entry);
+   if (isLine(entry))
+   {
+      addLineCells(index, entry.start, entry.end);
+      return;
+   }
+   auto const &bounds = entry.bounds;
+   for (int64_t x = cellOf(bounds.x); x <= cellOf(bounds.x + bounds.width); x++)
+   {
+      for (int64_t y = cellOf(bounds.y); y <= cellOf(bounds.y + bounds.height); y++)
+      {
+         cells[CellKey { x, y }].emplace_back(index);
+      }
+   }
+}
+
+void MapHitIndex::addLineCells(size_t index, Vector2 start, Vector2 end)
+{
+   // The line is swept column by column. Within a column, only the rows of the part of the line that passes it are covered,
+   // with all coordinates widened by the tolerance. This covers about as many cells as the line is long.
+   Vector2 delta { .x = end.x - start.x, .y = end.y - start.y };
+   int64_t lastColumn = cellOf(std::max(start.x, end.x) + ROLE_LINE_TOLERANCE);
+   for (int64_t x = cellOf(std::min(start.x, end.x) - ROLE_LINE_TOLERANCE); x <= lastColumn; x++)
+   {
+      float first = 0.0f;
+      float last = 1.0f;
+      if (delta.x != 0.0f)
+      {
+         first = std::clamp(((static_cast<float>(x) * CELL_SIZE) - ROLE_LINE_TOLERANCE - start.x) / delta.x, 0.0f, 1.0f);
+         last = std::clamp(((static_cast<float>(x + 1) * CELL_SIZE) + ROLE_LINE_TOLERANCE - start.x) / delta.x, 0.0f, 1.0f);
+      }
+      float firstY = start.y + (first * delta.y);
+      float lastY = start.y + (last * delta.y);
+      int64_t lastRow = cellOf(std::max(firstY, lastY) + ROLE_LINE_TOLERANCE);
+      for (int64_t y = cellOf(std::min(firstY, lastY) - ROLE_LINE_TOLERANCE); y <= lastRow; y++)
+      {
+         cells[CellKey { x, y }].emplace_back(index);
+      }
+   }
+}
+
+void MapHitIndex::collectCandidates(Rectangle area, std::vector<size_t> &indices) const
+{
+   int64_t minY = cellOf(area.y);
+   int64_t maxY = cellOf(area.y + area.height);
+   for (int64_t x = cellOf(area.x); x <= cellOf(area.x + area.width); x++)
+   {
+      auto end = cells.upper_bound(CellKey { x, maxY });
+      for (auto it = cells.lower_bound(CellKey { x, minY }); it != end; ++it)
+      {
+         indices.insert(indices.end(), it->second.begin(), it->second.end());
+      }
+   }
+}
@@ -0,0 +1,54 @@
+#include "contomap/frontend/MapRenderCounter.h"
+
+using contomap::frontend::MapRenderCounter;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+size_t MapRenderCounter::getOccurrenceCount() const
+{
+   return occurrenceCount;
+}
+
+size_t MapRenderCounter::getAssociationCount() const
+{
+   return associationCount;
+}
+
+size_t MapRenderCounter::getRoleCount() const
+{
+   return roleCount;
+}
+
+size_t MapRenderCounter::getCallCount() const
+{
+   return callCount;
+}
+
+void MapRenderCounter::renderText(Rectangle, Style const &, InternedString const &, Font, float, float)
+{
+   callCount++;
+}
+
+void MapRenderCounter::renderOccurrencePlate(Identifier, Rectangle, Style const &, Rectangle, float, bool)
+{
+   occurrenceCount++;
+   callCount++;
+}
+
+void MapRenderCounter::renderAssociationPlate(Identifier, Rectangle, Style const &, Rectangle, float, bool)
+{
+   associationCount++;
+   callCount++;
+}
+
+void MapRenderCounter::renderRoleLine(Identifier, Vector2, Vector2, Style const &, float, bool)
+{
+   roleCount++;
+   callCount++;
+}
+
+void MapRenderCounter::renderClusterGlyph(Rectangle, Style const &, size_t)
+{
+   callCount++;
+}
@@ -3,15 +3,25 @@
 
 using contomap::frontend::MapRenderer;
 using contomap::frontend::MapRenderList;
+using contomap::infrastructure::InternedString;
 using contomap::model::Identifier;
 using contomap::model::Style;
 
+char const *const MapRenderList::MemoryTag::NAME = "renderList";
+
 void MapRenderList::optimize()
 {
    flushPendingCommand();
    commands.sort([](auto const &a, auto const &b) { return a->getSortLayer() < b->getSortLayer(); });
 }
 
+void MapRenderList::append(MapRenderList &&other)
+{
+   flushPendingCommand();
+   other.flushPendingCommand();
+   commands.splice(commands.end(), other.commands);
+}
+
 void MapRenderList::renderTo(contomap::frontend::MapRenderer &renderer) const
 {
    for (auto const &command : commands)
@@ -24,7 +34,7 @@ void MapRenderList::renderTo(contomap::frontend::MapRenderer &renderer) const
    }
 }
 
-void MapRenderList::renderText(Rectangle area, Style const &style, std::string const &text, Font font, float fontSize, float spacing)
+void MapRenderList::renderText(Rectangle area, Style const &style, InternedString const &text, Font font, float fontSize, float spacing)
 {
    addToLastCommand(std::make_unique<TextRenderCommand>(area, style, text, font, fontSize, spacing));
 }
@@ -44,6 +54,11 @@ void MapRenderList::renderRoleLine(Identifier id, Vector2 a, Vector2 b, Style co
    startNewCommand(std::make_unique<RoleRenderCommand>(id, a, b, style, lineThickness, reified));
 }
 
+void MapRenderList::renderClusterGlyph(Rectangle area, Style const &style, size_t itemCount)
+{
+   startNewCommand(std::make_unique<ClusterRenderCommand>(area, style, itemCount));
+}
+
 void MapRenderList::startNewCommand(std::unique_ptr<TypedRenderCommand> command)
 {
    flushPendingCommand();
@@ -7,6 +7,7 @@
 #include "contomap/frontend/MapRenderMeasurer.h"
 
 using contomap::frontend::MapRenderMeasurer;
+using contomap::infrastructure::InternedString;
 using contomap::model::Identifier;
 using contomap::model::Style;
 
@@ -21,7 +22,7 @@ Rectangle MapRenderMeasurer::getArea() const
    return Rectangle { .x = minPoint.x, .y = minPoint.y, .width = maxPoint.x - minPoint.x, .height = maxPoint.y - minPoint.y };
 }
 
-void MapRenderMeasurer::renderText(Rectangle area, Style const &, std::string const &, Font, float, float)
+void MapRenderMeasurer::renderText(Rectangle area, Style const &, InternedString const &, Font, float, float)
 {
    addArea(area);
 }
@@ -42,6 +43,11 @@ void MapRenderMeasurer::renderRoleLine(Identifier, Vector2 a, Vector2 b, Style c
    addPoint(b);
 }
 
+void MapRenderMeasurer::renderClusterGlyph(Rectangle area, Style const &, size_t)
+{
+   addArea(area);
+}
+
 void MapRenderMeasurer::addArea(Rectangle area)
 {
    addPoint(Vector2 { .x = area.x, .y = area.y });
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+
+#include "contomap/editor/Styles.h"
+#include "contomap/frontend/Colors.h"
+#include "contomap/frontend/Geometry.h"
+#include "contomap/frontend/MapRenderWalk.h"
+#include "contomap/frontend/Names.h"
+#include "contomap/infrastructure/Trace.h"
+#include "contomap/model/Associations.h"
+#include "contomap/model/Topics.h"
+
+using contomap::editor::SelectedType;
+using contomap::editor::Styles;
+using contomap::frontend::Colors;
+using contomap::frontend::Focus;
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::MapRenderer;
+using contomap::frontend::MapRenderWalk;
+using contomap::frontend::Names;
+using contomap::frontend::geometry::centerOf;
+using contomap::frontend::geometry::intersectLineIntoBoxCenter;
+using contomap::infrastructure::InternedString;
+using contomap::infrastructure::TaskScheduler;
+using contomap::model::Association;
+using contomap::model::Associations;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Occurrence;
+using contomap::model::Role;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Style;
+using contomap::model::Topic;
+using contomap::model::Topics;
+
+// A few parts per thread balance topics of uneven size, while small maps are not worth the overhead of parallel rendering.
+size_t const MapRenderWalk::RENDER_PARTS_PER_THREAD = 4;
+size_t const MapRenderWalk::MIN_TOPICS_PER_RENDER_PART = 256;
+
+MapRenderWalk::MapRenderWalk(contomap::editor::View const &view, TaskScheduler &scheduler)
+   : view(view)
+   , scheduler(scheduler)
+{
+}
+
+void MapRenderWalk::Layers::append(Layers &&other)
+{
+   fixed.append(std::move(other.fixed));
+   moving.append(std::move(other.moving));
+   spanningRoles.insert(spanningRoles.end(), other.spanningRoles.begin(), other.spanningRoles.end());
+   other.spanningRoles.clear();
+}
+
+size_t MapRenderWalk::renderMap(
+   Layers &layers, contomap::editor::Selection const &selection, Focus const &focus, LevelOfDetail const &detail, bool separateSelection)
+{
+   auto const &viewScope = view.ofViewScope();
+   auto const &map = view.ofMap();
+   // The scopes are selected once for the frame, so that the parts rendered in parallel do not contend for the scope table.
+   auto scopeSelection = map.getScopes().selectWithin(viewScope);
+
+   Font font = GetFontDefault();
+   float spacing = 1.0f;
+
+   Identifiers associationIds;
+   std::map<Identifier, Rectangle> associationAreasById;
+   // With a separated selection, the selected items are rendered into the moving layer. Roles between a moving and a fixed item
+   // are only collected, as their line depends on the offset of the moving layer.
+   auto movesIf = [separateSelection](bool isSelected) { return separateSelection && isSelected; };
+   auto layerOf = [](Layers &target, bool moves) -> MapRenderer & { return moves ? target.moving : target.fixed; };
+
+   auto visibleAssociations = map.find(Associations::thatAreIn(viewScope));
+   for (Association const &visibleAssociation : visibleAssociations)
+   {
+      bool associationIsSelected = selection.contains(SelectedType::Association, visibleAssociation.getId());
+      auto optionalTypeId = visibleAssociation.getType();
+      InternedString nameText;
+      if (optionalTypeId.isAssigned())
+      {
+         auto typeTopic = map.findTopic(optionalTypeId.value());
+         nameText = bestTitleFor(typeTopic.value());
+      }
+
+      auto spacialLocation = visibleAssociation.getLocation().getSpacial().getAbsoluteReference();
+      Vector2 projectedLocation { .x = spacialLocation.X(), .y = spacialLocation.Y() };
+
+      float fontSize = 16.0f;
+      auto textSize = detail.measureText(font, nameText.str(), fontSize, spacing);
+      float lineThickness = 2.0f;
+
+      Rectangle textArea {
+         .x = projectedLocation.x - textSize.x / 2.0f,
+         .y = projectedLocation.y - textSize.y / 2.0f,
+         .width = textSize.x,
+         .height = textSize.y,
+      };
+
+      float platePadding = 2.0f;
+      Rectangle plate {
+         .x = textArea.x - platePadding,
+         .y = textArea.y - platePadding,
+         .width = textArea.width + platePadding * 2.0f,
+         .height = textArea.height + platePadding * 2.0f,
+      };
+      float halfHeight = plate.height / 2.0f;
+      float reifierPadding = 2.0f + (lineThickness * 0.4f);
+      float reifierOffset = lineThickness + reifierPadding;
+      Rectangle area {
+         .x = plate.x - reifierOffset - lineThickness - halfHeight,
+         .y = plate.y - lineThickness,
+         .width = plate.width + (reifierOffset + lineThickness + halfHeight) * 2.0f,
+         .height = plate.height + lineThickness * 2.0f,
+      };
+
+      associationIds.add(visibleAssociation.getId());
+      associationAreasById[visibleAssociation.getId()] = area;
+
+      auto associationStyle
+         = Styles::resolve(visibleAssociation.getAppearance(), visibleAssociation.getType(), *scopeSelection, map).withDefaultsFrom(defaultStyle());
+      if (associationIsSelected)
+      {
+         associationStyle = selectedStyle(associationStyle);
+      }
+      if (focus.isAssociation(visibleAssociation.getId()))
+      {
+         associationStyle = highlightedStyle(associationStyle);
+      }
+
+      auto &renderer = layerOf(layers, movesIf(associationIsSelected));
+      renderer.renderAssociationPlate(visibleAssociation.getId(), area, associationStyle, plate, lineThickness, visibleAssociation.hasReifier());
+      renderer.renderText(textArea, Style().with(Style::ColorType::Text, associationStyle.get(Style::ColorType::Text)), nameText, font, fontSize, spacing);
+   }
+
+   auto renderTopic = [&](Layers &target, Topic const &visibleTopic) {
+      InternedString nameText = bestTitleFor(visibleTopic);
+      std::vector<std::reference_wrapper<Role const>> roles;
+      for (Role const &role : visibleTopic.rolesAssociatedWith(associationIds))
+      {
+         roles.emplace_back(role);
+      }
+
+      for (Occurrence const &occurrence : visibleTopic.occurrencesIn(viewScope))
+      {
+         bool occurrenceIsSelected = selection.contains(SelectedType::Occurrence, occurrence.getId());
+         bool occurrenceMoves = movesIf(occurrenceIsSelected);
+         auto &renderer = layerOf(target, occurrenceMoves);
+         auto spacialLocation = occurrence.getLocation().getSpacial().getAbsoluteReference();
+         Vector2 projectedLocation { .x = spacialLocation.X(), .y = spacialLocation.Y() };
+
+         float occurrenceFontSize = 16.0f;
+         auto occurrenceTextSize = detail.measureText(font, nameText.str(), occurrenceFontSize, spacing);
+
+         float occurrenceBorderThickness = 2.0f;
+
+         Rectangle occurrenceTextArea {
+            .x = projectedLocation.x - occurrenceTextSize.x / 2.0f,
+            .y = projectedLocation.y - occurrenceTextSize.y / 2.0f,
+            .width = occurrenceTextSize.x,
+            .height = occurrenceTextSize.y,
+         };
+         float occurrencePlatePadding = 2.0f;
+         Rectangle occurrencePlate {
+            .x = occurrenceTextArea.x - occurrencePlatePadding,
+            .y = occurrenceTextArea.y - occurrencePlatePadding,
+            .width = occurrenceTextArea.width + occurrencePlatePadding * 2.0f,
+            .height = occurrenceTextArea.height + occurrencePlatePadding * 2.0f,
+         };
+         float occurrenceReifierPadding = 2.0f;
+         float occurrenceReifierOffset = occurrenceBorderThickness + occurrenceReifierPadding;
+         Rectangle occurrenceArea {
+            .x = occurrencePlate.x - occurrenceReifierOffset - occurrenceBorderThickness,
+            .y = occurrencePlate.y - occurrenceBorderThickness,
+            .width = occurrencePlate.width + (occurrenceReifierOffset * 2.0f) + (occurrenceBorderThickness * 2.0f),
+            .height = occurrencePlate.height + (occurrenceBorderThickness * 2.0f),
+         };
+
+         float roleFontSize = 10.0f;
+         bool roleTitlesShown = detail.showsTextOfSize(roleFontSize);
+         for (Role const &role : roles)
+         {
+            bool roleIsSelected = selection.contains(SelectedType::Role, role.getId());
+            InternedString roleTitle;
+            auto optionalTypeId = role.getType();
+            if (roleTitlesShown && optionalTypeId.isAssigned())
+            {
+               auto typeTopic = map.findTopic(optionalTypeId.value());
+               roleTitle = bestTitleFor(typeTopic.value());
+            }
+
+            auto roleStyle = Styles::resolve(role.getAppearance(), role.getType(), *scopeSelection, map).withDefaultsFrom(defaultStyle());
+
+            float roleLineThickness = 1.0f;
+            if (roleIsSelected)
+            {
+               roleStyle = selectedStyle(roleStyle);
+               roleLineThickness += 2.0f;
+            }
+            if (focus.isRole(role.getId()))
+            {
+               roleStyle = highlightedStyle(roleStyle);
+               roleLineThickness += 0.5f;
+            }
+
+            RoleLine line {
+               .id = role.getId(),
+               .occurrenceArea = occurrenceArea,
+               .associationArea = associationAreasById.at(role.getParent()),
+               .style = roleStyle,
+               .lineThickness = roleLineThickness,
+               .reified = role.hasReifier(),
+               .title = roleTitle,
+               .font = font,
+               .fontSize = roleFontSize,
+               .spacing = spacing,
+            };
+            bool associationMoves = movesIf(selection.contains(SelectedType::Association, role.getParent()));
+            if (occurrenceMoves == associationMoves)
+            {
+               renderRole(renderer, line);
+            }
+            else
+            {
+               target.spanningRoles.emplace_back(SpanningRoleLine { .line = line, .occurrenceMoves = occurrenceMoves });
+            }
+         }
+
+         auto occurrenceStyle = Styles::resolve(occurrence.getAppearance(), occurrence.getType(), *scopeSelection, map).withDefaultsFrom(defaultStyle());
+         if (occurrenceIsSelected)
+         {
+            occurrenceStyle = selectedStyle(occurrenceStyle);
+         }
+         if (focus.isOccurrence(occurrence.getId()))
+         {
+            occurrenceStyle = highlightedStyle(occurrenceStyle);
+         }
+
+         renderer.renderOccurrencePlate(
+            occurrence.getId(), occurrenceArea, occurrenceStyle, occurrencePlate, occurrenceBorderThickness, occurrence.hasReifier());
+         renderer.renderText(
+            occurrenceTextArea, Style().with(Style::ColorType::Text, occurrenceStyle.get(Style::ColorType::Text)), nameText, font, occurrenceFontSize, spacing);
+      }
+   };
+
+   // Topics only read from the model, which allows rendering them in parallel: they are split into consecutive parts, each
+   // rendered into a list of its own. The parts are appended in order, and with optimize() sorting stably, the final list
+   // is the same as if all topics were rendered in sequence.
+   std::vector<std::reference_wrapper<Topic const>> visibleTopics;
+   for (Topic const &visibleTopic : map.find(Topics::thatAreIn(viewScope)))
+   {
+      visibleTopics.emplace_back(visibleTopic);
+   }
+   CONTOMAP_TRACE_COUNTER("visibleTopics", visibleTopics.size());
+   size_t partCount = std::min(scheduler.concurrency() * RENDER_PARTS_PER_THREAD, visibleTopics.size() / MIN_TOPICS_PER_RENDER_PART);
+   if (partCount <= 1)
+   {
+      for (Topic const &visibleTopic : visibleTopics)
+      {
+         renderTopic(layers, visibleTopic);
+      }
+      return visibleTopics.size();
+   }
+   std::vector<Layers> parts(partCount);
+   scheduler.parallelFor(0, partCount, 1, [&visibleTopics, &parts, &renderTopic](size_t first, size_t last) {
+      for (size_t part = first; part < last; part++)
+      {
+         CONTOMAP_TRACE_ZONE("MapRenderWalk::renderMap part");
+         size_t topicsEnd = visibleTopics.size() * (part + 1) / parts.size();
+         for (size_t index = visibleTopics.size() * part / parts.size(); index < topicsEnd; index++)
+         {
+            renderTopic(parts[part], visibleTopics[index]);
+         }
+      }
+   });
+   for (auto &part : parts)
+   {
+      layers.append(std::move(part));
+   }
+   return visibleTopics.size();
+}
+
+void MapRenderWalk::renderRole(MapRenderer &renderer, RoleLine const &line)
+{
+   auto rolePointApproxOccurrence = intersectLineIntoBoxCenter(centerOf(line.associationArea), line.occurrenceArea);
+   auto rolePointApproxAssociation = intersectLineIntoBoxCenter(centerOf(line.occurrenceArea), line.associationArea);
+   if (!rolePointApproxOccurrence.has_value() || !rolePointApproxAssociation.has_value()) [[unlikely]]
+   {
+      // can happen if either has its center within the area of the other
+      return;
+   }
+   auto rolePointOccurrence = intersectLineIntoBoxCenter(rolePointApproxAssociation.value(), line.occurrenceArea);
+   auto rolePointAssociation = intersectLineIntoBoxCenter(rolePointApproxOccurrence.value(), line.associationArea);
+   if (!rolePointOccurrence.has_value() || !rolePointAssociation.has_value()) [[unlikely]]
+   {
+      // can happen if the point on the area border is within the area of the other
+      return;
+   }
+
+   renderer.renderRoleLine(line.id, rolePointOccurrence.value(), rolePointAssociation.value(), line.style, line.lineThickness, line.reified);
+
+   if (!line.title.empty())
+   {
+      auto roleTextSize = MeasureTextEx(line.font, line.title.c_str(), line.fontSize, line.spacing);
+      float plateHeight = roleTextSize.y;
+
+      Rectangle roleArea {
+         .x = (rolePointOccurrence.value().x + rolePointAssociation.value().x) / 2,
+         .y = (rolePointOccurrence.value().y + rolePointAssociation.value().y) / 2 - roleTextSize.y / 2.0f,
+         .width = roleTextSize.x,
+         .height = plateHeight,
+      };
+
+      renderer.renderText(roleArea, line.style.without(Style::ColorType::Line), line.title, line.font, line.fontSize, line.spacing);
+   }
+}
+
+void MapRenderWalk::renderClusters(MapRenderer &renderer, contomap::editor::Selection const &selection, SpacialCoordinate::Offset selectionOffset,
+   Rectangle visibleArea, LevelOfDetail const &detail)
+{
+   auto const &map = view.ofMap();
+   float cellSize = detail.clusterCellSize();
+   auto scopeSelection = map.getScopes().selectWithin(view.ofViewScope());
+   mapClusters.collect(map, *scopeSelection, selection, selectionOffset, visibleArea, cellSize);
+
+   for (auto const &cluster : mapClusters.getClusters())
+   {
+      auto count = static_cast<float>(cluster.count);
+      // The glyph grows with the logarithm of the count, yet never beyond its cell, so that glyphs do not overlap.
+      float size = cellSize * std::min(0.3f + std::log2(count) * 0.1f, 0.9f);
+      Rectangle area { .x = cluster.center.x - size / 2.0f, .y = cluster.center.y - size / 2.0f, .width = size, .height = size };
+      renderer.renderClusterGlyph(area, cluster.containsSelection ? selectedStyle(defaultStyle()) : defaultStyle(), cluster.count);
+   }
+}
+
+Style const &MapRenderWalk::defaultStyle()
+{
+   static Style const style = Style()
+                                 .with(Style::ColorType::Text, Style::Color { .red = 0x00, .green = 0x00, .blue = 0x00, .alpha = 0xFF })
+                                 .with(Style::ColorType::Fill, Style::Color { .red = 0xE0, .green = 0xE0, .blue = 0xE0, .alpha = 0xFF })
+                                 .with(Style::ColorType::Line, Style::Color { .red = 0x00, .green = 0x00, .blue = 0x00, .alpha = 0xFF });
+   return style;
+}
+
+Style MapRenderWalk::selectedStyle(Style style)
+{
+   float factor = 0.5f;
+   return style.with(Style::ColorType::Fill, brightenColor(style.get(Style::ColorType::Fill), factor))
+      .with(Style::ColorType::Line, brightenColor(style.get(Style::ColorType::Line), factor));
+}
+
+Style MapRenderWalk::highlightedStyle(Style style)
+{
+   float factor = 0.75f;
+   return style.with(Style::ColorType::Fill, brightenColor(style.get(Style::ColorType::Fill), factor))
+      .with(Style::ColorType::Line, brightenColor(style.get(Style::ColorType::Line), factor));
+}
+
+Style::Color MapRenderWalk::brightenColor(Style::Color base, float factor)
+{
+   return Colors::fromUiColor(ColorBrightness(Colors::toUiColor(base), factor));
+}
+
+InternedString MapRenderWalk::bestTitleFor(Topic const &topic) const
+{
+   return Names::bestForScopedDisplay(topic, view.ofViewScope(), view.ofMap().getDefaultScope());
+}
@@ -1,38 +1,51 @@
 #include "contomap/frontend/Names.h"
 
 using contomap::frontend::Names;
+using contomap::infrastructure::InternedString;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
 using contomap::model::Topic;
 using contomap::model::TopicName;
 
-std::vector<std::string> Names::forDisplay(Topic const &topic, Identifier defaultScope)
+static InternedString const &defaultScopeName()
 {
-   std::vector<std::string> result;
+   static InternedString const NAME = InternedString::of("---");
+   return NAME;
+}
+
+static InternedString const &unknownName()
+{
+   static InternedString const NAME = InternedString::of("???");
+   return NAME;
+}
+
+std::vector<InternedString> Names::forDisplay(Topic const &topic, Identifier defaultScope)
+{
+   std::vector<InternedString> result;
 
    if (topic.getId() == defaultScope)
    {
-      result.emplace_back("---");
+      result.emplace_back(defaultScopeName());
    }
    for (TopicName const &name : topic.allNames())
    {
-      result.push_back(name.getValue().raw());
+      result.push_back(name.getValue().interned());
    }
    if (result.empty())
    {
-      result.emplace_back("???");
+      result.emplace_back(unknownName());
    }
 
    return result;
 }
 
-std::vector<std::string> Names::forScopedDisplay(Topic const &topic, Identifiers const &scope, Identifier defaultScope)
+std::vector<InternedString> Names::forScopedDisplay(Topic const &topic, Identifiers const &scope, Identifier defaultScope)
 {
-   std::vector<std::string> result;
+   std::vector<InternedString> result;
 
    if (topic.getId() == defaultScope)
    {
-      result.emplace_back("---");
+      result.emplace_back(defaultScopeName());
    }
    std::vector<std::reference_wrapper<TopicName const>> namesInScope;
    for (TopicName const &name : topic.allNames())
@@ -50,14 +63,31 @@ std::vector<std::string> Names::forScopedDisplay(Topic const &topic, Identifiers
       {
          if (name.hasSameScopeSizeAs(referenceName))
          {
-            result.emplace_back(name.getValue().raw());
+            result.emplace_back(name.getValue().interned());
          }
       }
    }
    else
    {
-      result.emplace_back("???");
+      result.emplace_back(unknownName());
    }
 
    return result;
 }
+
+InternedString Names::bestForScopedDisplay(Topic const &topic, Identifiers const &scope, Identifier defaultScope)
+{
+   if (topic.getId() == defaultScope)
+   {
+      return defaultScopeName();
+   }
+   TopicName const *best = nullptr;
+   for (TopicName const &name : topic.allNames())
+   {
+      if (name.isIn(scope) && ((best == nullptr) || name.hasNarrowerScopeThan(*best)))
+      {
+         best = &name;
+      }
+   }
+   return (best != nullptr) ? best->getValue().interned() : unknownName();
+}
@@ -0,0 +1,48 @@
+#include "contomap/frontend/OffsetMapRenderer.h"
+
+using contomap::frontend::MapRenderer;
+using contomap::frontend::OffsetMapRenderer;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+OffsetMapRenderer::OffsetMapRenderer(MapRenderer &nested, Vector2 offset)
+   : nested(nested)
+   , offset(offset)
+{
+}
+
+void OffsetMapRenderer::renderText(Rectangle area, Style const &style, InternedString const &text, Font font, float fontSize, float spacing)
+{
+   nested.renderText(moved(area), style, text, font, fontSize, spacing);
+}
+
+void OffsetMapRenderer::renderOccurrencePlate(Identifier id, Rectangle area, Style const &style, Rectangle plate, float lineThickness, bool reified)
+{
+   nested.renderOccurrencePlate(id, moved(area), style, moved(plate), lineThickness, reified);
+}
+
+void OffsetMapRenderer::renderAssociationPlate(Identifier id, Rectangle area, Style const &style, Rectangle plate, float lineThickness, bool reified)
+{
+   nested.renderAssociationPlate(id, moved(area), style, moved(plate), lineThickness, reified);
+}
+
+void OffsetMapRenderer::renderRoleLine(Identifier id, Vector2 a, Vector2 b, Style const &style, float lineThickness, bool reified)
+{
+   nested.renderRoleLine(id, moved(a), moved(b), style, lineThickness, reified);
+}
+
+void OffsetMapRenderer::renderClusterGlyph(Rectangle area, Style const &style, size_t itemCount)
+{
+   nested.renderClusterGlyph(moved(area), style, itemCount);
+}
+
+Rectangle OffsetMapRenderer::moved(Rectangle area) const
+{
+   return Rectangle { .x = area.x + offset.x, .y = area.y + offset.y, .width = area.width, .height = area.height };
+}
+
+Vector2 OffsetMapRenderer::moved(Vector2 point) const
+{
+   return Vector2 { .x = point.x + offset.x, .y = point.y + offset.y };
+}
@@ -13,6 +13,11 @@ RenderContext RenderContext::fromCurrentState()
    return RenderContext(GetWindowScaleDPI(), Vector2 { .x = static_cast<float>(GetRenderWidth()), .y = static_cast<float>(GetRenderHeight()) });
 }
 
+RenderContext RenderContext::withContentSize(Vector2 contentSize)
+{
+   return RenderContext(Vector2 { .x = 1.0f, .y = 1.0f }, contentSize);
+}
+
 Vector2 RenderContext::getContentSize() const
 {
    return Vector2 { .x = renderSize.x / dpiScale.x, .y = renderSize.y / dpiScale.y };
@@ -0,0 +1,101 @@
+#include <cmath>
+
+#include "contomap/frontend/TriangleBatch.h"
+
+using contomap::frontend::TriangleBatch;
+
+void TriangleBatch::addTriangle(Vector2 a, Color colorA, Vector2 b, Color colorB, Vector2 c, Color colorC)
+{
+   addVertex(a, colorA);
+   addVertex(b, colorB);
+   addVertex(c, colorC);
+}
+
+void TriangleBatch::addTriangle(Vector2 a, Vector2 b, Vector2 c, Color color)
+{
+   addTriangle(a, color, b, color, c, color);
+}
+
+void TriangleBatch::addRectangle(Rectangle area, Color color)
+{
+   Vector2 topLeft { .x = area.x, .y = area.y };
+   Vector2 topRight { .x = area.x + area.width, .y = area.y };
+   Vector2 bottomLeft { .x = area.x, .y = area.y + area.height };
+   Vector2 bottomRight { .x = area.x + area.width, .y = area.y + area.height };
+   addTriangle(topLeft, bottomLeft, topRight, color);
+   addTriangle(topRight, bottomLeft, bottomRight, color);
+}
+
+void TriangleBatch::addRectangleLines(Rectangle area, float lineThickness, Color color)
+{
+   float innerHeight = area.height - (lineThickness * 2.0f);
+   addRectangle(Rectangle { .x = area.x, .y = area.y, .width = area.width, .height = lineThickness }, color);
+   addRectangle(Rectangle { .x = area.x, .y = area.y + area.height - lineThickness, .width = area.width, .height = lineThickness }, color);
+   addRectangle(Rectangle { .x = area.x, .y = area.y + lineThickness, .width = lineThickness, .height = innerHeight }, color);
+   addRectangle(Rectangle { .x = area.x + area.width - lineThickness, .y = area.y + lineThickness, .width = lineThickness, .height = innerHeight }, color);
+}
+
+void TriangleBatch::addTriangleStrip(std::span<Vector2 const> points, Color color)
+{
+   for (size_t i = 2; i < points.size(); i++)
+   {
+      if ((i % 2) == 0)
+      {
+         addTriangle(points[i], points[i - 2], points[i - 1], color);
+      }
+      else
+      {
+         addTriangle(points[i], points[i - 1], points[i - 2], color);
+      }
+   }
+}
+
+void TriangleBatch::addLine(Vector2 a, Color colorA, Vector2 b, Color colorB, float thickness)
+{
+   Vector2 delta = { b.x - a.x, b.y - a.y };
+   float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+   if ((length <= 0.0f) || (thickness <= 0.0f))
+   {
+      return;
+   }
+   float scale = thickness / (2 * length);
+   Vector2 radius = { -scale * delta.y, scale * delta.x };
+   Vector2 startRight { a.x - radius.x, a.y - radius.y };
+   Vector2 startLeft { a.x + radius.x, a.y + radius.y };
+   Vector2 endRight { b.x - radius.x, b.y - radius.y };
+   Vector2 endLeft { b.x + radius.x, b.y + radius.y };
+   addTriangle(startRight, colorA, startLeft, colorA, endRight, colorB);
+   addTriangle(endRight, colorB, startLeft, colorA, endLeft, colorB);
+}
+
+bool TriangleBatch::empty() const
+{
+   return positions.empty();
+}
+
+size_t TriangleBatch::vertexCount() const
+{
+   return positions.size();
+}
+
+std::vector<Vector2> const &TriangleBatch::getPositions() const
+{
+   return positions;
+}
+
+std::vector<Color> const &TriangleBatch::getColors() const
+{
+   return colors;
+}
+
+void TriangleBatch::clear()
+{
+   positions.clear();
+   colors.clear();
+}
+
+void TriangleBatch::addVertex(Vector2 position, Color color)
+{
+   positions.emplace_back(position);
+   colors.emplace_back(color);
+}
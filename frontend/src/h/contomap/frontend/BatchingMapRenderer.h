@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "contomap/frontend/LevelOfDetail.h"
+#include "contomap/frontend/MapRenderer.h"
+#include "contomap/frontend/TriangleBatch.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * BatchingMapRenderer performs the actual render calls.
+ *
+ * All shapes of a layer (roles, associations, occurrences, ...) are accumulated into one triangle batch,
+ * which is submitted once the layer changes or the renderer is flushed. Texts of a layer are drawn after its shapes.
+ * Should a shape overlap a text that is still pending, everything pending is submitted before that shape,
+ * so that the shape covers the text as the order of requests demands. Pending texts are kept in a coarse grid,
+ * so that a shape is only tested against the texts of the cells it touches.
+ * Render requests should therefore be ordered by layer, as provided by an optimized MapRenderList.
+ */
+class BatchingMapRenderer : public contomap::frontend::MapRenderer
+{
+public:
+   /**
+    * Statistics provides counters about the requests and the resulting submissions.
+    */
+   struct Statistics
+   {
+      /** The number of render requests that were received. */
+      size_t requestCount = 0;
+      /** The number of submissions towards the graphics layer. */
+      size_t drawCallCount = 0;
+      /** The number of vertices that were submitted in triangle batches. */
+      size_t vertexCount = 0;
+      /** The number of submissions within a layer, because a shape overlapped a pending text. */
+      size_t overlapFlushCount = 0;
+   };
+
+   /**
+    * Constructor.
+    *
+    * @param detail the level of detail to render with.
+    */
+   explicit BatchingMapRenderer(contomap::frontend::LevelOfDetail detail);
+   ~BatchingMapRenderer() override = default;
+
+   /**
+    * Starts a new round of rendering. Statistics are reset, allocated buffers are kept.
+    *
+    * @param newDetail the level of detail to render with.
+    */
+   void restart(contomap::frontend::LevelOfDetail newDetail);
+
+   /**
+    * Submits all pending shapes and texts. Must be called before the render target is finished.
+    */
+   void flush();
+
+   /**
+    * @return the statistics since the last (re)start.
+    */
+   [[nodiscard]] Statistics getStatistics() const;
+
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
+   void renderOccurrencePlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderAssociationPlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
+
+private:
+   enum class Layer
+   {
+      Roles,
+      Associations,
+      Occurrences,
+      Clusters,
+      Unknown,
+   };
+
+   struct PendingText
+   {
+      Rectangle area;
+      Vector2 position;
+      Color color;
+      contomap::infrastructure::InternedString text;
+      Font font;
+      float fontSize;
+      float spacing;
+   };
+
+   struct TextCellRange
+   {
+      size_t firstColumn;
+      size_t lastColumn;
+      size_t firstRow;
+      size_t lastRow;
+   };
+
+   static size_t constexpr VERTICES_PER_SUBMISSION = 3 * 1024;
+   static float constexpr TEXT_CELL_SIZE = 128.0f;
+   static size_t constexpr TEXT_GRID_SIZE = 32;
+
+   [[nodiscard]] static size_t textCellOf(float value, float origin);
+
+   void enterLayer(Layer layer);
+   void flushTextsCoveredBy(Rectangle bounds);
+   void addPendingTextCells(size_t index, Rectangle area);
+   [[nodiscard]] TextCellRange textCellsOf(Rectangle area) const;
+   void clearPendingTexts();
+   void submitTriangles();
+   void submitTexts();
+
+   contomap::frontend::LevelOfDetail detail;
+   Layer currentLayer = Layer::Unknown;
+   contomap::frontend::TriangleBatch triangles;
+   std::vector<PendingText> texts;
+   size_t pendingTextCount = 0;
+   Rectangle pendingTextBounds { .x = 0.0f, .y = 0.0f, .width = 0.0f, .height = 0.0f };
+   Vector2 textGridOrigin { .x = 0.0f, .y = 0.0f };
+   std::vector<std::vector<size_t>> textCells;
+   std::vector<size_t> occupiedTextCells;
+   Statistics statistics;
+};
+
+} // namespace contomap::frontend
@@ -4,16 +4,27 @@
 
 #include "contomap/editor/InputRequestHandler.h"
 #include "contomap/frontend/MapCamera.h"
+#include "contomap/infrastructure/MemoryAccount.h"
 
 namespace contomap::frontend
 {
 
 /**
  * EditBuffer provides a undo/redo buffer for all input request handler operations.
+ * A batch of operations is recorded as one entry, as its requests go directly to the nested handler.
  */
 class EditBuffer : public contomap::editor::InputRequestHandler
 {
 public:
+   /**
+    * MemoryTag identifies the memory account of the undo history.
+    */
+   struct MemoryTag
+   {
+      /** The name of the account. */
+      static char const *const NAME;
+   };
+
    /**
     * Constructor.
     *
@@ -39,6 +50,11 @@ public:
     */
    void redo();
 
+   /**
+    * @return a counter that changes whenever an operation, undo, or redo changed the state of the nested handler.
+    */
+   [[nodiscard]] size_t getRevision() const;
+
    void newMap() override;
 
    contomap::model::Identifier newTopicRequested(contomap::model::TopicNameValue name, contomap::model::SpacialCoordinate location) override;
@@ -50,6 +66,7 @@ public:
    contomap::model::Identifier newAssociationRequested(contomap::model::SpacialCoordinate location) override;
    void clearSelection() override;
    void modifySelection(contomap::editor::SelectedType type, contomap::model::Identifier id, contomap::editor::SelectionAction action) override;
+   void modifySelection(contomap::editor::Selection const &items, contomap::editor::SelectionAction action) override;
    void linkSelection() override;
    void deleteSelection() override;
    void setAppearanceOfSelection(contomap::model::Style style) override;
@@ -69,15 +86,18 @@ public:
    void cycleSelectedOccurrenceForward() override;
    void cycleSelectedOccurrenceReverse() override;
    void selectClosestOccurrenceOf(contomap::model::Identifier topicId) override;
+   void performBatch(BatchOperations const &batch) override;
 
    void saveState(contomap::infrastructure::serial::Encoder &encoder, bool withSelection) override;
    [[nodiscard]] bool loadState(contomap::infrastructure::serial::Decoder &decoder) override;
 
 private:
+   template <class T> using Allocator = contomap::infrastructure::AccountedAllocator<T, MemoryTag>;
+
    struct Operation
    {
       Vector2 oldCameraPosition;
-      std::vector<uint8_t> stateData;
+      std::vector<uint8_t, Allocator<uint8_t>> stateData;
       Vector2 newCameraPosition;
    };
 
@@ -102,8 +122,9 @@ private:
    contomap::editor::InputRequestHandler &nested;
    contomap::frontend::MapCamera &camera;
 
-   std::vector<Operation> operations;
+   std::vector<Operation, Allocator<Operation>> operations;
    size_t operationIndex = 0;
+   size_t revision = 0;
 };
 
 }
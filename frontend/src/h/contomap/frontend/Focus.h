@@ -1,168 +1,30 @@
 #pragma once
 
-#include <memory>
+#include <optional>
 
 #include "contomap/editor/InputRequestHandler.h"
+#include "contomap/editor/SelectedType.h"
 #include "contomap/model/Identifier.h"
 
 namespace contomap::frontend
 {
 /**
- * A FocusItem is an adapter for concrete focused items of a map.
+ * A FocusItem refers to a concrete focusable item of a map.
  */
-class FocusItem
+struct FocusItem
 {
-public:
-   virtual ~FocusItem() = default;
-
-   /**
-    * Tests whether the item is an association with the given identifier.
-    *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified association.
-    */
-   [[nodiscard]] virtual bool isAssociation([[maybe_unused]] contomap::model::Identifier otherId) const
-   {
-      return false;
-   }
-
-   /**
-    * Tests whether the item is an role with the given identifier.
-    *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified role.
-    */
-   [[nodiscard]] virtual bool isRole([[maybe_unused]] contomap::model::Identifier otherId) const
-   {
-      return false;
-   }
-
-   /**
-    * Tests whether the item is an occurrence with the given identifier.
-    *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified occurrence.
-    */
-   [[nodiscard]] virtual bool isOccurrence([[maybe_unused]] contomap::model::Identifier otherId) const
-   {
-      return false;
-   }
-
-   /**
-    * Modify the selection on the input request handler with given action.
-    *
-    * @param handler the handler to call.
-    * @param action the action to forward.
-    */
-   virtual void modifySelection(contomap::editor::InputRequestHandler &handler, contomap::editor::SelectionAction action) const = 0;
-};
-
-/**
- * An AssociationFocusItem represents an association.
- */
-class AssociationFocusItem : public FocusItem
-{
-public:
-   /**
-    * Constructor.
-    *
-    * @param id the identifier of the association.
-    */
-   explicit AssociationFocusItem(contomap::model::Identifier id)
-      : id(id)
-   {
-   }
-
-   /**
-    * Tests whether the item is an association with the given identifier.
-    *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified association.
-    */
-   [[nodiscard]] bool isAssociation(contomap::model::Identifier otherId) const override
-   {
-      return id == otherId;
-   }
-
-   void modifySelection(contomap::editor::InputRequestHandler &handler, contomap::editor::SelectionAction action) const override
-   {
-      handler.modifySelection(contomap::editor::SelectedType::Association, id, action);
-   }
-
-private:
+   /** The kind of the referenced item. */
+   contomap::editor::SelectedType type;
+   /** The identifier of the referenced item. */
    contomap::model::Identifier id;
-};
-
-/**
- * A RoleFocusItem represents a role.
- */
-class RoleFocusItem : public FocusItem
-{
-public:
-   /**
-    * Constructor.
-    *
-    * @param id the identifier of the role.
-    */
-   explicit RoleFocusItem(contomap::model::Identifier id)
-      : id(id)
-   {
-   }
 
    /**
-    * Tests whether the item is an role with the given identifier.
+    * Compares two items.
     *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified role.
+    * @param other the other item to compare to.
+    * @return true if both refer to the same item.
     */
-   [[nodiscard]] bool isRole(contomap::model::Identifier otherId) const override
-   {
-      return id == otherId;
-   }
-
-   void modifySelection(contomap::editor::InputRequestHandler &handler, contomap::editor::SelectionAction action) const override
-   {
-      handler.modifySelection(contomap::editor::SelectedType::Role, id, action);
-   }
-
-private:
-   contomap::model::Identifier id;
-};
-
-/**
- * An OccurrenceFocusItem represents an occurrence.
- */
-class OccurrenceFocusItem : public FocusItem
-{
-public:
-   /**
-    * Constructor.
-    *
-    * @param id the identifier of the occurrence.
-    */
-   explicit OccurrenceFocusItem(contomap::model::Identifier id)
-      : id(id)
-   {
-   }
-
-   /**
-    * Tests whether the item is an occurrence with the given identifier.
-    *
-    * @param otherId the identifier to test against.
-    * @return true if this item is the identified occurrence.
-    */
-   [[nodiscard]] bool isOccurrence(contomap::model::Identifier otherId) const override
-   {
-      return id == otherId;
-   }
-
-   void modifySelection(contomap::editor::InputRequestHandler &handler, contomap::editor::SelectionAction action) const override
-   {
-      handler.modifySelection(contomap::editor::SelectedType::Occurrence, id, action);
-   }
-
-private:
-   contomap::model::Identifier id;
+   [[nodiscard]] bool operator==(FocusItem const &other) const = default;
 };
 
 /**
@@ -181,7 +43,7 @@ public:
     */
    [[nodiscard]] bool hasNoItem() const
    {
-      return item == nullptr;
+      return !item.has_value();
    }
 
    /**
@@ -191,7 +53,7 @@ public:
     * @param newItem the new item to focus.
     * @param newDistance the distance to consider for this item.
     */
-   void registerItem(std::shared_ptr<FocusItem> newItem, float newDistance);
+   void registerItem(contomap::frontend::FocusItem newItem, float newDistance);
 
    /**
     * Tests whether the focused item is an association with the given identifier.
@@ -201,7 +63,7 @@ public:
     */
    [[nodiscard]] bool isAssociation(contomap::model::Identifier otherId) const
    {
-      return (item != nullptr) && item->isAssociation(otherId);
+      return is(contomap::editor::SelectedType::Association, otherId);
    }
 
    /**
@@ -212,7 +74,7 @@ public:
     */
    [[nodiscard]] bool isRole(contomap::model::Identifier otherId) const
    {
-      return (item != nullptr) && item->isRole(otherId);
+      return is(contomap::editor::SelectedType::Role, otherId);
    }
 
    /**
@@ -221,9 +83,9 @@ public:
     * @param otherId the identifier to test against.
     * @return true if this item is the identified occurrence.
     */
-   [[nodiscard]] virtual bool isOccurrence(contomap::model::Identifier otherId) const
+   [[nodiscard]] bool isOccurrence(contomap::model::Identifier otherId) const
    {
-      return (item != nullptr) && item->isOccurrence(otherId);
+      return is(contomap::editor::SelectedType::Occurrence, otherId);
    }
 
    /**
@@ -235,7 +97,12 @@ public:
    void modifySelection(contomap::editor::InputRequestHandler &handler, contomap::editor::SelectionAction action) const;
 
 private:
-   std::shared_ptr<FocusItem> item;
+   [[nodiscard]] bool is(contomap::editor::SelectedType type, contomap::model::Identifier otherId) const
+   {
+      return item.has_value() && (item->type == type) && (item->id == otherId);
+   }
+
+   std::optional<contomap::frontend::FocusItem> item;
    float distance;
 };
 
@@ -35,4 +35,31 @@ namespace contomap::frontend::geometry
  */
 [[nodiscard]] Vector2 centerOf(Rectangle area);
 
+/**
+ * Calculate the rectangular area that two corner points span, regardless of their order.
+ *
+ * @param a one corner.
+ * @param b the opposite corner.
+ * @return the area between the two corners.
+ */
+[[nodiscard]] Rectangle boxSpanning(Vector2 a, Vector2 b);
+
+/**
+ * Determine whether two rectangular areas share some space. Areas that only touch at their edges do not overlap.
+ *
+ * @param a one area.
+ * @param b the other area.
+ * @return true in case the areas overlap.
+ */
+[[nodiscard]] bool overlaps(Rectangle a, Rectangle b);
+
+/**
+ * Determine whether an area lies completely within another one. Areas that touch the edges of the outer one are still within.
+ *
+ * @param outer the enclosing area.
+ * @param inner the area to test.
+ * @return true in case the inner area is enclosed by the outer one.
+ */
+[[nodiscard]] bool encloses(Rectangle outer, Rectangle inner);
+
 }
\ No newline at end of file
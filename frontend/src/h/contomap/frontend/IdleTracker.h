@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+namespace contomap::frontend
+{
+
+/**
+ * IdleTracker determines whether a window is idle: nothing changed for a few frames, so that the window shows what
+ * the model contains, and the next frame can wait for input events instead of being drawn right away.
+ *
+ * A few frames are drawn after each change, as some effects, such as the focus under the mouse cursor, appear only
+ * one frame after their cause. An idle window draws no frames at all until the next input event, which keeps its
+ * processor usage at effectively zero.
+ */
+class IdleTracker
+{
+public:
+   /**
+    * The number of frames without change, after which the window is idle.
+    */
+   static size_t const SETTLING_FRAME_COUNT;
+
+   /**
+    * Records the end of a frame.
+    * A frame that follows an idle one was woken by an input event, and counts as changed.
+    *
+    * @param changed true if the state changed during the frame, or is still in motion.
+    */
+   void frameDone(bool changed);
+
+   /**
+    * @return true if the next frame should wait for input events.
+    */
+   [[nodiscard]] bool isIdle() const;
+
+private:
+   size_t quietFrameCount = 0;
+};
+
+} // namespace contomap::frontend
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <raylib.h>
+
+#include "contomap/frontend/FrameTime.h"
+#include "contomap/infrastructure/serial/Decoder.h"
+#include "contomap/infrastructure/serial/Encoder.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * InputFrame is the state of the input devices, as the main window consumes it for one frame.
+ * It contains the frame time, the size of the content, the mouse, and the keys that the main window reacts to.
+ *
+ * Frames can be taken from the current state, or be recorded and replayed for reproducible runs.
+ * Keys that the main window does not react to are never reported as down, pressed, or released.
+ */
+class InputFrame
+{
+public:
+   /**
+    * @return the frame for the current state of the input devices.
+    */
+   [[nodiscard]] static InputFrame fromCurrentState();
+
+   /**
+    * Creates a frame without any input.
+    *
+    * @param frameTime the duration of the previous frame.
+    * @return a frame in which no key and no mouse button is touched.
+    */
+   [[nodiscard]] static InputFrame idleFor(contomap::frontend::FrameTime frameTime);
+
+   /**
+    * Decodes a frame that was encoded with encode().
+    *
+    * @param coder the decoder to read from.
+    * @param name the name of the scope.
+    * @param version the version of the encoded data.
+    * @return the decoded frame.
+    */
+   [[nodiscard]] static InputFrame from(contomap::infrastructure::serial::Decoder &coder, std::string const &name, uint8_t version);
+
+   /**
+    * @param key the key, as per raylib KeyboardKey.
+    * @return true if the given key is one that frames report on.
+    */
+   [[nodiscard]] static bool isObserved(int key);
+
+   /**
+    * Encodes the frame.
+    *
+    * @param coder the encoder to write to.
+    * @param name the name of the scope.
+    */
+   void encode(contomap::infrastructure::serial::Encoder &coder, std::string const &name) const;
+
+   /**
+    * Returns a copy with given content size.
+    *
+    * @param size the size of the content within the window, in pixel.
+    * @return the modified frame.
+    */
+   [[nodiscard]] InputFrame withContentSize(Vector2 size) const;
+
+   /**
+    * Returns a copy with given mouse state.
+    *
+    * @param position the position of the mouse, in pixel.
+    * @param buttonDown true if the left button is held down.
+    * @param buttonPressed true if the left button went down in this frame.
+    * @return the modified frame.
+    */
+   [[nodiscard]] InputFrame withMouse(Vector2 position, bool buttonDown, bool buttonPressed) const;
+
+   /**
+    * Returns a copy with given wheel movement.
+    *
+    * @param move the movement of the mouse wheel.
+    * @return the modified frame.
+    */
+   [[nodiscard]] InputFrame withMouseWheelMove(float move) const;
+
+   /**
+    * Returns a copy with given key state. Keys that are not observed stay untouched.
+    *
+    * @param key the key, as per raylib KeyboardKey.
+    * @param down true if the key is held down.
+    * @param pressed true if the key went down in this frame.
+    * @param released true if the key went up in this frame.
+    * @return the modified frame.
+    */
+   [[nodiscard]] InputFrame withKey(int key, bool down, bool pressed, bool released) const;
+
+   /**
+    * @return the duration of the previous frame.
+    */
+   [[nodiscard]] contomap::frontend::FrameTime getFrameTime() const;
+
+   /**
+    * @return the size of the content within the window, in pixel.
+    */
+   [[nodiscard]] Vector2 getContentSize() const;
+
+   /**
+    * @return the position of the mouse, in pixel.
+    */
+   [[nodiscard]] Vector2 getMousePosition() const;
+
+   /**
+    * @return the movement of the mouse wheel.
+    */
+   [[nodiscard]] float getMouseWheelMove() const;
+
+   /**
+    * @return true if the left mouse button went down in this frame.
+    */
+   [[nodiscard]] bool isMouseButtonPressed() const;
+
+   /**
+    * @return true if the left mouse button is held down.
+    */
+   [[nodiscard]] bool isMouseButtonDown() const;
+
+   /**
+    * @param key the key, as per raylib KeyboardKey.
+    * @return true if the key is held down.
+    */
+   [[nodiscard]] bool isKeyDown(int key) const;
+
+   /**
+    * @param key the key, as per raylib KeyboardKey.
+    * @return true if the key went down in this frame.
+    */
+   [[nodiscard]] bool isKeyPressed(int key) const;
+
+   /**
+    * @param key the key, as per raylib KeyboardKey.
+    * @return true if the key went up in this frame.
+    */
+   [[nodiscard]] bool isKeyReleased(int key) const;
+
+private:
+   explicit InputFrame(float frameSeconds);
+
+   [[nodiscard]] static bool hasKeyFlag(int key, uint32_t mask);
+
+   float frameSeconds;
+   Vector2 contentSize { .x = 0.0f, .y = 0.0f };
+   Vector2 mousePosition { .x = 0.0f, .y = 0.0f };
+   float mouseWheelMove = 0.0f;
+   bool mouseButtonPressed = false;
+   bool mouseButtonDown = false;
+   uint32_t keysDown = 0;
+   uint32_t keysPressed = 0;
+   uint32_t keysReleased = 0;
+};
+
+} // namespace contomap::frontend
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "contomap/frontend/InputFrame.h"
+#include "contomap/infrastructure/serial/Decoder.h"
+#include "contomap/infrastructure/serial/Encoder.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * InputRecording is a sequence of input frames, as they were consumed by the main window.
+ *
+ * Each frame carries the size of the content, and the recording carries the seed for new identifiers.
+ * Replaying the frames against the same map, with this seed, reproduces the same operations.
+ * Dialogs read the input devices on their own and are not covered by recordings.
+ */
+class InputRecording
+{
+public:
+   /** The version that encode() writes. */
+   static uint8_t const CURRENT_SERIAL_VERSION;
+
+   /**
+    * Default constructor, for a recording that is decoded.
+    */
+   InputRecording() = default;
+
+   /**
+    * Constructor.
+    *
+    * @param identifierSeed the seed with which identifiers were generated during the recording.
+    */
+   explicit InputRecording(uint32_t identifierSeed);
+
+   /**
+    * @return the seed with which identifiers were generated during the recording.
+    */
+   [[nodiscard]] uint32_t getIdentifierSeed() const;
+
+   /**
+    * Appends a frame.
+    *
+    * @param frame the frame to append.
+    */
+   void add(contomap::frontend::InputFrame const &frame);
+
+   /**
+    * @return the frames, in the order they were recorded.
+    */
+   [[nodiscard]] std::vector<contomap::frontend::InputFrame> const &getFrames() const;
+
+   /**
+    * Encodes the seed and all frames.
+    *
+    * @param coder the encoder to write to.
+    */
+   void encode(contomap::infrastructure::serial::Encoder &coder) const;
+
+   /**
+    * Replaces the seed and the frames with the decoded ones.
+    *
+    * @param coder the decoder to read from.
+    * @return true if the recording was decoded. On failure, the recording is left empty.
+    *    Recordings of previous versions are not decoded, as they lack the content size and the seed.
+    */
+   [[nodiscard]] bool decode(contomap::infrastructure::serial::Decoder &coder);
+
+private:
+   uint32_t identifierSeed = 0;
+   std::vector<contomap::frontend::InputFrame> frames;
+};
+
+} // namespace contomap::frontend
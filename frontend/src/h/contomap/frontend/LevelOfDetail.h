@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+
+#include <raylib.h>
+
+#include "contomap/frontend/MapCamera.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * LevelOfDetail describes how much of a map is worth rendering at a given magnification.
+ * Details that would end up smaller than a pixel are either reduced to simpler shapes or skipped.
+ */
+class LevelOfDetail
+{
+public:
+   /**
+    * @return an instance that renders all details, as required for exports.
+    */
+   [[nodiscard]] static LevelOfDetail full();
+
+   /**
+    * Determine the level of detail for the given zoom factor.
+    *
+    * @param zoomFactor the zoom factor the map is displayed with.
+    * @return the matching level of detail.
+    */
+   [[nodiscard]] static LevelOfDetail forZoomFactor(contomap::frontend::MapCamera::ZoomFactor zoomFactor);
+
+   /**
+    * Tests whether text of the given size is legible. Illegible text should be drawn as a placeholder bar.
+    *
+    * @param fontSize the font size, in map units.
+    * @return true if glyphs of the text shall be drawn.
+    */
+   [[nodiscard]] bool showsTextOfSize(float fontSize) const;
+
+   /**
+    * @return true if decorations, such as the markers for reification and shaded line ends, shall be drawn.
+    */
+   [[nodiscard]] bool showsDecorations() const;
+
+   /**
+    * @return true if items are too small to be drawn individually and shall be aggregated into clusters.
+    */
+   [[nodiscard]] bool aggregatesIntoClusters() const;
+
+   /**
+    * @return the edge length of the square cells, in map units, that form one cluster each.
+    */
+   [[nodiscard]] float clusterCellSize() const;
+
+   /**
+    * Measure the extent of the given text. For illegible text, the extent is estimated instead of calculated.
+    *
+    * @param font the font to use.
+    * @param text the text to measure.
+    * @param fontSize the font size, in map units.
+    * @param spacing the spacing between glyphs.
+    * @return the extent of the text, in map units.
+    */
+   [[nodiscard]] Vector2 measureText(Font font, std::string const &text, float fontSize, float spacing) const;
+
+private:
+   static float constexpr MIN_TEXT_PIXEL_SIZE = 5.0f;
+   static float constexpr MIN_DECORATION_SCALE = 0.5f;
+   static float constexpr MAX_CLUSTER_SCALE = 0.15f;
+   static float constexpr CLUSTER_CELL_PIXEL_SIZE = 24.0f;
+   static float constexpr ESTIMATED_GLYPH_WIDTH_RATIO = 0.5f;
+
+   explicit LevelOfDetail(float scale);
+
+   float scale;
+};
+
+} // namespace contomap::frontend
@@ -1,12 +1,16 @@
 #pragma once
 
 #include <array>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "contomap/editor/InputRequestHandler.h"
 #include "contomap/frontend/Dialog.h"
 #include "contomap/frontend/Layout.h"
 #include "contomap/model/ContomapView.h"
+#include "contomap/model/TopicNameIndex.h"
 
 namespace contomap::frontend
 {
@@ -240,7 +244,8 @@ private:
       explicit TopicList(contomap::model::ContomapView const &view);
 
       void reset();
-      [[nodiscard]] std::optional<contomap::model::Identifier> draw(Rectangle bounds, contomap::infrastructure::Search<contomap::model::Topic const> topics);
+      void setTopics(std::vector<contomap::model::Identifier> const &topicIds);
+      [[nodiscard]] std::optional<contomap::model::Identifier> draw(Rectangle bounds);
 
    private:
       enum class SelectionOffset
@@ -255,6 +260,7 @@ private:
 
       contomap::model::ContomapView const &view;
 
+      std::vector<std::pair<contomap::model::Identifier, contomap::infrastructure::InternedString>> entries;
       size_t scrollIndex = 0;
       std::optional<size_t> selectedIndex;
       std::optional<contomap::model::Identifier> selectedTopicId;
@@ -268,6 +274,7 @@ private:
    std::vector<TitledAction> actions;
 
    std::array<char, contomap::model::TopicNameValue::maxUtf8Bytes() + 1> searchInput {};
+   std::optional<contomap::model::TopicNameIndex::Result> searchResult;
    TopicList topicList;
 };
 
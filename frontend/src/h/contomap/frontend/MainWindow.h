@@ -2,18 +2,30 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "contomap/editor/InputRequestHandler.h"
 #include "contomap/editor/SelectionAction.h"
 #include "contomap/editor/View.h"
+#include "contomap/frontend/BatchingMapRenderer.h"
 #include "contomap/frontend/Dialog.h"
 #include "contomap/frontend/DisplayEnvironment.h"
 #include "contomap/frontend/EditBuffer.h"
 #include "contomap/frontend/Focus.h"
+#include "contomap/frontend/IdleTracker.h"
+#include "contomap/frontend/InputFrame.h"
 #include "contomap/frontend/Layout.h"
+#include "contomap/frontend/LevelOfDetail.h"
 #include "contomap/frontend/MapCamera.h"
+#include "contomap/frontend/MapHitIndex.h"
+#include "contomap/frontend/MapRenderList.h"
+#include "contomap/frontend/MapRenderWalk.h"
 #include "contomap/frontend/MapRenderer.h"
 #include "contomap/frontend/RenderContext.h"
+#include "contomap/infrastructure/MemoryAccount.h"
+#include "contomap/infrastructure/Profiler.h"
+#include "contomap/infrastructure/TaskScheduler.h"
 
 namespace contomap::frontend
 {
@@ -113,6 +125,23 @@ public:
     */
    void nextFrame();
 
+   /**
+    * Processes the next frame with given input, instead of the current state of the input devices.
+    * This is used to replay recorded input. Such frames never wait for input events.
+    * The window is resized to the content size of the frame.
+    *
+    * @param input the input to process.
+    */
+   void nextFrame(contomap::frontend::InputFrame const &input);
+
+   /**
+    * Loads the map from given file, replacing the current one.
+    * The current map is kept if the file does not contain a map.
+    *
+    * @param filePath the path of the file to load.
+    */
+   void load(std::string const &filePath);
+
    /**
     * Close the window in the display environment.
     */
@@ -124,35 +153,81 @@ private:
       bool buttonPressed;
       bool buttonDown;
       bool ctrlDown;
+      bool shiftDown;
       bool abortPressed;
       Vector2 pixelPos;
+      Vector2 worldPos;
       Vector2 worldMoveDelta;
       bool overMap;
    };
    using MouseHandler = std::function<void(MouseInput const &)>;
 
+   struct HitIndexState
+   {
+      size_t revision;
+      contomap::frontend::MapCamera::ZoomFactor zoomFactor;
+
+      bool operator==(HitIndexState const &other) const = default;
+   };
+
+   struct ProfiledSeries
+   {
+      explicit ProfiledSeries(contomap::infrastructure::Profiler &profiler);
+
+      contomap::infrastructure::Profiler::Series &frame;
+      contomap::infrastructure::Profiler::Series &processInput;
+      contomap::infrastructure::Profiler::Series &renderMap;
+      contomap::infrastructure::Profiler::Series &optimize;
+      contomap::infrastructure::Profiler::Series &renderToHitIndex;
+      contomap::infrastructure::Profiler::Series &renderToScreen;
+      contomap::infrastructure::Profiler::Series &drawUserInterface;
+      contomap::infrastructure::Profiler::Series &load;
+      contomap::infrastructure::Profiler::Series &save;
+      contomap::infrastructure::Profiler::Series &visibleTopics;
+      contomap::infrastructure::Profiler::Series &visibleOccurrences;
+      contomap::infrastructure::Profiler::Series &visibleRoles;
+      contomap::infrastructure::Profiler::Series &drawCommands;
+   };
+
+   struct AccountedMemory
+   {
+      contomap::infrastructure::MemoryAccount const *account;
+      contomap::infrastructure::Profiler::Series *allocatedPerFrame;
+      size_t lastAllocatedBytes;
+   };
+
    static Size const DEFAULT_SIZE;
    static char const DEFAULT_TITLE[];
-   static std::array<char, 5> const PNG_MAP_TYPE;
+   static char const PROFILE_FILE_NAME[];
+   static char const TRACE_FILE_NAME[];
+   static float const MIN_SELECTION_BOX_PIXEL_SIZE;
 
    [[nodiscard]] static contomap::frontend::MapCamera::ZoomOperation doubledRelative(bool nearer);
    [[nodiscard]] static std::vector<std::pair<int, contomap::frontend::MapCamera::ZoomFactor>> generateZoomLevels();
 
-   void processInput(contomap::frontend::RenderContext const &context, Vector2 focusCoordinate, Vector2 focusDelta);
-   void updateState();
+   void processFrame(contomap::frontend::InputFrame const &input, bool mayWaitForEvents);
+   void processInput(contomap::frontend::RenderContext const &context, contomap::frontend::InputFrame const &frame, Vector2 focusCoordinate,
+      Vector2 focusDelta);
+   void updateState(contomap::frontend::InputFrame const &input);
    void cycleSelectedOccurrence(bool forward);
    void jumpToFirstOccurrenceOf(contomap::model::Identifier topicId);
    void panCameraToSelectedOccurrence();
 
    void handleMouseIdle(MouseInput const &input);
    void handleMouseDownMoving(MouseInput const &input);
+   void handleMouseSelectingBox(MouseInput const &input);
+   void selectItemsWithin(Rectangle area, contomap::editor::SelectionAction action);
+
+   void trackActivity(bool mayWaitForEvents);
 
    void drawBackground();
-   void drawMap(Vector2 focusCoordinate);
+   void drawMap(Vector2 focusCoordinate, Rectangle visibleArea);
+   void drawWholeMap(Vector2 focusCoordinate, Rectangle visibleArea, contomap::frontend::MapCamera::ZoomFactor zoomFactor,
+      contomap::frontend::LevelOfDetail const &detail);
+   void drawDraggedSelection(contomap::frontend::MapCamera::ZoomFactor zoomFactor, contomap::frontend::LevelOfDetail const &detail);
    void drawUserInterface(contomap::frontend::RenderContext const &context);
-
-   void renderMap(contomap::frontend::MapRenderer &renderer, contomap::editor::Selection const &selection, Focus const &focus,
-      contomap::model::SpacialCoordinate::Offset selectionOffset);
+   void drawProfilerOverlay(contomap::frontend::RenderContext const &context);
+   void sampleMemory();
 
    void requestNewFile();
    void requestLoad();
@@ -166,16 +241,13 @@ private:
    void openSetTopicNameInScopeDialog();
    void openEditStyleDialog();
 
-   void load(std::string const &filePath);
    void save();
+   void saveProfile();
+   void saveTrace();
    void mapRestored(std::string const &filePath);
 
-   [[nodiscard]] static contomap::model::Style selectedStyle(contomap::model::Style style);
-   [[nodiscard]] static contomap::model::Style highlightedStyle(contomap::model::Style style);
-   [[nodiscard]] static contomap::model::Style::Color brightenColor(contomap::model::Style::Color base, float factor);
-
    [[nodiscard]] contomap::model::SpacialCoordinate spacialCameraLocation();
-   [[nodiscard]] std::string bestTitleFor(contomap::model::Topic const &topic);
+   [[nodiscard]] contomap::infrastructure::InternedString bestTitleFor(contomap::model::Topic const &topic);
 
    contomap::frontend::Layout layout;
 
@@ -184,6 +256,9 @@ private:
    contomap::frontend::DisplayEnvironment &environment;
    contomap::editor::View &view;
    contomap::frontend::EditBuffer editBuffer;
+   contomap::frontend::BatchingMapRenderer mapRenderer;
+   contomap::infrastructure::TaskScheduler renderScheduler;
+   contomap::frontend::MapRenderWalk renderWalk;
 
    contomap::model::Identifiers lastViewScope;
    size_t viewScopeListStartIndex = 0;
@@ -191,6 +266,8 @@ private:
    std::unique_ptr<contomap::frontend::Dialog> currentDialog;
    std::unique_ptr<contomap::frontend::Dialog> pendingDialog;
 
+   contomap::frontend::MapHitIndex hitIndex;
+   std::optional<HitIndexState> hitIndexState;
    contomap::frontend::Focus currentFocus;
    std::string currentFilePath;
 
@@ -198,6 +275,19 @@ private:
 
    MouseHandler mouseHandler;
    contomap::model::SpacialCoordinate::Offset selectionDrawOffset;
+   std::optional<contomap::frontend::MapRenderWalk::Layers> dragLayers;
+   std::optional<contomap::frontend::MapCamera::ZoomFactor> dragLayersZoomFactor;
+   Vector2 selectionBoxAnchor { .x = 0.0f, .y = 0.0f };
+   Vector2 selectionBoxAnchorPixel { .x = 0.0f, .y = 0.0f };
+   std::optional<Rectangle> selectionBox;
+
+   contomap::infrastructure::Profiler profiler;
+   ProfiledSeries profiled;
+   std::vector<AccountedMemory> accountedMemory;
+
+   contomap::frontend::IdleTracker idleTracker;
+   size_t lastFrameRevision = 0;
+   bool waitingForEvents = false;
 };
 
 } // namespace contomap::frontend
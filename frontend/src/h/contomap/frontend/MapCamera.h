@@ -123,6 +123,11 @@ public:
        * @param down pan down.
        */
       virtual void pan(bool left, bool up, bool right, bool down) = 0;
+
+      /**
+       * @return true if the camera still changes with the next call to timePassed().
+       */
+      [[nodiscard]] virtual bool isMoving() const = 0;
    };
 
    /**
@@ -146,6 +151,7 @@ public:
       [[nodiscard]] Vector2 getCurrentPosition() const override;
       void panTo(Vector2 target) override;
       void pan(bool left, bool up, bool right, bool down) override;
+      [[nodiscard]] bool isMoving() const override;
 
    private:
       Vector2 position;
@@ -177,6 +183,7 @@ public:
       [[nodiscard]] Vector2 getCurrentPosition() const override;
       void panTo(Vector2 target) override;
       void pan(bool left, bool up, bool right, bool down) override;
+      [[nodiscard]] bool isMoving() const override;
 
    private:
       static float constexpr ZOOM_TARGET_TIME = 0.075f;
@@ -301,6 +308,14 @@ public:
     * @return the current position as per gearbox movement.
     */
    [[nodiscard]] Vector2 getCurrentPosition() const;
+   /**
+    * @return the current zoom factor as per gearbox movement.
+    */
+   [[nodiscard]] ZoomFactor getCurrentZoomFactor() const;
+   /**
+    * @return true if the camera is still moving towards its target, or panning.
+    */
+   [[nodiscard]] bool isMoving() const;
 
    /**
     * Enters the projection mode; Drawing operations will be based on the projection transformation.
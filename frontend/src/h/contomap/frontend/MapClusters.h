@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+#include "contomap/editor/Selection.h"
+#include "contomap/model/ContomapView.h"
+#include "contomap/model/CoordinateTable.h"
+#include "contomap/model/ScopeTable.h"
+#include "contomap/model/SpacialCoordinate.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * MapClusters aggregates the occurrences and associations of a map into clusters, for when they are too small to be drawn individually.
+ *
+ * The map is divided into square cells, and the items of each cell form one cluster, centered at the average of their points.
+ * Only the cells that overlap the visible area are considered. The points are culled through the coordinate tables of the map,
+ * and the cells are kept in a flat grid that is reused for the next collection. Beyond the pass over the tables,
+ * the cost of a collection depends on the visible items and cells only.
+ *
+ * Clusters are not focusable. They are rendered as glyphs, which MapHitIndex does not capture, and so hovering or clicking
+ * a cluster focuses nothing. Items that are aggregated into clusters are selected by area instead, with collectWithin().
+ */
+class MapClusters
+{
+public:
+   /**
+    * A Cluster is the aggregation of all items within one cell.
+    */
+   struct Cluster
+   {
+      /** The average point of the items. */
+      Vector2 center;
+      /** The number of items. */
+      size_t count;
+      /** Whether any of the items is selected. */
+      bool containsSelection;
+   };
+
+   /**
+    * Aggregates the items of given map that are within the view scope of a scope selection.
+    * Selected items are considered at their point moved by given offset, in order to show them while they are dragged.
+    *
+    * @param map the map to aggregate.
+    * @param scopeSelection the selection of the view scope.
+    * @param selection the currently selected items.
+    * @param selectionOffset the offset to apply to selected items.
+    * @param visibleArea the area to consider, in map units.
+    * @param cellSize the edge length of the cells, in map units.
+    */
+   void collect(contomap::model::ContomapView const &map, contomap::model::ScopeTable::Selection const &scopeSelection,
+      contomap::editor::Selection const &selection, contomap::model::SpacialCoordinate::Offset selectionOffset, Rectangle visibleArea, float cellSize);
+
+   /**
+    * @return the clusters of the last collection, each with at least one item, ordered by row and column of their cell.
+    */
+   [[nodiscard]] std::vector<Cluster> const &getClusters() const;
+
+   /**
+    * Determines the occurrences and associations with their point within given area,
+    * which are the items a box covers while they are shown as clusters.
+    *
+    * @param map the map to look at.
+    * @param scopeSelection the selection of the view scope.
+    * @param area the area to test, in map units.
+    * @param items the selection to add the found items to.
+    */
+   static void collectWithin(contomap::model::ContomapView const &map, contomap::model::ScopeTable::Selection const &scopeSelection, Rectangle area,
+      contomap::editor::Selection &items);
+
+private:
+   struct Cell
+   {
+      float sumX = 0.0f;
+      float sumY = 0.0f;
+      size_t count = 0;
+      bool containsSelection = false;
+   };
+
+   [[nodiscard]] static contomap::model::CoordinateTable::Bounds boundsOf(Rectangle area);
+
+   void add(contomap::model::SpacialCoordinate::AbsolutePoint point, bool isSelected);
+
+   float cellSize = 1.0f;
+   int64_t firstColumn = 0;
+   int64_t firstRow = 0;
+   int64_t columnCount = 0;
+   int64_t rowCount = 0;
+   std::vector<Cell> cells;
+   std::vector<size_t> rows;
+   std::vector<Cluster> clusters;
+};
+
+} // namespace contomap::frontend
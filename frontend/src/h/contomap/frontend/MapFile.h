@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace contomap::frontend
+{
+
+/**
+ * MapFile stores the state of a map within a PNG image, as a dedicated chunk next to the image data.
+ * This way, a saved map can be viewed like any other image, and still be loaded for further editing.
+ */
+class MapFile
+{
+public:
+   /**
+    * Reads the state from given file.
+    *
+    * @param filePath the path of the file to read.
+    * @return the encoded state. Empty in case the file could not be read or does not contain a state.
+    */
+   [[nodiscard]] static std::vector<uint8_t> load(std::string const &filePath);
+
+   /**
+    * Writes given image, extended by the state, to given file.
+    *
+    * @param filePath the path of the file to write.
+    * @param image the encoded PNG image.
+    * @param state the encoded state.
+    * @return true in case the file was written.
+    */
+   static bool save(std::string const &filePath, uint8_t const *image, std::vector<uint8_t> const &state);
+
+private:
+   static std::array<char, 5> const CHUNK_TYPE;
+};
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "contomap/frontend/Focus.h"
+#include "contomap/frontend/MapRenderer.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * MapHitIndex captures the geometry of focusable map items in a uniform grid, in order to answer hit tests.
+ *
+ * The index is filled by rendering a map into it. As long as the geometry of the map does not change,
+ * the index can be queried repeatedly, without having to go through all the items again.
+ * A query only considers the items of the grid cells it touches, which are found in logarithmic time.
+ * Cluster glyphs are not captured, as they do not represent a single focusable item.
+ */
+class MapHitIndex : public contomap::frontend::MapRenderer
+{
+public:
+   /** The maximum distance of a point to a role line for the role to be hit. */
+   static float constexpr ROLE_LINE_TOLERANCE = 5.0f;
+
+   /**
+    * Constructor.
+    */
+   MapHitIndex();
+   ~MapHitIndex() override = default;
+
+   /**
+    * Removes all captured items.
+    */
+   void clear();
+
+   /**
+    * @return true if no item is captured.
+    */
+   [[nodiscard]] bool empty() const;
+
+   /**
+    * Determines the focus for a given point.
+    * Roles that are hit take precedence. Otherwise, of all hit plates, the one with the closest center is focused.
+    *
+    * @param point the point to test.
+    * @return the resulting focus, without any item if nothing was hit.
+    */
+   [[nodiscard]] contomap::frontend::Focus focusAt(Vector2 point) const;
+
+   /**
+    * Determines all items that overlap with a given area.
+    *
+    * @param area the area to test.
+    * @return the items in the order they were captured, each item once.
+    */
+   [[nodiscard]] std::vector<contomap::frontend::FocusItem> itemsIntersecting(Rectangle area) const;
+
+   /**
+    * Determines the occurrences and associations that lie completely within a given area.
+    * Roles are not considered, as their lines only connect the other items.
+    *
+    * @param area the area to test.
+    * @return the items in the order they were captured, each item once.
+    */
+   [[nodiscard]] std::vector<contomap::frontend::FocusItem> platesWithin(Rectangle area) const;
+
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
+   void renderOccurrencePlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderAssociationPlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
+
+private:
+   struct Entry
+   {
+      contomap::frontend::FocusItem item;
+      Rectangle bounds;
+      Vector2 start;
+      Vector2 end;
+   };
+
+   using CellKey = std::pair<int64_t, int64_t>;
+
+   static float constexpr CELL_SIZE = 128.0f;
+
+   [[nodiscard]] static int64_t cellOf(float value);
+   [[nodiscard]] static bool isLine(Entry const &entry);
+   [[nodiscard]] static bool contains(Rectangle area, Vector2 point);
+   [[nodiscard]] static float distanceToLine(Vector2 point, Vector2 start, Vector2 end);
+   [[nodiscard]] static bool lineIntersects(Vector2 start, Vector2 end, Rectangle area);
+
+   void addPlate(contomap::frontend::FocusItem item, Rectangle area);
+   void addEntry(Entry const &entry);
+   void addLineCells(size_t index, Vector2 start, Vector2 end);
+   void collectCandidates(Rectangle area, std::vector<size_t> &indices) const;
+
+   std::vector<Entry> entries;
+   std::map<CellKey, std::vector<size_t>> cells;
+};
+
+} // namespace contomap::frontend
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+#include "contomap/frontend/MapRenderer.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * MapRenderCounter counts the items of a rendered map.
+ */
+class MapRenderCounter : public contomap::frontend::MapRenderer
+{
+public:
+   ~MapRenderCounter() override = default;
+
+   /**
+    * @return the number of rendered occurrences.
+    */
+   [[nodiscard]] size_t getOccurrenceCount() const;
+   /**
+    * @return the number of rendered associations.
+    */
+   [[nodiscard]] size_t getAssociationCount() const;
+   /**
+    * @return the number of rendered roles.
+    */
+   [[nodiscard]] size_t getRoleCount() const;
+   /**
+    * @return the number of all render calls, including texts and cluster glyphs.
+    */
+   [[nodiscard]] size_t getCallCount() const;
+
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
+   void renderOccurrencePlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderAssociationPlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
+
+private:
+   size_t occurrenceCount = 0;
+   size_t associationCount = 0;
+   size_t roleCount = 0;
+   size_t callCount = 0;
+};
+
+} // namespace contomap::frontend
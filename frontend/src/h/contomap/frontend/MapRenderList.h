@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <list>
+#include <memory>
+#include <new>
 #include <utility>
 
 #include "contomap/frontend/Focus.h"
 #include "contomap/frontend/MapRenderer.h"
+#include "contomap/infrastructure/MemoryAccount.h"
 
 namespace contomap::frontend
 {
@@ -15,6 +19,15 @@ namespace contomap::frontend
 class MapRenderList : public contomap::frontend::MapRenderer
 {
 public:
+   /**
+    * MemoryTag identifies the memory account of all render lists.
+    */
+   struct MemoryTag
+   {
+      /** The name of the account. */
+      static char const *const NAME;
+   };
+
    ~MapRenderList() override = default;
 
    /**
@@ -22,6 +35,14 @@ public:
     */
    void optimize();
 
+   /**
+    * Moves all commands of the other list to the end of this list, as if they had been rendered here.
+    * The other list is empty afterwards.
+    *
+    * @param other the list to take the commands from.
+    */
+   void append(MapRenderList &&other);
+
    /**
     * Requests to render the list to the given renderer.
     *
@@ -29,19 +50,36 @@ public:
     */
    void renderTo(contomap::frontend::MapRenderer &renderer) const;
 
-   void renderText(Rectangle area, contomap::model::Style const &style, std::string const &text, Font font, float fontSize, float spacing) override;
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
    void renderOccurrencePlate(
       contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
    void renderAssociationPlate(
       contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
    void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
 
 private:
+   template <class T> using Allocator = contomap::infrastructure::AccountedAllocator<T, MemoryTag>;
+
    class RenderCommand
    {
    public:
       virtual ~RenderCommand() = default;
 
+      static void *operator new(size_t size)
+      {
+         void *memory = ::operator new(size);
+         contomap::infrastructure::MemoryAccount::of<MemoryTag>().allocated(size);
+         return memory;
+      }
+
+      static void operator delete(void *memory, size_t size) noexcept
+      {
+         contomap::infrastructure::MemoryAccount::of<MemoryTag>().released(size);
+         ::operator delete(memory, size);
+      }
+
       virtual void renderTo(contomap::frontend::MapRenderer &renderer) const = 0;
    };
 
@@ -62,13 +100,13 @@ private:
       }
 
    private:
-      std::list<std::unique_ptr<RenderCommand>> commands;
+      std::list<std::unique_ptr<RenderCommand>, Allocator<std::unique_ptr<RenderCommand>>> commands;
    };
 
    class TextRenderCommand : public RenderCommand
    {
    public:
-      TextRenderCommand(Rectangle area, contomap::model::Style style, std::string text, Font font, float fontSize, float spacing)
+      TextRenderCommand(Rectangle area, contomap::model::Style style, contomap::infrastructure::InternedString text, Font font, float fontSize, float spacing)
          : area(area)
          , style(std::move(style))
          , text(std::move(text))
@@ -86,7 +124,7 @@ private:
    private:
       Rectangle area;
       contomap::model::Style style;
-      std::string text;
+      contomap::infrastructure::InternedString text;
       Font font;
       float fontSize;
       float spacing;
@@ -100,7 +138,8 @@ private:
          Roles = 0,
          Associations = 1,
          Occurrences = 2,
-         Unknown = 3,
+         Clusters = 3,
+         Unknown = 4,
       };
 
       void renderTo(contomap::frontend::MapRenderer &renderer) const override
@@ -248,11 +287,37 @@ private:
       bool reified;
    };
 
+   class ClusterRenderCommand : public TypedRenderCommand
+   {
+   public:
+      ClusterRenderCommand(Rectangle area, contomap::model::Style style, size_t itemCount)
+         : area(area)
+         , style(std::move(style))
+         , itemCount(itemCount)
+      {
+      }
+
+      [[nodiscard]] SortLayer getSortLayer() const override
+      {
+         return SortLayer::Clusters;
+      }
+
+      void renderBaseTo(contomap::frontend::MapRenderer &renderer) const override
+      {
+         renderer.renderClusterGlyph(area, style, itemCount);
+      }
+
+   private:
+      Rectangle area;
+      contomap::model::Style style;
+      size_t itemCount;
+   };
+
    void startNewCommand(std::unique_ptr<TypedRenderCommand> command);
    void addToLastCommand(std::unique_ptr<RenderCommand> command);
    void flushPendingCommand();
 
-   std::list<std::unique_ptr<TypedRenderCommand>> commands;
+   std::list<std::unique_ptr<TypedRenderCommand>, Allocator<std::unique_ptr<TypedRenderCommand>>> commands;
    std::unique_ptr<TypedRenderCommand> pendingCommand;
 };
 
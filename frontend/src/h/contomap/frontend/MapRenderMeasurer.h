@@ -23,12 +23,14 @@ public:
     */
    [[nodiscard]] Rectangle getArea() const;
 
-   void renderText(Rectangle area, contomap::model::Style const &style, std::string const &text, Font font, float fontSize, float spacing) override;
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
    void renderOccurrencePlate(
       contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
    void renderAssociationPlate(
       contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
    void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
 
 private:
    void addArea(Rectangle area);
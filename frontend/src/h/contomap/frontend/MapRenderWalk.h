@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <raylib.h>
+
+#include "contomap/editor/Selection.h"
+#include "contomap/editor/View.h"
+#include "contomap/frontend/Focus.h"
+#include "contomap/frontend/LevelOfDetail.h"
+#include "contomap/frontend/MapClusters.h"
+#include "contomap/frontend/MapRenderList.h"
+#include "contomap/frontend/MapRenderer.h"
+#include "contomap/infrastructure/InternedString.h"
+#include "contomap/infrastructure/TaskScheduler.h"
+#include "contomap/model/Identifier.h"
+#include "contomap/model/SpacialCoordinate.h"
+#include "contomap/model/Style.h"
+#include "contomap/model/Topic.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * MapRenderWalk walks the visible items of a view, and renders them to render lists.
+ *
+ * The walk determines the areas and styles of all items with the given level of detail. The topics of large maps are
+ * split into parts, which are rendered in parallel on a task scheduler.
+ */
+class MapRenderWalk
+{
+public:
+   /**
+    * RoleLine is the description of a role, from which its line and title are rendered.
+    */
+   struct RoleLine
+   {
+      /** The identifier of the role. */
+      contomap::model::Identifier id;
+      /** The area of the occurrence at one end of the line. */
+      Rectangle occurrenceArea;
+      /** The area of the association at the other end of the line. */
+      Rectangle associationArea;
+      /** The resolved style of the role. */
+      contomap::model::Style style;
+      /** The thickness of the line. */
+      float lineThickness;
+      /** Whether the role is reified. */
+      bool reified;
+      /** The title to render along the line; Empty if none is shown. */
+      contomap::infrastructure::InternedString title;
+      /** The font of the title. */
+      Font font;
+      /** The font size of the title. */
+      float fontSize;
+      /** The spacing of the title. */
+      float spacing;
+   };
+
+   /**
+    * SpanningRoleLine is a role between a moving and a fixed item.
+    */
+   struct SpanningRoleLine
+   {
+      /** The role, with both areas as they are before moving. */
+      RoleLine line;
+      /** Whether the occurrence moves, or the association. */
+      bool occurrenceMoves;
+   };
+
+   /**
+    * Layers receive the render calls of a walk.
+    */
+   struct Layers
+   {
+      /**
+       * Moves all content of the other layers to the end of these, as if it had been rendered here.
+       *
+       * @param other the layers to take the content from. They are empty afterwards.
+       */
+      void append(Layers &&other);
+
+      /** The items that stay in place. */
+      contomap::frontend::MapRenderList fixed;
+      /** The items that move with a separated selection. */
+      contomap::frontend::MapRenderList moving;
+      /** The roles between a moving and a fixed item, which depend on the offset of the moving layer. */
+      std::vector<SpanningRoleLine> spanningRoles;
+   };
+
+   /**
+    * Constructor.
+    *
+    * @param view the view to walk.
+    * @param scheduler the scheduler to render the parts of large maps on.
+    */
+   MapRenderWalk(contomap::editor::View const &view, contomap::infrastructure::TaskScheduler &scheduler);
+
+   /**
+    * Renders all visible items of the view.
+    *
+    * @param layers the layers to render into.
+    * @param selection the items to render as selected.
+    * @param focus the item to render highlighted.
+    * @param detail the level of detail to render with.
+    * @param separateSelection whether selected items are rendered into the moving layer.
+    * @return the number of visible topics.
+    */
+   size_t renderMap(Layers &layers, contomap::editor::Selection const &selection, contomap::frontend::Focus const &focus,
+      contomap::frontend::LevelOfDetail const &detail, bool separateSelection);
+
+   /**
+    * Renders the visible items of the view aggregated into clusters.
+    *
+    * @param renderer the renderer to render the glyphs of the clusters to.
+    * @param selection the items to render as selected.
+    * @param selectionOffset the offset by which the selected items are currently dragged.
+    * @param visibleArea the area to consider, in map units.
+    * @param detail the level of detail that determines the size of the clusters.
+    */
+   void renderClusters(contomap::frontend::MapRenderer &renderer, contomap::editor::Selection const &selection,
+      contomap::model::SpacialCoordinate::Offset selectionOffset, Rectangle visibleArea, contomap::frontend::LevelOfDetail const &detail);
+
+   /**
+    * Renders the line and title of a role, between the borders of its ends.
+    *
+    * @param renderer the renderer to render to.
+    * @param line the role to render.
+    */
+   static void renderRole(contomap::frontend::MapRenderer &renderer, RoleLine const &line);
+
+private:
+   static size_t const RENDER_PARTS_PER_THREAD;
+   static size_t const MIN_TOPICS_PER_RENDER_PART;
+
+   [[nodiscard]] static contomap::model::Style const &defaultStyle();
+   [[nodiscard]] static contomap::model::Style selectedStyle(contomap::model::Style style);
+   [[nodiscard]] static contomap::model::Style highlightedStyle(contomap::model::Style style);
+   [[nodiscard]] static contomap::model::Style::Color brightenColor(contomap::model::Style::Color base, float factor);
+
+   [[nodiscard]] contomap::infrastructure::InternedString bestTitleFor(contomap::model::Topic const &topic) const;
+
+   contomap::editor::View const &view;
+   contomap::infrastructure::TaskScheduler &scheduler;
+   contomap::frontend::MapClusters mapClusters;
+};
+
+} // namespace contomap::frontend
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <raylib.h>
 
+#include "contomap/infrastructure/InternedString.h"
 #include "contomap/model/Identifier.h"
 #include "contomap/model/Style.h"
 
@@ -28,7 +30,8 @@ public:
     * @param fontSize the font size to use.
     * @param spacing the spacing to use.
     */
-   virtual void renderText(Rectangle area, contomap::model::Style const &style, std::string const &text, Font font, float fontSize, float spacing) = 0;
+   virtual void renderText(
+      Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize, float spacing) = 0;
 
    /**
     * Render an occurrence plate.
@@ -74,6 +77,15 @@ public:
    virtual void renderRoleLine(
       contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) = 0;
    // clang-format on
+
+   /**
+    * Render a glyph that represents several items, which are too small to be rendered individually.
+    *
+    * @param area the area the glyph covers.
+    * @param style the style to use for drawing.
+    * @param itemCount how many items the glyph represents.
+    */
+   virtual void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) = 0;
 };
 
 } // namespace contomap::frontend
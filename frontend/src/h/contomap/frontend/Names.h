@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "contomap/infrastructure/InternedString.h"
 #include "contomap/model/Identifiers.h"
 #include "contomap/model/Topic.h"
 
@@ -19,7 +22,7 @@ public:
     * @param defaultScope the topic identifier that refers to the default scope.
     * @return a list of strings, ordered by priority. Always contains at least one element.
     */
-   static std::vector<std::string> forDisplay(contomap::model::Topic const &topic, contomap::model::Identifier defaultScope);
+   static std::vector<contomap::infrastructure::InternedString> forDisplay(contomap::model::Topic const &topic, contomap::model::Identifier defaultScope);
 
    /**
     * Return a strings that is the best candidate for a scoped display.
@@ -29,7 +32,18 @@ public:
     * @param defaultScope the topic identifier that refers to the default scope.
     * @return a list of strings, ordered by priority. Always contains at least one element.
     */
-   static std::vector<std::string> forScopedDisplay(
+   static std::vector<contomap::infrastructure::InternedString> forScopedDisplay(
+      contomap::model::Topic const &topic, contomap::model::Identifiers const &scope, contomap::model::Identifier defaultScope);
+
+   /**
+    * Return the first entry that forScopedDisplay() would provide, without collecting the others.
+    *
+    * @param topic the topic for which to determine the name
+    * @param scope the current scope to consider.
+    * @param defaultScope the topic identifier that refers to the default scope.
+    * @return the best candidate for a scoped display.
+    */
+   static contomap::infrastructure::InternedString bestForScopedDisplay(
       contomap::model::Topic const &topic, contomap::model::Identifiers const &scope, contomap::model::Identifier defaultScope);
 };
 
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "contomap/frontend/MapRenderer.h"
+
+namespace contomap::frontend
+{
+
+/**
+ * OffsetMapRenderer forwards all render calls to another renderer, with all coordinates moved by an offset.
+ * This allows to display an already rendered list at another position, without rendering it again.
+ */
+class OffsetMapRenderer : public contomap::frontend::MapRenderer
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param nested the renderer to forward to.
+    * @param offset the offset to add to all coordinates.
+    */
+   OffsetMapRenderer(contomap::frontend::MapRenderer &nested, Vector2 offset);
+   ~OffsetMapRenderer() override = default;
+
+   void renderText(Rectangle area, contomap::model::Style const &style, contomap::infrastructure::InternedString const &text, Font font, float fontSize,
+      float spacing) override;
+   void renderOccurrencePlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderAssociationPlate(
+      contomap::model::Identifier id, Rectangle area, contomap::model::Style const &style, Rectangle plate, float lineThickness, bool reified) override;
+   void renderRoleLine(contomap::model::Identifier id, Vector2 a, Vector2 b, contomap::model::Style const &style, float lineThickness, bool reified) override;
+   void renderClusterGlyph(Rectangle area, contomap::model::Style const &style, size_t itemCount) override;
+
+private:
+   [[nodiscard]] Rectangle moved(Rectangle area) const;
+   [[nodiscard]] Vector2 moved(Vector2 point) const;
+
+   contomap::frontend::MapRenderer &nested;
+   Vector2 offset;
+};
+
+} // namespace contomap::frontend
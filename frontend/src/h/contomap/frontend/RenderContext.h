@@ -16,6 +16,12 @@ public:
     */
    static RenderContext fromCurrentState();
 
+   /**
+    * @param contentSize the size of the content within the view.
+    * @return a context for given size, independent of the current UI state.
+    */
+   static RenderContext withContentSize(Vector2 contentSize);
+
    /**
     * @return the size of the content within the view.
     */
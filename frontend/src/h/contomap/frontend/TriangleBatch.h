@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <raylib.h>
+
+namespace contomap::frontend
+{
+
+/**
+ * TriangleBatch collects triangles, with colors per vertex, in contiguous arrays.
+ * This allows to submit many shapes at once, instead of one at a time.
+ *
+ * All shapes are stored in the winding order that raylib considers to be front-facing.
+ */
+class TriangleBatch
+{
+public:
+   /**
+    * Add a triangle with individual colors per vertex.
+    *
+    * @param a the first vertex.
+    * @param colorA the color of the first vertex.
+    * @param b the second vertex.
+    * @param colorB the color of the second vertex.
+    * @param c the third vertex.
+    * @param colorC the color of the third vertex.
+    */
+   void addTriangle(Vector2 a, Color colorA, Vector2 b, Color colorB, Vector2 c, Color colorC);
+
+   /**
+    * Add a triangle of a single color.
+    *
+    * @param a the first vertex.
+    * @param b the second vertex.
+    * @param c the third vertex.
+    * @param color the color of the triangle.
+    */
+   void addTriangle(Vector2 a, Vector2 b, Vector2 c, Color color);
+
+   /**
+    * Add a filled rectangle.
+    *
+    * @param area the area to fill.
+    * @param color the color of the rectangle.
+    */
+   void addRectangle(Rectangle area, Color color);
+
+   /**
+    * Add the outline of a rectangle. The lines are within the given area.
+    *
+    * @param area the area to outline.
+    * @param lineThickness the thickness of the lines.
+    * @param color the color of the lines.
+    */
+   void addRectangleLines(Rectangle area, float lineThickness, Color color);
+
+   /**
+    * Add a triangle strip, with the same semantics as DrawTriangleStrip() of raylib.
+    *
+    * @param points the points of the strip.
+    * @param color the color of the strip.
+    */
+   void addTriangleStrip(std::span<Vector2 const> points, Color color);
+
+   /**
+    * Add a line, which has its color blended from start to end.
+    *
+    * @param a the start of the line.
+    * @param colorA the color at the start.
+    * @param b the end of the line.
+    * @param colorB the color at the end.
+    * @param thickness the thickness of the line.
+    */
+   void addLine(Vector2 a, Color colorA, Vector2 b, Color colorB, float thickness);
+
+   /**
+    * @return true if no triangle was added since the last clear.
+    */
+   [[nodiscard]] bool empty() const;
+
+   /**
+    * @return the amount of vertices in this batch. Always a multiple of three.
+    */
+   [[nodiscard]] size_t vertexCount() const;
+
+   /**
+    * @return the positions of all vertices, three consecutive ones forming a triangle.
+    */
+   [[nodiscard]] std::vector<Vector2> const &getPositions() const;
+
+   /**
+    * @return the colors of all vertices, matching the positions by index.
+    */
+   [[nodiscard]] std::vector<Color> const &getColors() const;
+
+   /**
+    * Removes all triangles. Any allocated memory is kept for reuse.
+    */
+   void clear();
+
+private:
+   void addVertex(Vector2 position, Color color);
+
+   std::vector<Vector2> positions;
+   std::vector<Color> colors;
+};
+
+} // namespace contomap::frontend
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/BatchingMapRenderer.h"
+#include "contomap/frontend/LevelOfDetail.h"
+#include "contomap/model/Style.h"
+
+using contomap::frontend::BatchingMapRenderer;
+using contomap::frontend::LevelOfDetail;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+class BatchingMapRendererTest : public testing::Test
+{
+protected:
+   BatchingMapRendererTest()
+      : renderer(LevelOfDetail::full())
+   {
+   }
+
+   void addOccurrence(Rectangle area)
+   {
+      renderer.renderOccurrencePlate(Identifier::random(), area, style, area, 1.0f, false);
+      renderer.renderText(area, style, text, Font {}, 20.0f, 1.0f);
+   }
+
+   BatchingMapRenderer renderer;
+   Style style;
+   InternedString text;
+};
+
+TEST_F(BatchingMapRendererTest, separateTextsAreSubmittedAfterAllShapesOfTheLayer)
+{
+   addOccurrence(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 20.0f });
+   addOccurrence(Rectangle { .x = 0.0f, .y = 50.0f, .width = 100.0f, .height = 20.0f });
+   renderer.flush();
+
+   auto statistics = renderer.getStatistics();
+   EXPECT_EQ(0, statistics.overlapFlushCount);
+   EXPECT_EQ(3, statistics.drawCallCount);
+}
+
+TEST_F(BatchingMapRendererTest, shapeOverlappingPendingTextIsSubmittedAfterIt)
+{
+   addOccurrence(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 20.0f });
+   addOccurrence(Rectangle { .x = 50.0f, .y = 10.0f, .width = 100.0f, .height = 20.0f });
+   renderer.flush();
+
+   auto statistics = renderer.getStatistics();
+   EXPECT_EQ(1, statistics.overlapFlushCount);
+   EXPECT_EQ(4, statistics.drawCallCount);
+}
+
+TEST_F(BatchingMapRendererTest, textOverlappingPendingTextIsSubmittedAfterIt)
+{
+   renderer.renderText(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 20.0f }, style, text, Font {}, 20.0f, 1.0f);
+   renderer.renderText(Rectangle { .x = 90.0f, .y = 0.0f, .width = 100.0f, .height = 20.0f }, style, text, Font {}, 20.0f, 1.0f);
+   renderer.flush();
+
+   EXPECT_EQ(1, renderer.getStatistics().overlapFlushCount);
+}
+
+TEST_F(BatchingMapRendererTest, shapesBetweenManyPendingTextsAreSubmittedWithThem)
+{
+   for (size_t i = 0; i < 100; i++)
+   {
+      auto offset = static_cast<float>(i);
+      addOccurrence(Rectangle { .x = offset * 200.0f, .y = offset * 50.0f, .width = 100.0f, .height = 20.0f });
+   }
+   renderer.flush();
+
+   EXPECT_EQ(0, renderer.getStatistics().overlapFlushCount);
+}
+
+TEST_F(BatchingMapRendererTest, shapeOverlappingPendingTextFarAwayIsSubmittedAfterIt)
+{
+   addOccurrence(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 20.0f });
+   addOccurrence(Rectangle { .x = 20000.0f, .y = -20000.0f, .width = 100.0f, .height = 20.0f });
+   addOccurrence(Rectangle { .x = 19950.0f, .y = -19990.0f, .width = 100.0f, .height = 20.0f });
+   renderer.flush();
+
+   EXPECT_EQ(1, renderer.getStatistics().overlapFlushCount);
+}
@@ -0,0 +1,101 @@
+#include <stdexcept>
+
+#include <gmock/gmock.h>
+
+#include "contomap/editor/Editor.h"
+#include "contomap/frontend/EditBuffer.h"
+#include "contomap/frontend/MapCamera.h"
+
+#include "contomap/test/fixtures/ContomapViewFixture.h"
+#include "contomap/test/samples/CoordinateSamples.h"
+#include "contomap/test/samples/TopicNameSamples.h"
+
+using contomap::editor::Editor;
+using contomap::editor::InputRequestHandler;
+using contomap::frontend::EditBuffer;
+using contomap::frontend::MapCamera;
+using contomap::test::fixtures::ContomapViewFixture;
+using contomap::test::samples::someNameValue;
+using contomap::test::samples::someSpacialCoordinate;
+
+class EditBufferTest : public testing::Test
+{
+public:
+   EditBufferTest()
+      : camera(std::make_shared<MapCamera::ImmediateGearbox>())
+      , instance(editor, camera)
+      , map(editor.ofMap())
+   {
+   }
+
+protected:
+   Editor editor;
+   MapCamera camera;
+   EditBuffer instance;
+   ContomapViewFixture map;
+};
+
+TEST_F(EditBufferTest, batchIsUndoneAsOneOperation)
+{
+   instance.newTopicRequested(someNameValue(), someSpacialCoordinate());
+   instance.performBatch([](InputRequestHandler &handler) {
+      for (int i = 0; i < 3; i++)
+      {
+         handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      }
+   });
+   map.shouldHaveTopicCountOf(5);
+
+   instance.undo();
+   map.shouldHaveTopicCountOf(2);
+   instance.redo();
+   map.shouldHaveTopicCountOf(5);
+}
+
+TEST_F(EditBufferTest, failingBatchIsNotRecorded)
+{
+   instance.newTopicRequested(someNameValue(), someSpacialCoordinate());
+   auto revision = instance.getRevision();
+   auto failingOperations = [](InputRequestHandler &handler) {
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      throw std::runtime_error("aborted");
+   };
+   EXPECT_THROW(instance.performBatch(failingOperations), std::runtime_error);
+   map.shouldHaveTopicCountOf(2);
+   EXPECT_EQ(revision, instance.getRevision());
+
+   instance.undo();
+   map.shouldHaveTopicCountOf(1);
+}
+
+TEST_F(EditBufferTest, failingBatchAfterUndoRestoresTheUndoneState)
+{
+   instance.newTopicRequested(someNameValue(), someSpacialCoordinate());
+   instance.newTopicRequested(someNameValue(), someSpacialCoordinate());
+   instance.undo();
+   map.shouldHaveTopicCountOf(2);
+
+   EXPECT_THROW(instance.performBatch([](InputRequestHandler &handler) {
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      throw std::runtime_error("aborted");
+   }),
+      std::runtime_error);
+   map.shouldHaveTopicCountOf(2);
+
+   instance.redo();
+   map.shouldHaveTopicCountOf(3);
+}
+
+TEST_F(EditBufferTest, failingBatchKeepsTheCurrentSelection)
+{
+   instance.newTopicRequested(someNameValue(), someSpacialCoordinate());
+   instance.clearSelection();
+
+   EXPECT_THROW(instance.performBatch([](InputRequestHandler &handler) {
+      handler.newTopicRequested(someNameValue(), someSpacialCoordinate());
+      throw std::runtime_error("aborted");
+   }),
+      std::runtime_error);
+   map.shouldHaveTopicCountOf(2);
+   EXPECT_TRUE(editor.ofSelection().empty());
+}
@@ -2,9 +2,12 @@
 
 #include "contomap/frontend/Geometry.h"
 
+using contomap::frontend::geometry::boxSpanning;
 using contomap::frontend::geometry::centerOf;
+using contomap::frontend::geometry::encloses;
 using contomap::frontend::geometry::intersectLineIntoBoxCenter;
 using contomap::frontend::geometry::intersectLines;
+using contomap::frontend::geometry::overlaps;
 
 MATCHER_P(isCloseTo, expected, "")
 {
@@ -23,6 +26,15 @@ TEST(GeometryTest, centerOfRectangle)
    EXPECT_THAT(centerOf(Rectangle { .x = -5.0f, .y = -10.0f, .width = 10.0f, .height = 20.0f }), isCloseTo(Vector2 { .x = 0.0f, .y = 0.0f }));
 }
 
+TEST(GeometryTest, boxSpanningCorners)
+{
+   auto box = boxSpanning(Vector2 { .x = 10.0f, .y = -5.0f }, Vector2 { .x = -2.0f, .y = 3.0f });
+   EXPECT_FLOAT_EQ(-2.0f, box.x);
+   EXPECT_FLOAT_EQ(-5.0f, box.y);
+   EXPECT_FLOAT_EQ(12.0f, box.width);
+   EXPECT_FLOAT_EQ(8.0f, box.height);
+}
+
 TEST(GeometryTest, intersectLines)
 {
    auto line1 = std::make_tuple(Vector2 { .x = 1.0f, .y = 1.0f }, Vector2 { .x = 10.0f, .y = 1.0f });
@@ -57,3 +69,22 @@ TEST(GeometryTest, intersectLineIntoBoxCenter)
 
    EXPECT_THAT(intersectLineIntoBoxCenter(Vector2 { .x = 0.0f, .y = 0.0f }, box).value(), isCloseTo(Vector2 { .x = 1.0f, .y = 1.0f })) << "at corner";
 }
+
+TEST(GeometryTest, overlappingAreas)
+{
+   Rectangle area { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f };
+   EXPECT_TRUE(overlaps(area, Rectangle { .x = 5.0f, .y = 5.0f, .width = 10.0f, .height = 10.0f }));
+   EXPECT_TRUE(overlaps(area, Rectangle { .x = 2.0f, .y = 2.0f, .width = 1.0f, .height = 1.0f }));
+   EXPECT_FALSE(overlaps(area, Rectangle { .x = 10.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f }));
+   EXPECT_FALSE(overlaps(area, Rectangle { .x = 0.0f, .y = -20.0f, .width = 10.0f, .height = 10.0f }));
+}
+
+TEST(GeometryTest, enclosedAreas)
+{
+   Rectangle area { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f };
+   EXPECT_TRUE(encloses(area, Rectangle { .x = 2.0f, .y = 2.0f, .width = 1.0f, .height = 1.0f }));
+   EXPECT_TRUE(encloses(area, area)) << "same area";
+   EXPECT_FALSE(encloses(area, Rectangle { .x = 5.0f, .y = 5.0f, .width = 10.0f, .height = 1.0f })) << "beyond right edge";
+   EXPECT_FALSE(encloses(area, Rectangle { .x = 2.0f, .y = -1.0f, .width = 1.0f, .height = 5.0f })) << "beyond top edge";
+   EXPECT_FALSE(encloses(Rectangle { .x = 2.0f, .y = 2.0f, .width = 1.0f, .height = 1.0f }, area)) << "inverted";
+}
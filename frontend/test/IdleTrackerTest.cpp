@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/IdleTracker.h"
+
+using contomap::frontend::IdleTracker;
+
+TEST(IdleTrackerTest, becomesIdleAfterSettlingFrames)
+{
+   IdleTracker tracker;
+   EXPECT_FALSE(tracker.isIdle()) << "initially";
+   for (size_t i = 0; i < IdleTracker::SETTLING_FRAME_COUNT; i++)
+   {
+      EXPECT_FALSE(tracker.isIdle()) << "frame " << i;
+      tracker.frameDone(false);
+   }
+   EXPECT_TRUE(tracker.isIdle());
+}
+
+TEST(IdleTrackerTest, changesRestartSettling)
+{
+   IdleTracker tracker;
+   for (size_t i = 0; i < IdleTracker::SETTLING_FRAME_COUNT - 1; i++)
+   {
+      tracker.frameDone(false);
+   }
+   tracker.frameDone(true);
+   for (size_t i = 0; i < IdleTracker::SETTLING_FRAME_COUNT - 1; i++)
+   {
+      tracker.frameDone(false);
+   }
+   EXPECT_FALSE(tracker.isIdle());
+   tracker.frameDone(false);
+   EXPECT_TRUE(tracker.isIdle());
+}
+
+TEST(IdleTrackerTest, frameAfterIdleCountsAsWokenByInput)
+{
+   IdleTracker tracker;
+   for (size_t i = 0; i < IdleTracker::SETTLING_FRAME_COUNT; i++)
+   {
+      tracker.frameDone(false);
+   }
+   ASSERT_TRUE(tracker.isIdle());
+   tracker.frameDone(false);
+   EXPECT_FALSE(tracker.isIdle()) << "input may have changed the state, so the frame needs to settle";
+}
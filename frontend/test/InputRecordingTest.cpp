@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/InputRecording.h"
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+
+using contomap::frontend::FrameTime;
+using contomap::frontend::InputFrame;
+using contomap::frontend::InputRecording;
+using contomap::infrastructure::serial::BinaryDecoder;
+using contomap::infrastructure::serial::BinaryEncoder;
+
+TEST(InputRecordingTest, framesAreRestoredFromEncodedData)
+{
+   InputRecording recording(0x89ABCDEF);
+   recording.add(InputFrame::idleFor(FrameTime::fromSeconds(0.016f)));
+   recording.add(InputFrame::idleFor(FrameTime::fromSeconds(0.020f))
+         .withContentSize(Vector2 { .x = 1024.0f, .y = 768.0f })
+         .withMouse(Vector2 { .x = 10.5f, .y = -3.0f }, true, true)
+         .withMouseWheelMove(-1.0f)
+         .withKey(KEY_LEFT_CONTROL, true, false, false)
+         .withKey(KEY_DELETE, false, false, true)
+         .withKey(KEY_ESCAPE, true, true, false));
+
+   BinaryEncoder encoder;
+   recording.encode(encoder);
+   auto const &data = encoder.getData();
+   BinaryDecoder decoder(data.data(), data.data() + data.size());
+   InputRecording restored;
+   ASSERT_TRUE(restored.decode(decoder));
+
+   EXPECT_EQ(0x89ABCDEF, restored.getIdentifierSeed());
+   ASSERT_EQ(2, restored.getFrames().size());
+   auto const &idle = restored.getFrames()[0];
+   EXPECT_FLOAT_EQ(0.016f, idle.getFrameTime().rawSeconds());
+   EXPECT_FALSE(idle.isMouseButtonDown());
+   EXPECT_FALSE(idle.isKeyDown(KEY_LEFT_CONTROL));
+
+   auto const &active = restored.getFrames()[1];
+   EXPECT_FLOAT_EQ(0.020f, active.getFrameTime().rawSeconds());
+   EXPECT_FLOAT_EQ(1024.0f, active.getContentSize().x);
+   EXPECT_FLOAT_EQ(768.0f, active.getContentSize().y);
+   EXPECT_FLOAT_EQ(10.5f, active.getMousePosition().x);
+   EXPECT_FLOAT_EQ(-3.0f, active.getMousePosition().y);
+   EXPECT_FLOAT_EQ(-1.0f, active.getMouseWheelMove());
+   EXPECT_TRUE(active.isMouseButtonDown());
+   EXPECT_TRUE(active.isMouseButtonPressed());
+   EXPECT_TRUE(active.isKeyDown(KEY_LEFT_CONTROL));
+   EXPECT_FALSE(active.isKeyPressed(KEY_LEFT_CONTROL));
+   EXPECT_TRUE(active.isKeyReleased(KEY_DELETE));
+   EXPECT_FALSE(active.isKeyDown(KEY_DELETE));
+   EXPECT_TRUE(active.isKeyDown(KEY_ESCAPE));
+   EXPECT_TRUE(active.isKeyPressed(KEY_ESCAPE));
+}
+
+TEST(InputRecordingTest, unobservedKeysAreNeverReported)
+{
+   EXPECT_FALSE(InputFrame::isObserved(KEY_Z));
+   auto frame = InputFrame::idleFor(FrameTime::fromSeconds(0.0f)).withKey(KEY_Z, true, true, true);
+   EXPECT_FALSE(frame.isKeyDown(KEY_Z));
+   EXPECT_FALSE(frame.isKeyPressed(KEY_Z));
+   EXPECT_FALSE(frame.isKeyReleased(KEY_Z));
+}
+
+TEST(InputRecordingTest, truncatedDataIsRejected)
+{
+   InputRecording recording;
+   recording.add(InputFrame::idleFor(FrameTime::fromSeconds(0.016f)).withKey(KEY_HOME, true, true, false));
+   BinaryEncoder encoder;
+   recording.encode(encoder);
+   auto const &data = encoder.getData();
+   BinaryDecoder decoder(data.data(), data.data() + data.size() - 1);
+
+   InputRecording restored;
+   EXPECT_FALSE(restored.decode(decoder));
+   EXPECT_TRUE(restored.getFrames().empty());
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/LevelOfDetail.h"
+
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::MapCamera;
+
+TEST(LevelOfDetailTest, fullDetailShowsEverything)
+{
+   auto detail = LevelOfDetail::full();
+   EXPECT_TRUE(detail.showsTextOfSize(1.0f));
+   EXPECT_TRUE(detail.showsDecorations());
+   EXPECT_FALSE(detail.aggregatesIntoClusters());
+}
+
+TEST(LevelOfDetailTest, unitZoomShowsEverythingOfRegularSize)
+{
+   auto detail = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::UNIT);
+   EXPECT_TRUE(detail.showsTextOfSize(10.0f));
+   EXPECT_TRUE(detail.showsDecorations());
+   EXPECT_FALSE(detail.aggregatesIntoClusters());
+}
+
+TEST(LevelOfDetailTest, smallTextIsHiddenFirst)
+{
+   auto detail = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::from(0.25f));
+   EXPECT_FALSE(detail.showsTextOfSize(10.0f));
+   EXPECT_TRUE(detail.showsTextOfSize(40.0f));
+   EXPECT_FALSE(detail.aggregatesIntoClusters());
+}
+
+TEST(LevelOfDetailTest, farLimitAggregatesIntoClusters)
+{
+   auto detail = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::FAR_LIMIT);
+   EXPECT_FALSE(detail.showsTextOfSize(16.0f));
+   EXPECT_FALSE(detail.showsDecorations());
+   EXPECT_TRUE(detail.aggregatesIntoClusters());
+}
+
+TEST(LevelOfDetailTest, clusterCellsGrowWithDistance)
+{
+   auto nearer = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::from(0.1f));
+   auto farther = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::from(0.01f));
+   EXPECT_GT(farther.clusterCellSize(), nearer.clusterCellSize());
+}
+
+TEST(LevelOfDetailTest, illegibleTextIsEstimated)
+{
+   auto detail = LevelOfDetail::forZoomFactor(MapCamera::ZoomFactor::FAR_LIMIT);
+   auto shortSize = detail.measureText(Font {}, "abc", 16.0f, 1.0f);
+   auto longSize = detail.measureText(Font {}, "abcdef", 16.0f, 1.0f);
+   EXPECT_NEAR(16.0f, shortSize.y, 0.001f);
+   EXPECT_GT(longSize.x, shortSize.x);
+   EXPECT_NEAR(0.0f, detail.measureText(Font {}, "", 16.0f, 1.0f).x, 0.001f);
+}
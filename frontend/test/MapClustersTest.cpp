@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "contomap/editor/Selection.h"
+#include "contomap/frontend/MapClusters.h"
+#include "contomap/model/Contomap.h"
+
+using contomap::editor::SelectedType;
+using contomap::editor::Selection;
+using contomap::frontend::MapClusters;
+using contomap::model::Contomap;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::SpacialCoordinate;
+
+class MapClustersTest : public testing::Test
+{
+protected:
+   MapClustersTest()
+      : map(Contomap::newMap())
+      , topic(map.newTopic())
+   {
+   }
+
+   Identifier addOccurrence(float x, float y)
+   {
+      return topic.newOccurrence(Identifiers::ofSingle(map.getDefaultScope()), SpacialCoordinate::absoluteAt(x, y)).getId();
+   }
+
+   void collect(Rectangle visibleArea, SpacialCoordinate::Offset offset = SpacialCoordinate::Offset::of(0.0f, 0.0f))
+   {
+      auto scopeSelection = map.getScopes().selectWithin(Identifiers::ofSingle(map.getDefaultScope()));
+      clusters.collect(map, *scopeSelection, selection, offset, visibleArea, 10.0f);
+   }
+
+   Contomap map;
+   contomap::model::Topic &topic;
+   Selection selection;
+   MapClusters clusters;
+};
+
+TEST_F(MapClustersTest, itemsOfOneCellFormOneClusterAtTheirAverage)
+{
+   static_cast<void>(addOccurrence(1.0f, 1.0f));
+   static_cast<void>(addOccurrence(3.0f, 5.0f));
+   static_cast<void>(map.newAssociation(Identifiers::ofSingle(map.getDefaultScope()), SpacialCoordinate::absoluteAt(15.0f, 5.0f)));
+
+   collect(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f });
+
+   auto const &result = clusters.getClusters();
+   ASSERT_EQ(2, result.size());
+   EXPECT_FLOAT_EQ(2.0f, result[0].center.x);
+   EXPECT_FLOAT_EQ(3.0f, result[0].center.y);
+   EXPECT_EQ(2, result[0].count);
+   EXPECT_FALSE(result[0].containsSelection);
+   EXPECT_FLOAT_EQ(15.0f, result[1].center.x);
+   EXPECT_EQ(1, result[1].count);
+}
+
+TEST_F(MapClustersTest, itemsOutsideTheVisibleCellsAreIgnored)
+{
+   static_cast<void>(addOccurrence(-5.0f, 5.0f));
+   static_cast<void>(addOccurrence(25.0f, 5.0f));
+   static_cast<void>(addOccurrence(500.0f, 5.0f));
+
+   collect(Rectangle { .x = 2.0f, .y = 2.0f, .width = 16.0f, .height = 6.0f });
+
+   auto const &result = clusters.getClusters();
+   EXPECT_TRUE(result.empty());
+}
+
+TEST_F(MapClustersTest, itemsOfPartiallyVisibleCellsAreConsidered)
+{
+   static_cast<void>(addOccurrence(11.0f, 1.0f));
+   static_cast<void>(addOccurrence(19.0f, 9.0f));
+
+   collect(Rectangle { .x = 2.0f, .y = 2.0f, .width = 10.0f, .height = 2.0f });
+
+   auto const &result = clusters.getClusters();
+   ASSERT_EQ(1, result.size());
+   EXPECT_FLOAT_EQ(15.0f, result[0].center.x);
+   EXPECT_EQ(2, result[0].count);
+}
+
+TEST_F(MapClustersTest, itemsOutsideTheViewScopeAreIgnored)
+{
+   auto &scopeTopic = map.newTopic();
+   static_cast<void>(topic.newOccurrence(Identifiers::ofSingle(scopeTopic.getId()), SpacialCoordinate::absoluteAt(5.0f, 5.0f)));
+
+   collect(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f });
+
+   EXPECT_TRUE(clusters.getClusters().empty());
+}
+
+TEST_F(MapClustersTest, draggedItemsAreConsideredWhereTheyAreMovedTo)
+{
+   auto movedInId = addOccurrence(505.0f, 505.0f);
+   auto movedOutId = addOccurrence(5.0f, 5.0f);
+   static_cast<void>(addOccurrence(6.0f, 6.0f));
+   selection.add(SelectedType::Occurrence, movedInId);
+   selection.add(SelectedType::Occurrence, movedOutId);
+
+   collect(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f }, SpacialCoordinate::Offset::of(-500.0f, -500.0f));
+
+   auto const &result = clusters.getClusters();
+   ASSERT_EQ(1, result.size());
+   EXPECT_EQ(2, result[0].count);
+   EXPECT_FLOAT_EQ(5.5f, result[0].center.x);
+   EXPECT_TRUE(result[0].containsSelection);
+}
+
+TEST_F(MapClustersTest, collectionReplacesThePreviousClusters)
+{
+   static_cast<void>(addOccurrence(5.0f, 5.0f));
+   static_cast<void>(addOccurrence(205.0f, 5.0f));
+
+   collect(Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f });
+   collect(Rectangle { .x = 200.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f });
+
+   auto const &result = clusters.getClusters();
+   ASSERT_EQ(1, result.size());
+   EXPECT_FLOAT_EQ(205.0f, result[0].center.x);
+}
+
+TEST_F(MapClustersTest, itemsWithinAreaAreCollectedAsSelection)
+{
+   auto insideId = addOccurrence(5.0f, 5.0f);
+   static_cast<void>(addOccurrence(500.0f, 5.0f));
+   auto associationId = map.newAssociation(Identifiers::ofSingle(map.getDefaultScope()), SpacialCoordinate::absoluteAt(20.0f, 20.0f)).getId();
+   auto &scopeTopic = map.newTopic();
+   auto otherScopeId = topic.newOccurrence(Identifiers::ofSingle(scopeTopic.getId()), SpacialCoordinate::absoluteAt(6.0f, 6.0f)).getId();
+
+   Selection items;
+   auto scopeSelection = map.getScopes().selectWithin(Identifiers::ofSingle(map.getDefaultScope()));
+   MapClusters::collectWithin(map, *scopeSelection, Rectangle { .x = 0.0f, .y = 0.0f, .width = 30.0f, .height = 30.0f }, items);
+
+   EXPECT_TRUE(items.contains(SelectedType::Occurrence, insideId));
+   EXPECT_TRUE(items.contains(SelectedType::Association, associationId));
+   EXPECT_FALSE(items.contains(SelectedType::Occurrence, otherScopeId));
+   EXPECT_EQ(2, items.of(SelectedType::Occurrence).size() + items.of(SelectedType::Association).size());
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/MapHitIndex.h"
+#include "contomap/model/Style.h"
+
+using contomap::editor::SelectedType;
+using contomap::frontend::FocusItem;
+using contomap::frontend::MapHitIndex;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+class MapHitIndexTest : public testing::Test
+{
+protected:
+   void addOccurrence(Identifier id, Rectangle area)
+   {
+      index.renderOccurrencePlate(id, area, style, area, 1.0f, false);
+   }
+
+   void addAssociation(Identifier id, Rectangle area)
+   {
+      index.renderAssociationPlate(id, area, style, area, 1.0f, false);
+   }
+
+   void addRole(Identifier id, Vector2 a, Vector2 b)
+   {
+      index.renderRoleLine(id, a, b, style, 1.0f, false);
+   }
+
+   MapHitIndex index;
+   Style style;
+};
+
+TEST_F(MapHitIndexTest, emptyIndexFocusesNothing)
+{
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 0.0f, .y = 0.0f }).hasNoItem());
+}
+
+TEST_F(MapHitIndexTest, plateIsFocusedWithinItsArea)
+{
+   auto id = Identifier::random();
+   addOccurrence(id, Rectangle { .x = -10.0f, .y = -10.0f, .width = 20.0f, .height = 20.0f });
+
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 5.0f, .y = 5.0f }).isOccurrence(id));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 15.0f, .y = 5.0f }).hasNoItem());
+}
+
+TEST_F(MapHitIndexTest, closestPlateCenterWins)
+{
+   auto farId = Identifier::random();
+   auto nearId = Identifier::random();
+   addAssociation(farId, Rectangle { .x = 0.0f, .y = 0.0f, .width = 100.0f, .height = 100.0f });
+   addOccurrence(nearId, Rectangle { .x = 60.0f, .y = 60.0f, .width = 20.0f, .height = 20.0f });
+
+   auto focus = index.focusAt(Vector2 { .x = 65.0f, .y = 65.0f });
+   EXPECT_TRUE(focus.isOccurrence(nearId));
+   EXPECT_FALSE(focus.isAssociation(farId));
+}
+
+TEST_F(MapHitIndexTest, rolesTakePrecedence)
+{
+   auto plateId = Identifier::random();
+   auto roleId = Identifier::random();
+   addRole(roleId, Vector2 { .x = 0.0f, .y = 50.0f }, Vector2 { .x = 100.0f, .y = 50.0f });
+   addOccurrence(plateId, Rectangle { .x = 40.0f, .y = 40.0f, .width = 20.0f, .height = 20.0f });
+
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 45.0f, .y = 52.0f }).isRole(roleId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 45.0f, .y = 58.0f }).isOccurrence(plateId));
+}
+
+TEST_F(MapHitIndexTest, longRolesAreFoundAcrossCells)
+{
+   auto roleId = Identifier::random();
+   addRole(roleId, Vector2 { .x = -1000.0f, .y = -1000.0f }, Vector2 { .x = 1000.0f, .y = 1000.0f });
+
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 700.0f, .y = 702.0f }).isRole(roleId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = -500.0f, .y = -498.0f }).isRole(roleId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 700.0f, .y = 600.0f }).hasNoItem());
+}
+
+TEST_F(MapHitIndexTest, rolesAreFoundWithinToleranceAcrossCellBorders)
+{
+   auto verticalId = Identifier::random();
+   auto steepId = Identifier::random();
+   auto shallowId = Identifier::random();
+   addRole(verticalId, Vector2 { .x = 126.0f, .y = -300.0f }, Vector2 { .x = 126.0f, .y = 300.0f });
+   addRole(steepId, Vector2 { .x = 1000.0f, .y = 0.0f }, Vector2 { .x = 1010.0f, .y = 2000.0f });
+   addRole(shallowId, Vector2 { .x = -3000.0f, .y = 253.0f }, Vector2 { .x = -100.0f, .y = 258.0f });
+
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 129.0f, .y = 200.0f }).isRole(verticalId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 1008.0f, .y = 1500.0f }).isRole(steepId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = -1500.0f, .y = 259.0f }).isRole(shallowId));
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 1100.0f, .y = 1500.0f }).hasNoItem());
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = -1500.0f, .y = 100.0f }).hasNoItem());
+}
+
+TEST_F(MapHitIndexTest, rectangleQueryReturnsEachOverlappingItemOnce)
+{
+   auto insideId = Identifier::random();
+   auto outsideId = Identifier::random();
+   auto roleId = Identifier::random();
+   addOccurrence(insideId, Rectangle { .x = 100.0f, .y = 100.0f, .width = 300.0f, .height = 300.0f });
+   addOccurrence(outsideId, Rectangle { .x = 1000.0f, .y = 1000.0f, .width = 10.0f, .height = 10.0f });
+   addRole(roleId, Vector2 { .x = -500.0f, .y = 50.0f }, Vector2 { .x = 500.0f, .y = 50.0f });
+
+   auto items = index.itemsIntersecting(Rectangle { .x = 0.0f, .y = 0.0f, .width = 500.0f, .height = 500.0f });
+   ASSERT_EQ(2, items.size());
+   EXPECT_EQ((FocusItem { .type = SelectedType::Occurrence, .id = insideId }), items[0]);
+   EXPECT_EQ((FocusItem { .type = SelectedType::Role, .id = roleId }), items[1]);
+}
+
+TEST_F(MapHitIndexTest, platesWithinAreaExcludeCrossingRolesAndPartialPlates)
+{
+   auto insideId = Identifier::random();
+   auto partialId = Identifier::random();
+   auto associationId = Identifier::random();
+   addOccurrence(insideId, Rectangle { .x = 100.0f, .y = 100.0f, .width = 100.0f, .height = 50.0f });
+   addOccurrence(partialId, Rectangle { .x = 450.0f, .y = 100.0f, .width = 100.0f, .height = 50.0f });
+   addAssociation(associationId, Rectangle { .x = 300.0f, .y = 300.0f, .width = 50.0f, .height = 50.0f });
+   addRole(Identifier::random(), Vector2 { .x = -500.0f, .y = 50.0f }, Vector2 { .x = 1000.0f, .y = 50.0f });
+   addRole(Identifier::random(), Vector2 { .x = 150.0f, .y = 125.0f }, Vector2 { .x = 325.0f, .y = 325.0f });
+
+   auto items = index.platesWithin(Rectangle { .x = 0.0f, .y = 0.0f, .width = 500.0f, .height = 500.0f });
+   ASSERT_EQ(2, items.size());
+   EXPECT_EQ((FocusItem { .type = SelectedType::Occurrence, .id = insideId }), items[0]);
+   EXPECT_EQ((FocusItem { .type = SelectedType::Association, .id = associationId }), items[1]);
+}
+
+TEST_F(MapHitIndexTest, clearRemovesAllItems)
+{
+   addOccurrence(Identifier::random(), Rectangle { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f });
+   index.clear();
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(index.itemsIntersecting(Rectangle { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f }).empty());
+}
+
+TEST_F(MapHitIndexTest, clusterGlyphsAreNotFocusable)
+{
+   Rectangle glyph { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f };
+   index.renderClusterGlyph(glyph, style, 20);
+
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 5.0f, .y = 5.0f }).hasNoItem());
+   EXPECT_TRUE(index.itemsIntersecting(glyph).empty());
+}
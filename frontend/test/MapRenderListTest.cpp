@@ -0,0 +1,117 @@
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include "contomap/frontend/MapRenderList.h"
+
+using contomap::frontend::MapRenderer;
+using contomap::infrastructure::MemoryAccount;
+using contomap::frontend::MapRenderList;
+using contomap::infrastructure::InternedString;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+class RecordingRenderer : public MapRenderer
+{
+public:
+   void renderText(Rectangle, Style const &, InternedString const &text, Font, float, float) override
+   {
+      calls.emplace_back("text " + text.str());
+   }
+
+   void renderOccurrencePlate(Identifier, Rectangle area, Style const &, Rectangle, float, bool) override
+   {
+      calls.emplace_back("occurrence " + std::to_string(static_cast<int>(area.x)));
+   }
+
+   void renderAssociationPlate(Identifier, Rectangle area, Style const &, Rectangle, float, bool) override
+   {
+      calls.emplace_back("association " + std::to_string(static_cast<int>(area.x)));
+   }
+
+   void renderRoleLine(Identifier, Vector2 a, Vector2, Style const &, float, bool) override
+   {
+      calls.emplace_back("role " + std::to_string(static_cast<int>(a.x)));
+   }
+
+   void renderClusterGlyph(Rectangle, Style const &, size_t) override
+   {
+      calls.emplace_back("cluster");
+   }
+
+   std::vector<std::string> calls;
+};
+
+static void renderOccurrenceWithRole(MapRenderList &list, float x)
+{
+   Rectangle area { .x = x, .y = 0.0f, .width = 1.0f, .height = 1.0f };
+   list.renderRoleLine(Identifier::random(), Vector2 { .x = x, .y = 0.0f }, Vector2 { .x = 0.0f, .y = 0.0f }, Style(), 1.0f, false);
+   list.renderOccurrencePlate(Identifier::random(), area, Style(), area, 1.0f, false);
+   list.renderText(area, Style(), InternedString::of(std::to_string(static_cast<int>(x))), Font {}, 10.0f, 1.0f);
+}
+
+TEST(MapRenderListTest, optimizeSortsByLayerAndKeepsOrderWithinLayers)
+{
+   MapRenderList list;
+   Rectangle area { .x = 0.0f, .y = 0.0f, .width = 1.0f, .height = 1.0f };
+   list.renderAssociationPlate(Identifier::random(), area, Style(), area, 1.0f, false);
+   renderOccurrenceWithRole(list, 1.0f);
+   renderOccurrenceWithRole(list, 2.0f);
+   list.optimize();
+
+   RecordingRenderer renderer;
+   list.renderTo(renderer);
+   EXPECT_THAT(renderer.calls, testing::ElementsAre("role 1", "role 2", "association 0", "occurrence 1", "text 1", "occurrence 2", "text 2"));
+}
+
+TEST(MapRenderListTest, appendedListsRenderAsIfRenderedInSequence)
+{
+   MapRenderList sequential;
+   MapRenderList combined;
+   MapRenderList first;
+   MapRenderList second;
+   for (float x : { 1.0f, 2.0f })
+   {
+      renderOccurrenceWithRole(sequential, x);
+      renderOccurrenceWithRole(first, x);
+   }
+   for (float x : { 3.0f, 4.0f })
+   {
+      renderOccurrenceWithRole(sequential, x);
+      renderOccurrenceWithRole(second, x);
+   }
+   combined.append(std::move(first));
+   combined.append(std::move(second));
+   sequential.optimize();
+   combined.optimize();
+
+   RecordingRenderer expected;
+   sequential.renderTo(expected);
+   RecordingRenderer actual;
+   combined.renderTo(actual);
+   EXPECT_EQ(expected.calls, actual.calls);
+   EXPECT_EQ(12, actual.calls.size());
+
+   RecordingRenderer leftover;
+   second.renderTo(leftover); // NOLINT(bugprone-use-after-move)
+   EXPECT_TRUE(leftover.calls.empty());
+}
+
+TEST(MapRenderListTest, memoryStaysWithinBudgetAndIsReleased)
+{
+   auto &account = MemoryAccount::of<MapRenderList::MemoryTag>();
+   auto before = account.snapshot();
+   {
+      MapRenderList list;
+      for (int i = 0; i < 100; i++)
+      {
+         renderOccurrenceWithRole(list, static_cast<float>(i));
+      }
+      list.optimize();
+      auto held = account.snapshot().liveBytes - before.liveBytes;
+      EXPECT_GT(held, 0);
+      EXPECT_LE(held / 100, 1024) << "an occurrence with its role and text should take at most 1 KiB";
+   }
+   EXPECT_EQ(before.liveBytes, account.snapshot().liveBytes);
+}
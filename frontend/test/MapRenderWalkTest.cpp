@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "contomap/editor/Editor.h"
+#include "contomap/editor/Selection.h"
+#include "contomap/frontend/MapRenderCounter.h"
+#include "contomap/frontend/MapRenderWalk.h"
+#include "contomap/infrastructure/CoroutineFramePool.h"
+#include "contomap/infrastructure/MemoryAccount.h"
+#include "contomap/infrastructure/TaskScheduler.h"
+
+#include "contomap/test/samples/TopicNameSamples.h"
+
+using contomap::editor::Editor;
+using contomap::editor::SelectedType;
+using contomap::editor::Selection;
+using contomap::editor::SelectionAction;
+using contomap::frontend::Focus;
+using contomap::frontend::LevelOfDetail;
+using contomap::frontend::MapRenderCounter;
+using contomap::frontend::MapRenderWalk;
+using contomap::infrastructure::CoroutineFramePool;
+using contomap::infrastructure::MemoryAccount;
+using contomap::infrastructure::TaskScheduler;
+using contomap::model::Identifier;
+using contomap::model::SpacialCoordinate;
+using contomap::test::samples::someNameValue;
+
+class MapRenderWalkTest : public testing::Test
+{
+protected:
+   MapRenderWalkTest()
+      : scheduler(2)
+      , walk(editor, scheduler)
+   {
+   }
+
+   Identifier newOccurrenceAt(float x, float y)
+   {
+      static_cast<void>(editor.newTopicRequested(someNameValue(), SpacialCoordinate::absoluteAt(x, y)));
+      return *editor.ofSelection().of(SelectedType::Occurrence).begin();
+   }
+
+   Identifier newLinkedPairAt(float x, float y)
+   {
+      Selection pair;
+      pair.add(SelectedType::Occurrence, newOccurrenceAt(x, y));
+      auto secondId = newOccurrenceAt(x + 200.0f, y);
+      pair.add(SelectedType::Occurrence, secondId);
+      editor.modifySelection(pair, SelectionAction::Set);
+      editor.linkSelection();
+      editor.clearSelection();
+      return secondId;
+   }
+
+   static MapRenderCounter countOf(contomap::frontend::MapRenderList const &list)
+   {
+      MapRenderCounter counter;
+      list.renderTo(counter);
+      return counter;
+   }
+
+   Editor editor;
+   TaskScheduler scheduler;
+   MapRenderWalk walk;
+};
+
+TEST_F(MapRenderWalkTest, visibleItemsAreRendered)
+{
+   static_cast<void>(newLinkedPairAt(0.0f, 0.0f));
+
+   MapRenderWalk::Layers layers;
+   auto topicCount = walk.renderMap(layers, editor.ofSelection(), Focus {}, LevelOfDetail::full(), false);
+
+   EXPECT_EQ(2, topicCount);
+   auto counter = countOf(layers.fixed);
+   EXPECT_EQ(2, counter.getOccurrenceCount());
+   EXPECT_EQ(1, counter.getAssociationCount());
+   EXPECT_EQ(2, counter.getRoleCount());
+   EXPECT_EQ(0, countOf(layers.moving).getCallCount());
+   EXPECT_TRUE(layers.spanningRoles.empty());
+}
+
+TEST_F(MapRenderWalkTest, separatedSelectionIsRenderedIntoTheMovingLayer)
+{
+   auto movingId = newLinkedPairAt(0.0f, 0.0f);
+   Selection moving;
+   moving.add(SelectedType::Occurrence, movingId);
+   editor.modifySelection(moving, SelectionAction::Set);
+
+   MapRenderWalk::Layers layers;
+   static_cast<void>(walk.renderMap(layers, editor.ofSelection(), Focus {}, LevelOfDetail::full(), true));
+
+   auto fixedCounter = countOf(layers.fixed);
+   EXPECT_EQ(1, fixedCounter.getOccurrenceCount());
+   EXPECT_EQ(1, fixedCounter.getAssociationCount());
+   EXPECT_EQ(1, fixedCounter.getRoleCount());
+   auto movingCounter = countOf(layers.moving);
+   EXPECT_EQ(1, movingCounter.getOccurrenceCount());
+   EXPECT_EQ(0, movingCounter.getRoleCount());
+   ASSERT_EQ(1, layers.spanningRoles.size());
+   EXPECT_TRUE(layers.spanningRoles[0].occurrenceMoves);
+}
+
+TEST_F(MapRenderWalkTest, largeMapsAreRenderedInParts)
+{
+   size_t pairCount = 300;
+   for (size_t i = 0; i < pairCount; i++)
+   {
+      static_cast<void>(newLinkedPairAt(static_cast<float>(i) * 500.0f, 0.0f));
+   }
+
+   MapRenderWalk::Layers layers;
+   auto topicCount = walk.renderMap(layers, editor.ofSelection(), Focus {}, LevelOfDetail::full(), false);
+
+   EXPECT_EQ(pairCount * 2, topicCount);
+   auto counter = countOf(layers.fixed);
+   EXPECT_EQ(pairCount * 2, counter.getOccurrenceCount());
+   EXPECT_EQ(pairCount, counter.getAssociationCount());
+   EXPECT_EQ(pairCount * 2, counter.getRoleCount());
+}
+
+TEST_F(MapRenderWalkTest, repeatedRenderingAllocatesNoCoroutineFramesOnAnyThread)
+{
+   for (size_t i = 0; i < 300; i++)
+   {
+      static_cast<void>(newLinkedPairAt(static_cast<float>(i) * 500.0f, 0.0f));
+   }
+   auto render = [this]() {
+      MapRenderWalk::Layers layers;
+      static_cast<void>(walk.renderMap(layers, editor.ofSelection(), Focus {}, LevelOfDetail::full(), false));
+   };
+   // The parts are taken by whichever thread is free, so all threads get a chance to fill their pools first.
+   for (size_t i = 0; i < 8; i++)
+   {
+      render();
+   }
+
+   // The memory account counts the frames allocated by all threads, including the workers of the scheduler.
+   auto &account = MemoryAccount::of<CoroutineFramePool::MemoryTag>();
+   auto before = account.snapshot();
+   render();
+   render();
+   auto after = account.snapshot();
+   EXPECT_EQ(before.allocationCount, after.allocationCount);
+}
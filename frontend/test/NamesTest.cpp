@@ -8,6 +8,7 @@
 #include "contomap/test/samples/TopicSamples.h"
 
 using contomap::frontend::Names;
+using contomap::infrastructure::InternedString;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
 using contomap::model::Topic;
@@ -17,6 +18,13 @@ using contomap::test::samples::named;
 using contomap::test::samples::someNameValue;
 using contomap::test::samples::someTopic;
 
+static std::vector<std::string> textsOf(std::vector<InternedString> const &names)
+{
+   std::vector<std::string> result;
+   std::transform(names.begin(), names.end(), std::back_inserter(result), [](InternedString const &name) { return name.str(); });
+   return result;
+}
+
 static Identifiers someScope()
 {
    return Identifiers::ofSingle(Identifier::random());
@@ -25,7 +33,7 @@ static Identifiers someScope()
 TEST(NamesTest, defaultIfNoneApplies)
 {
    Topic topic(Identifier::random());
-   auto result = Names::forDisplay(topic, Identifier::random());
+   auto result = textsOf(Names::forDisplay(topic, Identifier::random()));
    std::vector<std::string> expected { "???" };
    EXPECT_EQ(result, expected);
 }
@@ -33,7 +41,7 @@ TEST(NamesTest, defaultIfNoneApplies)
 TEST(NamesTest, homeIfDefaultScope)
 {
    auto topic = someTopic();
-   auto result = Names::forDisplay(topic, topic.getId());
+   auto result = textsOf(Names::forDisplay(topic, topic.getId()));
    std::vector<std::string> expected { "---" };
    EXPECT_EQ(result, expected);
 }
@@ -43,7 +51,7 @@ TEST(NamesTest, listedNames)
    auto topic = someTopic();
    static_cast<void>(topic.newName(someScope(), someNameValue()));
    static_cast<void>(topic.newName(someScope(), someNameValue()));
-   auto result = Names::forDisplay(topic, Identifier::random());
+   auto result = textsOf(Names::forDisplay(topic, Identifier::random()));
    EXPECT_EQ(result.size(), 2);
 }
 
@@ -75,15 +83,20 @@ TEST(Namestest, scopedNames)
    static_cast<void>(topic.newName(scopeAB, named("nameAB")));
    static_cast<void>(topic.newName(scopeBC, named("nameBC")));
 
-   auto resultB = Names::forScopedDisplay(topic, scopeB, Identifier::random());
+   auto resultB = textsOf(Names::forScopedDisplay(topic, scopeB, Identifier::random()));
    std::vector<std::string> expectedB { "nameB" };
    EXPECT_EQ(resultB, expectedB) << "wrong for scopeB";
 
-   auto resultABC = Names::forScopedDisplay(topic, scopeABC, Identifier::random());
+   auto resultABC = textsOf(Names::forScopedDisplay(topic, scopeABC, Identifier::random()));
    std::vector<std::string> expectedABC { "nameAB", "nameBC" };
    EXPECT_EQ(std::set<std::string>(resultABC.begin(), resultABC.end()), std::set<std::string>(expectedABC.begin(), expectedABC.end())) << "wrong for scopeABC";
 
-   auto resultD = Names::forScopedDisplay(topic, scopeD, Identifier::random());
+   auto resultD = textsOf(Names::forScopedDisplay(topic, scopeD, Identifier::random()));
    std::vector<std::string> expectedD { "???" };
    EXPECT_EQ(resultD, expectedD) << "scopeD should default to question marks";
+
+   EXPECT_EQ("nameB", Names::bestForScopedDisplay(topic, scopeB, Identifier::random()).str());
+   EXPECT_EQ(resultABC[0], Names::bestForScopedDisplay(topic, scopeABC, Identifier::random()).str());
+   EXPECT_EQ("???", Names::bestForScopedDisplay(topic, scopeD, Identifier::random()).str());
+   EXPECT_EQ("---", Names::bestForScopedDisplay(topic, scopeD, topic.getId()).str());
 }
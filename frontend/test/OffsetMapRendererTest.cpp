@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/MapHitIndex.h"
+#include "contomap/frontend/OffsetMapRenderer.h"
+
+using contomap::editor::SelectedType;
+using contomap::frontend::FocusItem;
+using contomap::frontend::MapHitIndex;
+using contomap::frontend::OffsetMapRenderer;
+using contomap::model::Identifier;
+using contomap::model::Style;
+
+TEST(OffsetMapRendererTest, platesAreMovedByTheOffset)
+{
+   MapHitIndex index;
+   OffsetMapRenderer renderer(index, Vector2 { .x = 100.0f, .y = -50.0f });
+   auto id = Identifier::random();
+   Rectangle area { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f };
+   renderer.renderOccurrencePlate(id, area, Style(), area, 1.0f, false);
+
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 5.0f, .y = 5.0f }).hasNoItem());
+   EXPECT_TRUE(index.focusAt(Vector2 { .x = 105.0f, .y = -45.0f }).isOccurrence(id));
+}
+
+TEST(OffsetMapRendererTest, roleLinesAreMovedByTheOffset)
+{
+   MapHitIndex index;
+   OffsetMapRenderer renderer(index, Vector2 { .x = 0.0f, .y = 20.0f });
+   auto id = Identifier::random();
+   renderer.renderRoleLine(id, Vector2 { .x = 0.0f, .y = 0.0f }, Vector2 { .x = 100.0f, .y = 0.0f }, Style(), 1.0f, false);
+
+   auto items = index.itemsIntersecting(Rectangle { .x = 40.0f, .y = 15.0f, .width = 20.0f, .height = 10.0f });
+   ASSERT_EQ(1, items.size());
+   EXPECT_EQ((FocusItem { .type = SelectedType::Role, .id = id }), items.front());
+   EXPECT_TRUE(index.itemsIntersecting(Rectangle { .x = 40.0f, .y = -5.0f, .width = 20.0f, .height = 10.0f }).empty());
+}
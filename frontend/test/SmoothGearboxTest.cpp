@@ -62,6 +62,11 @@ public:
       EXPECT_NEAR(expected.raw(), instance->getTargetZoomFactor().raw(), 0.001f) << message;
    }
 
+   void shouldBeMoving(bool expected, std::string const &message = "")
+   {
+      EXPECT_EQ(expected, instance->isMoving()) << message;
+   }
+
    static FrameTime oneSecond()
    {
       return ofSeconds(1.0f);
@@ -120,3 +125,29 @@ TEST_F(SmoothGearboxTest, zoomFactorIsAppliedSmoothly)
    then().currentZoomFactorShouldBeNear(MapCamera::ZoomFactor::from(2.5066f));
    asWellAs().targetZoomFactorShouldBeNear(factor);
 }
+
+TEST_F(SmoothGearboxTest, isMovingUntilTargetsAreReached)
+{
+   then().shouldBeMoving(false, "initially");
+
+   given().panningTo(somePosition());
+   then().shouldBeMoving(true, "pan requested");
+   when().timePasses(ofSeconds(0.01f));
+   then().shouldBeMoving(true, "on the way");
+   when().timePasses(oneSecond());
+   then().shouldBeMoving(false, "arrived");
+
+   given().zoomingTo(MapCamera::ZoomFactor::from(2.0f));
+   then().shouldBeMoving(true, "zoom requested");
+   when().timePasses(oneSecond());
+   then().shouldBeMoving(false, "zoomed");
+
+   given().panning(true, false, false, false);
+   when().timePasses(oneSecond());
+   then().shouldBeMoving(true, "panning");
+   given().panning(false, false, false, false);
+   when().timePasses(ofSeconds(0.01f));
+   then().shouldBeMoving(true, "slowing down");
+   when().timePasses(oneSecond());
+   then().shouldBeMoving(false, "stopped");
+}
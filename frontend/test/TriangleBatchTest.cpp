@@ -0,0 +1,89 @@
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "contomap/frontend/TriangleBatch.h"
+
+using contomap::frontend::TriangleBatch;
+
+static float windingOf(Vector2 a, Vector2 b, Vector2 c)
+{
+   return ((b.x - a.x) * (c.y - a.y)) - ((b.y - a.y) * (c.x - a.x));
+}
+
+static void expectFrontFacing(TriangleBatch const &batch)
+{
+   auto const &positions = batch.getPositions();
+   for (size_t index = 0; (index + 2) < positions.size(); index += 3)
+   {
+      EXPECT_LT(windingOf(positions[index], positions[index + 1], positions[index + 2]), 0.0f) << "triangle " << (index / 3) << " is back-facing";
+   }
+}
+
+TEST(TriangleBatchTest, emptyByDefault)
+{
+   TriangleBatch batch;
+   EXPECT_TRUE(batch.empty());
+   EXPECT_EQ(0, batch.vertexCount());
+}
+
+TEST(TriangleBatchTest, rectangleConsistsOfTwoTriangles)
+{
+   TriangleBatch batch;
+   batch.addRectangle(Rectangle { .x = 1.0f, .y = 2.0f, .width = 10.0f, .height = 5.0f }, RED);
+   EXPECT_EQ(6, batch.vertexCount());
+   EXPECT_EQ(batch.getPositions().size(), batch.getColors().size());
+   expectFrontFacing(batch);
+}
+
+TEST(TriangleBatchTest, rectangleLinesConsistOfFourRectangles)
+{
+   TriangleBatch batch;
+   batch.addRectangleLines(Rectangle { .x = 0.0f, .y = 0.0f, .width = 10.0f, .height = 10.0f }, 1.0f, RED);
+   EXPECT_EQ(24, batch.vertexCount());
+   expectFrontFacing(batch);
+}
+
+TEST(TriangleBatchTest, stripKeepsWindingOfEachTriangle)
+{
+   TriangleBatch batch;
+   std::array<Vector2, 6> points {
+      Vector2 { .x = 0.0f, .y = 0.0f },
+      Vector2 { .x = 0.0f, .y = 1.0f },
+      Vector2 { .x = 1.0f, .y = 0.0f },
+      Vector2 { .x = 1.0f, .y = 1.0f },
+      Vector2 { .x = 2.0f, .y = 0.0f },
+      Vector2 { .x = 2.0f, .y = 1.0f },
+   };
+   batch.addTriangleStrip(points, RED);
+   EXPECT_EQ(12, batch.vertexCount());
+   expectFrontFacing(batch);
+}
+
+TEST(TriangleBatchTest, lineBlendsColors)
+{
+   TriangleBatch batch;
+   batch.addLine(Vector2 { .x = 0.0f, .y = 0.0f }, RED, Vector2 { .x = 10.0f, .y = 5.0f }, BLUE, 2.0f);
+   ASSERT_EQ(6, batch.vertexCount());
+   expectFrontFacing(batch);
+   Color startColor = RED;
+   Color endColor = BLUE;
+   EXPECT_EQ(startColor.r, batch.getColors()[0].r);
+   EXPECT_EQ(endColor.b, batch.getColors()[2].b);
+}
+
+TEST(TriangleBatchTest, degeneratedLinesAreSkipped)
+{
+   TriangleBatch batch;
+   batch.addLine(Vector2 { .x = 1.0f, .y = 1.0f }, RED, Vector2 { .x = 1.0f, .y = 1.0f }, RED, 2.0f);
+   batch.addLine(Vector2 { .x = 0.0f, .y = 0.0f }, RED, Vector2 { .x = 1.0f, .y = 1.0f }, RED, 0.0f);
+   EXPECT_TRUE(batch.empty());
+}
+
+TEST(TriangleBatchTest, clearRemovesAllTriangles)
+{
+   TriangleBatch batch;
+   batch.addTriangle(Vector2 { .x = 0.0f, .y = 0.0f }, Vector2 { .x = 0.0f, .y = 1.0f }, Vector2 { .x = 1.0f, .y = 0.0f }, RED);
+   batch.clear();
+   EXPECT_TRUE(batch.empty());
+}
@@ -0,0 +1,79 @@
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/infrastructure/TaskScheduler.h"
+
+using contomap::infrastructure::TaskGroup;
+using contomap::infrastructure::TaskScheduler;
+
+static uint64_t fibonacci(TaskScheduler &scheduler, uint64_t n) // NOLINT
+{
+   if (n < 16)
+   {
+      return (n < 2) ? n : (fibonacci(scheduler, n - 1) + fibonacci(scheduler, n - 2));
+   }
+   uint64_t a = 0;
+   TaskGroup group(scheduler);
+   group.run([&scheduler, &a, n]() { a = fibonacci(scheduler, n - 1); });
+   uint64_t b = fibonacci(scheduler, n - 2);
+   group.wait();
+   return a + b;
+}
+
+// The argument is the number of workers. The last variant uses all hardware threads.
+static void applyBenchmarkArguments(benchmark::internal::Benchmark *benchmark)
+{
+   benchmark->Arg(0)->Arg(1)->Arg(3)->Arg(static_cast<int64_t>(TaskScheduler::defaultWorkerCount()))->UseRealTime();
+}
+
+static void parallelForTransform(benchmark::State &state)
+{
+   TaskScheduler scheduler(static_cast<size_t>(state.range(0)));
+   std::vector<float> values(1000000);
+   std::iota(values.begin(), values.end(), 0.0f);
+   std::vector<float> results(values.size());
+   for (auto _ : state)
+   {
+      scheduler.parallelFor(0, values.size(), 0, [&values, &results](size_t first, size_t last) {
+         for (size_t i = first; i < last; i++)
+         {
+            results[i] = std::sqrt(values[i]) * std::sin(values[i]);
+         }
+      });
+      benchmark::DoNotOptimize(results.data());
+   }
+   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(parallelForTransform)->Apply(applyBenchmarkArguments);
+
+static void forkJoinRecursion(benchmark::State &state)
+{
+   TaskScheduler scheduler(static_cast<size_t>(state.range(0)));
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(fibonacci(scheduler, 30));
+   }
+}
+BENCHMARK(forkJoinRecursion)->Apply(applyBenchmarkArguments);
+
+static void spawnOverhead(benchmark::State &state)
+{
+   TaskScheduler scheduler(static_cast<size_t>(state.range(0)));
+   std::atomic<int64_t> counter { 0 };
+   for (auto _ : state)
+   {
+      TaskGroup group(scheduler);
+      for (int i = 0; i < 1000; i++)
+      {
+         group.run([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+      }
+      group.wait();
+   }
+   state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(spawnOverhead)->Apply(applyBenchmarkArguments);
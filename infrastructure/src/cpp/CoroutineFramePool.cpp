@@ -0,0 +1,156 @@
+#include <array>
+#include <new>
+
+#include "contomap/infrastructure/CoroutineFramePool.h"
+#include "contomap/infrastructure/MemoryAccount.h"
+
+using contomap::infrastructure::CoroutineFramePool;
+using contomap::infrastructure::MemoryAccount;
+
+namespace
+{
+
+size_t constexpr BUCKET_GRANULARITY = 64;
+size_t constexpr BUCKET_COUNT = CoroutineFramePool::MAX_BUCKET_SIZE / BUCKET_GRANULARITY;
+// Limits the memory kept per thread, in case a burst of simultaneously live frames is released.
+size_t constexpr MAX_FREE_PER_BUCKET = 256;
+
+struct FreeFrame
+{
+   FreeFrame *next;
+};
+
+struct Bucket
+{
+   FreeFrame *head;
+   size_t count;
+};
+
+size_t bucketIndexOf(size_t size)
+{
+   return (size - 1) / BUCKET_GRANULARITY;
+}
+
+bool fitsIntoBucket(size_t size)
+{
+   return (size > 0) && (size <= CoroutineFramePool::MAX_BUCKET_SIZE);
+}
+
+// Frames that fit into a bucket are always allocated with the size of their bucket, so that they can be recycled
+// for any frame of the same bucket, and their heap size is known when the free lists are released.
+size_t heapSizeOf(size_t size)
+{
+   return fitsIntoBucket(size) ? ((bucketIndexOf(size) + 1) * BUCKET_GRANULARITY) : size;
+}
+
+void deleteFrame(void *frame, size_t size) noexcept
+{
+   MemoryAccount::of<CoroutineFramePool::MemoryTag>().released(heapSizeOf(size));
+   ::operator delete(frame);
+}
+
+// The free lists of a thread are kept trivially destructible and constantly initialized, so that they stay
+// accessible during the destruction of other thread-local or static objects. Once the thread has released its lists,
+// all further frames go directly back to the heap.
+struct ThreadPool
+{
+   std::array<Bucket, BUCKET_COUNT> buckets;
+   CoroutineFramePool::Statistics statistics;
+   bool guarded;
+   bool released;
+};
+
+constinit thread_local ThreadPool threadPool {};
+
+// ThreadPoolRelease releases the free lists of its thread when the thread ends.
+// It is constructed as the first frame is put into a free list of the thread.
+class ThreadPoolRelease
+{
+public:
+   ThreadPoolRelease()
+   {
+      threadPool.guarded = true;
+   }
+
+   ThreadPoolRelease(ThreadPoolRelease const &) = delete;
+   ThreadPoolRelease(ThreadPoolRelease &&) = delete;
+   ThreadPoolRelease &operator=(ThreadPoolRelease const &) = delete;
+   ThreadPoolRelease &operator=(ThreadPoolRelease &&) = delete;
+
+   ~ThreadPoolRelease()
+   {
+      threadPool.released = true;
+      for (size_t index = 0; index < BUCKET_COUNT; index++)
+      {
+         auto &bucket = threadPool.buckets[index];
+         while (bucket.head != nullptr)
+         {
+            auto *frame = bucket.head;
+            bucket.head = frame->next;
+            deleteFrame(frame, (index + 1) * BUCKET_GRANULARITY);
+         }
+         bucket.count = 0;
+      }
+   }
+
+   // Constructs the release of the calling thread, should this not have happened yet.
+   static void ensureGuarded()
+   {
+      thread_local ThreadPoolRelease release;
+   }
+};
+
+void *newFrame(size_t size)
+{
+   auto heapSize = heapSizeOf(size);
+   void *frame = ::operator new(heapSize);
+   threadPool.statistics.heapAllocationCount++;
+   MemoryAccount::of<CoroutineFramePool::MemoryTag>().allocated(heapSize);
+   return frame;
+}
+
+}
+
+char const *const CoroutineFramePool::MemoryTag::NAME = "coroutineFrames";
+
+void *CoroutineFramePool::allocate(size_t size)
+{
+   if (fitsIntoBucket(size) && !threadPool.released)
+   {
+      auto &bucket = threadPool.buckets[bucketIndexOf(size)];
+      if (bucket.head != nullptr)
+      {
+         auto *frame = bucket.head;
+         bucket.head = frame->next;
+         bucket.count--;
+         threadPool.statistics.recycledCount++;
+         return frame;
+      }
+   }
+   return newFrame(size);
+}
+
+void CoroutineFramePool::deallocate(void *frame, size_t size) noexcept
+{
+   if (fitsIntoBucket(size) && !threadPool.released)
+   {
+      auto &bucket = threadPool.buckets[bucketIndexOf(size)];
+      if (bucket.count < MAX_FREE_PER_BUCKET)
+      {
+         if (!threadPool.guarded)
+         {
+            ThreadPoolRelease::ensureGuarded();
+         }
+         auto *freeFrame = new (frame) FreeFrame { .next = bucket.head };
+         bucket.head = freeFrame;
+         bucket.count++;
+         return;
+      }
+   }
+   deleteFrame(frame, size);
+}
+
+CoroutineFramePool::Statistics CoroutineFramePool::statistics() noexcept
+{
+   return threadPool.statistics;
+}
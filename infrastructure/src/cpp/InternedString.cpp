@@ -0,0 +1,123 @@
+#include <mutex>
+#include <unordered_map>
+
+#include "contomap/infrastructure/InternedString.h"
+
+using contomap::infrastructure::InternedString;
+
+namespace
+{
+
+class StringPool
+{
+public:
+   static StringPool &instance()
+   {
+      // The pool is never destroyed, so that handles with static storage duration can still release their entries.
+      static auto *pool = new StringPool();
+      return *pool;
+   }
+
+   std::shared_ptr<std::string const> intern(std::string_view value)
+   {
+      std::lock_guard<std::mutex> guard(lock);
+      auto it = entries.find(value);
+      if (it != entries.end())
+      {
+         if (auto existing = it->second.lock(); existing != nullptr)
+         {
+            return existing;
+         }
+         // The last handle is currently being released, its entry is replaced.
+         byteCount -= it->first.size();
+         entries.erase(it);
+      }
+      std::shared_ptr<std::string const> entry(new std::string(value), [this](std::string const *released) { release(released); });
+      entries.emplace(std::string_view(*entry), entry);
+      byteCount += value.size();
+      return entry;
+   }
+
+   InternedString::PoolStatistics statistics()
+   {
+      std::lock_guard<std::mutex> guard(lock);
+      return InternedString::PoolStatistics { .entryCount = entries.size(), .byteCount = byteCount };
+   }
+
+private:
+   StringPool() = default;
+
+   void release(std::string const *released)
+   {
+      {
+         std::lock_guard<std::mutex> guard(lock);
+         auto it = entries.find(*released);
+         if ((it != entries.end()) && (it->first.data() == released->data()))
+         {
+            byteCount -= it->first.size();
+            entries.erase(it);
+         }
+      }
+      delete released;
+   }
+
+   std::mutex lock;
+   std::unordered_map<std::string_view, std::weak_ptr<std::string const>> entries;
+   size_t byteCount = 0;
+};
+
+}
+
+InternedString::InternedString(std::shared_ptr<std::string const> value)
+   : value(std::move(value))
+{
+}
+
+InternedString InternedString::of(std::string_view value)
+{
+   if (value.empty())
+   {
+      return {};
+   }
+   return InternedString(StringPool::instance().intern(value));
+}
+
+InternedString::PoolStatistics InternedString::poolStatistics()
+{
+   return StringPool::instance().statistics();
+}
+
+std::string_view InternedString::view() const noexcept
+{
+   return str();
+}
+
+std::string const &InternedString::str() const noexcept
+{
+   static std::string const EMPTY;
+   return (value != nullptr) ? *value : EMPTY;
+}
+
+char const *InternedString::c_str() const noexcept
+{
+   return str().c_str();
+}
+
+bool InternedString::empty() const noexcept
+{
+   return value == nullptr;
+}
+
+bool InternedString::operator==(InternedString const &other) const noexcept
+{
+   return value == other.value;
+}
+
+std::strong_ordering InternedString::operator<=>(InternedString const &other) const noexcept
+{
+   if (value == other.value)
+   {
+      return std::strong_ordering::equal;
+   }
+   return view() <=> other.view();
+}
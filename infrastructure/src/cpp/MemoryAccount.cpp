@@ -0,0 +1,94 @@
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "contomap/infrastructure/MemoryAccount.h"
+
+using contomap::infrastructure::MemoryAccount;
+
+namespace
+{
+
+struct Registry
+{
+   std::mutex lock;
+   std::vector<MemoryAccount *> accounts;
+};
+
+// The registry and its accounts are never destroyed, as containers may release their memory during static destruction.
+Registry &registry()
+{
+   static Registry &instance = *new Registry();
+   return instance;
+}
+
+}
+
+MemoryAccount &MemoryAccount::named(std::string const &name)
+{
+   auto &reg = registry();
+   std::lock_guard<std::mutex> guard(reg.lock);
+   for (auto *account : reg.accounts)
+   {
+      if (account->name == name)
+      {
+         return *account;
+      }
+   }
+   return *reg.accounts.emplace_back(new MemoryAccount(name));
+}
+
+void MemoryAccount::forEach(std::function<void(MemoryAccount const &)> const &consumer)
+{
+   std::vector<MemoryAccount *> accounts;
+   {
+      auto &reg = registry();
+      std::lock_guard<std::mutex> guard(reg.lock);
+      accounts = reg.accounts;
+   }
+   for (auto const *account : accounts)
+   {
+      consumer(*account);
+   }
+}
+
+MemoryAccount::MemoryAccount(std::string name)
+   : name(std::move(name))
+{
+}
+
+std::string const &MemoryAccount::getName() const
+{
+   return name;
+}
+
+void MemoryAccount::allocated(size_t bytes) noexcept
+{
+   allocationCount.fetch_add(1, std::memory_order_relaxed);
+   allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+   auto live = liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+   auto peak = peakBytes.load(std::memory_order_relaxed);
+   while ((peak < live) && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+   {
+   }
+}
+
+void MemoryAccount::released(size_t bytes) noexcept
+{
+   liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryAccount::resetPeak() noexcept
+{
+   peakBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+MemoryAccount::Snapshot MemoryAccount::snapshot() const noexcept
+{
+   return Snapshot {
+      .liveBytes = liveBytes.load(std::memory_order_relaxed),
+      .peakBytes = peakBytes.load(std::memory_order_relaxed),
+      .allocationCount = allocationCount.load(std::memory_order_relaxed),
+      .allocatedBytes = allocatedBytes.load(std::memory_order_relaxed),
+   };
+}
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include "contomap/infrastructure/Profiler.h"
+
+using contomap::infrastructure::Profiler;
+
+namespace
+{
+
+char const *unitName(Profiler::Unit unit)
+{
+   switch (unit)
+   {
+   case Profiler::Unit::Milliseconds:
+      return "ms";
+   case Profiler::Unit::Kibibytes:
+      return "KiB";
+   default:
+      return "count";
+   }
+}
+
+}
+
+size_t const Profiler::WINDOW_SIZE = 240;
+
+Profiler::Series::Series(std::string name, Unit unit)
+   : name(std::move(name))
+   , unit(unit)
+{
+}
+
+std::string const &Profiler::Series::getName() const
+{
+   return name;
+}
+
+Profiler::Unit Profiler::Series::getUnit() const
+{
+   return unit;
+}
+
+void Profiler::Series::add(double value)
+{
+   if (samples.size() < WINDOW_SIZE)
+   {
+      samples.push_back(value);
+      return;
+   }
+   samples[nextIndex] = value;
+   nextIndex = (nextIndex + 1) % WINDOW_SIZE;
+}
+
+void Profiler::Series::clear()
+{
+   samples.clear();
+   nextIndex = 0;
+}
+
+Profiler::Statistics Profiler::Series::statistics() const
+{
+   Statistics result;
+   if (samples.empty())
+   {
+      return result;
+   }
+   result.sampleCount = samples.size();
+   result.minimum = *std::min_element(samples.begin(), samples.end());
+   result.average = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+   result.last = samples[(nextIndex + samples.size() - 1) % samples.size()];
+   auto sorted = samples;
+   auto rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(sorted.size()))) - 1;
+   std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(rank), sorted.end());
+   result.percentile99 = sorted[rank];
+   return result;
+}
+
+Profiler::Timer::Timer(Profiler const &profiler, Series &series)
+   : series(profiler.isEnabled() ? &series : nullptr)
+{
+   if (this->series != nullptr)
+   {
+      start = std::chrono::steady_clock::now();
+   }
+}
+
+Profiler::Timer::~Timer()
+{
+   if (series != nullptr)
+   {
+      series->add(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+   }
+}
+
+Profiler::Series &Profiler::series(std::string const &name, Unit unit)
+{
+   auto it = std::find_if(allSeries.begin(), allSeries.end(), [&name](auto const &existing) { return existing->getName() == name; });
+   if (it != allSeries.end())
+   {
+      return **it;
+   }
+   return *allSeries.emplace_back(std::make_unique<Series>(name, unit));
+}
+
+void Profiler::record(Series &series, double value) const
+{
+   if (enabled)
+   {
+      series.add(value);
+   }
+}
+
+void Profiler::setEnabled(bool value)
+{
+   if (value && !enabled)
+   {
+      for (auto &series : allSeries)
+      {
+         series->clear();
+      }
+   }
+   enabled = value;
+}
+
+void Profiler::forEach(std::function<void(Series const &)> const &consumer) const
+{
+   for (auto const &series : allSeries)
+   {
+      consumer(*series);
+   }
+}
+
+void Profiler::writeCsv(std::ostream &out) const
+{
+   out << "series,unit,samples,min,avg,p99,last\n";
+   for (auto const &series : allSeries)
+   {
+      auto stats = series->statistics();
+      out << series->getName() << "," << unitName(series->getUnit()) << "," << stats.sampleCount << "," << stats.minimum
+          << "," << stats.average << "," << stats.percentile99 << "," << stats.last << "\n";
+   }
+}
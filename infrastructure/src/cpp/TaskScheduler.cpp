@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "contomap/infrastructure/TaskScheduler.h"
+
+using contomap::infrastructure::TaskGroup;
+using contomap::infrastructure::TaskScheduler;
+
+namespace
+{
+
+size_t constexpr NO_WORKER = static_cast<size_t>(-1);
+size_t constexpr CHUNKS_PER_THREAD = 4;
+
+struct WorkerIdentity
+{
+   TaskScheduler const *scheduler = nullptr;
+   size_t index = NO_WORKER;
+};
+
+thread_local WorkerIdentity currentWorker;
+
+}
+
+TaskScheduler::TaskScheduler(size_t workerCount)
+{
+   for (size_t i = 0; i < workerCount; i++)
+   {
+      queues.emplace_back(std::make_unique<WorkerQueue>());
+   }
+   workers.reserve(workerCount);
+   for (size_t i = 0; i < workerCount; i++)
+   {
+      workers.emplace_back([this, i]() { runWorker(i); });
+   }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+   stopping.store(true);
+   {
+      std::lock_guard<std::mutex> guard(sleepLock);
+   }
+   wakeUp.notify_all();
+   for (auto &worker : workers)
+   {
+      worker.join();
+   }
+}
+
+size_t TaskScheduler::defaultWorkerCount()
+{
+#ifdef __EMSCRIPTEN__
+   return 0;
+#else
+   auto hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+   return (hardwareThreads > 1) ? (hardwareThreads - 1) : 0;
+#endif
+}
+
+size_t TaskScheduler::workerCount() const noexcept
+{
+   return workers.size();
+}
+
+size_t TaskScheduler::concurrency() const noexcept
+{
+   return workers.size() + 1;
+}
+
+void TaskScheduler::parallelFor(size_t begin, size_t end, size_t grainSize, std::function<void(size_t, size_t)> const &body)
+{
+   if (end <= begin)
+   {
+      return;
+   }
+   size_t count = end - begin;
+   size_t chunkCount = concurrency() * CHUNKS_PER_THREAD;
+   size_t chunkSize = (grainSize > 0) ? grainSize : std::max<size_t>(1, (count + chunkCount - 1) / chunkCount);
+   if (workers.empty() || (count <= chunkSize))
+   {
+      for (size_t first = begin; first < end; first += std::min(chunkSize, end - first))
+      {
+         body(first, first + std::min(chunkSize, end - first));
+      }
+      return;
+   }
+   TaskGroup group(*this);
+   for (size_t first = begin; first < end; first += std::min(chunkSize, end - first))
+   {
+      size_t last = first + std::min(chunkSize, end - first);
+      group.run([&body, first, last]() { body(first, last); });
+   }
+   group.wait();
+}
+
+void TaskScheduler::spawn(Job job)
+{
+   size_t index = currentWorkerIndex();
+   auto &queue = (index != NO_WORKER) ? *queues[index] : sharedQueue;
+   // The count is raised first, so that it never falls below the number of queued jobs.
+   queuedCount.fetch_add(1);
+   try
+   {
+      std::lock_guard<std::mutex> guard(queue.lock);
+      queue.jobs.emplace_back(std::move(job));
+   }
+   catch (...)
+   {
+      queuedCount.fetch_sub(1);
+      throw;
+   }
+   {
+      std::lock_guard<std::mutex> guard(sleepLock);
+   }
+   wakeUp.notify_one();
+}
+
+bool TaskScheduler::runNextJob()
+{
+   Job job;
+   if (!tryTake(job))
+   {
+      return false;
+   }
+   run(job);
+   return true;
+}
+
+bool TaskScheduler::tryTake(Job &job)
+{
+   auto takeFrom = [this, &job](WorkerQueue &queue, bool fromBack) {
+      std::lock_guard<std::mutex> guard(queue.lock);
+      if (queue.jobs.empty())
+      {
+         return false;
+      }
+      if (fromBack)
+      {
+         job = std::move(queue.jobs.back());
+         queue.jobs.pop_back();
+      }
+      else
+      {
+         job = std::move(queue.jobs.front());
+         queue.jobs.pop_front();
+      }
+      queuedCount.fetch_sub(1);
+      return true;
+   };
+
+   size_t index = currentWorkerIndex();
+   if ((index != NO_WORKER) && takeFrom(*queues[index], true))
+   {
+      return true;
+   }
+   if (takeFrom(sharedQueue, false))
+   {
+      return true;
+   }
+   size_t start = (index != NO_WORKER) ? (index + 1) : 0;
+   for (size_t offset = 0; offset < queues.size(); offset++)
+   {
+      size_t victim = (start + offset) % queues.size();
+      if ((victim != index) && takeFrom(*queues[victim], false))
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+size_t TaskScheduler::currentWorkerIndex() const noexcept
+{
+   return (currentWorker.scheduler == this) ? currentWorker.index : NO_WORKER;
+}
+
+void TaskScheduler::runWorker(size_t index)
+{
+   currentWorker = WorkerIdentity { .scheduler = this, .index = index };
+   while (true)
+   {
+      if (runNextJob())
+      {
+         continue;
+      }
+      std::unique_lock<std::mutex> guard(sleepLock);
+      wakeUp.wait(guard, [this]() { return stopping.load() || (queuedCount.load() > 0); });
+      if (stopping.load() && (queuedCount.load() == 0))
+      {
+         return;
+      }
+   }
+}
+
+void TaskScheduler::run(Job &job) noexcept
+{
+   try
+   {
+      job.task();
+   }
+   catch (...)
+   {
+      job.group->fail(std::current_exception());
+   }
+   job.group->finishOne();
+}
+
+TaskGroup::TaskGroup(TaskScheduler &scheduler)
+   : scheduler(scheduler)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+   join();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+   if (scheduler.workers.empty())
+   {
+      try
+      {
+         task();
+      }
+      catch (...)
+      {
+         fail(std::current_exception());
+      }
+      return;
+   }
+   pendingCount.fetch_add(1);
+   try
+   {
+      scheduler.spawn(TaskScheduler::Job { .task = std::move(task), .group = this });
+   }
+   catch (...)
+   {
+      pendingCount.fetch_sub(1);
+      throw;
+   }
+}
+
+void TaskGroup::wait()
+{
+   join();
+   std::exception_ptr exception;
+   {
+      std::lock_guard<std::mutex> guard(lock);
+      exception = std::exchange(firstException, nullptr);
+   }
+   if (exception != nullptr)
+   {
+      std::rethrow_exception(exception);
+   }
+}
+
+void TaskGroup::fail(std::exception_ptr exception) noexcept
+{
+   std::lock_guard<std::mutex> guard(lock);
+   if (firstException == nullptr)
+   {
+      firstException = std::move(exception);
+   }
+}
+
+void TaskGroup::finishOne() noexcept
+{
+   // The count is lowered under the lock, so that a joining thread can not release the group while it is still in use here.
+   std::lock_guard<std::mutex> guard(lock);
+   if (pendingCount.fetch_sub(1) == 1)
+   {
+      finished.notify_all();
+   }
+}
+
+void TaskGroup::join() noexcept
+{
+   while (pendingCount.load() != 0)
+   {
+      if (scheduler.runNextJob())
+      {
+         continue;
+      }
+      // The remaining tasks are running elsewhere. Waiting is bounded, as tasks they spawn may need a helping hand.
+      std::unique_lock<std::mutex> guard(lock);
+      finished.wait_for(guard, std::chrono::milliseconds(1), [this]() { return pendingCount.load() == 0; });
+   }
+   std::lock_guard<std::mutex> guard(lock);
+}
@@ -0,0 +1,173 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "contomap/infrastructure/Trace.h"
+
+using contomap::infrastructure::Trace;
+
+namespace
+{
+
+enum class EventKind : uint8_t
+{
+   Begin,
+   End,
+   Counter,
+};
+
+struct Event
+{
+   char const *name = nullptr;
+   int64_t timestamp = 0;
+   double value = 0.0;
+   EventKind kind = EventKind::Begin;
+};
+
+// Only the owning thread writes events. The count of written events is published after each event,
+// so that readers see complete events below that count.
+struct ThreadBuffer
+{
+   explicit ThreadBuffer(size_t threadId)
+      : threadId(threadId)
+      , events(Trace::BUFFER_CAPACITY)
+   {
+   }
+
+   size_t threadId;
+   std::vector<Event> events;
+   std::atomic<uint64_t> writtenCount { 0 };
+};
+
+struct Registry
+{
+   std::mutex lock;
+   std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+   std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+};
+
+Registry &registry()
+{
+   static Registry instance;
+   return instance;
+}
+
+// Buffers stay registered after their thread ended, so that the events of finished threads are kept.
+ThreadBuffer &bufferOfCurrentThread()
+{
+   thread_local std::shared_ptr<ThreadBuffer> const buffer = []() {
+      auto &reg = registry();
+      std::lock_guard<std::mutex> guard(reg.lock);
+      return reg.buffers.emplace_back(std::make_shared<ThreadBuffer>(reg.buffers.size() + 1));
+   }();
+   return *buffer;
+}
+
+void record(char const *name, EventKind kind, double value) noexcept
+{
+   auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry().origin).count();
+   auto &buffer = bufferOfCurrentThread();
+   auto index = buffer.writtenCount.load(std::memory_order_relaxed);
+   buffer.events[index % Trace::BUFFER_CAPACITY] = Event { .name = name, .timestamp = now, .value = value, .kind = kind };
+   buffer.writtenCount.store(index + 1, std::memory_order_release);
+}
+
+void writeJsonString(std::ostream &out, char const *text)
+{
+   out << '"';
+   for (char const *c = text; *c != 0; c++)
+   {
+      if ((*c == '"') || (*c == '\\'))
+      {
+         out << '\\';
+      }
+      out << *c;
+   }
+   out << '"';
+}
+
+}
+
+size_t const Trace::BUFFER_CAPACITY = 1 << 15;
+
+Trace::Zone::Zone(char const *name) noexcept
+   : name(name)
+{
+   record(name, EventKind::Begin, 0.0);
+}
+
+Trace::Zone::~Zone()
+{
+   record(name, EventKind::End, 0.0);
+}
+
+void Trace::counter(char const *name, double value) noexcept
+{
+   record(name, EventKind::Counter, value);
+}
+
+void Trace::writeChromeJson(std::ostream &out)
+{
+   std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+   {
+      auto &reg = registry();
+      std::lock_guard<std::mutex> guard(reg.lock);
+      buffers = reg.buffers;
+   }
+
+   auto flags = out.flags();
+   out.setf(std::ios::fixed);
+   auto precision = out.precision(3);
+   out << R"({"displayTimeUnit":"ms","traceEvents":[)";
+   bool first = true;
+   for (auto const &buffer : buffers)
+   {
+      uint64_t end = buffer->writtenCount.load(std::memory_order_acquire);
+      uint64_t begin = (end > BUFFER_CAPACITY) ? (end - BUFFER_CAPACITY) : 0;
+      // Zones that began before the oldest kept event are missing their begin; their ends are skipped as well.
+      size_t depth = 0;
+      for (uint64_t i = begin; i < end; i++)
+      {
+         auto const &event = buffer->events[i % BUFFER_CAPACITY];
+         if (event.kind == EventKind::End)
+         {
+            if (depth == 0)
+            {
+               continue;
+            }
+            depth--;
+         }
+         else if (event.kind == EventKind::Begin)
+         {
+            depth++;
+         }
+
+         out << (first ? "" : ",") << R"({"name":)";
+         writeJsonString(out, event.name);
+         char const *phase = (event.kind == EventKind::Begin) ? "B" : ((event.kind == EventKind::End) ? "E" : "C");
+         out << R"(,"ph":")" << phase << R"(","ts":)" << (static_cast<double>(event.timestamp) / 1000.0) << R"(,"pid":1,"tid":)" << buffer->threadId;
+         if (event.kind == EventKind::Counter)
+         {
+            out << R"(,"args":{"value":)" << event.value << "}";
+         }
+         out << "}";
+         first = false;
+      }
+   }
+   out << "]}";
+   out.precision(precision);
+   out.flags(flags);
+}
+
+void Trace::clear()
+{
+   auto &reg = registry();
+   std::lock_guard<std::mutex> guard(reg.lock);
+   for (auto &buffer : reg.buffers)
+   {
+      buffer->writtenCount.store(0, std::memory_order_release);
+   }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * CoroutineFramePool recycles the memory of coroutine frames.
+ *
+ * Frames are sorted into buckets by their size. A released frame is kept in a thread-local free list of its bucket,
+ * from which the next frame of that bucket is taken. Only if the list is empty, a frame is allocated from the heap.
+ * Frames larger than the biggest bucket always use the heap.
+ * All frames that are held from the heap, including those in free lists, are charged to a memory account.
+ */
+class CoroutineFramePool
+{
+public:
+   /**
+    * MemoryTag identifies the memory account of coroutine frames.
+    */
+   struct MemoryTag
+   {
+      /** The name of the account. */
+      static char const *const NAME;
+   };
+
+   /**
+    * Statistics counts the requests of the calling thread.
+    */
+   struct Statistics
+   {
+      /** The number of frames that were taken from a free list. */
+      size_t recycledCount = 0;
+      /** The number of frames that had to be allocated from the heap. */
+      size_t heapAllocationCount = 0;
+   };
+
+   /** The largest frame size that is kept in a bucket. */
+   static size_t constexpr MAX_BUCKET_SIZE = 1024;
+
+   CoroutineFramePool() = delete;
+
+   /**
+    * Provides the memory for a frame.
+    *
+    * @param size the number of bytes needed.
+    * @return memory that is suitably aligned for any coroutine frame.
+    */
+   [[nodiscard]] static void *allocate(size_t size);
+
+   /**
+    * Returns the memory of a frame.
+    *
+    * @param frame the memory that was previously provided by allocate().
+    * @param size the same size as was requested for allocate().
+    */
+   static void deallocate(void *frame, size_t size) noexcept;
+
+   /**
+    * @return the statistics of the calling thread.
+    */
+   [[nodiscard]] static Statistics statistics() noexcept;
+};
+
+}
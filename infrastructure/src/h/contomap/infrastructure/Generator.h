@@ -21,8 +21,11 @@ extern struct __noop_coro_frame __noop_coro_fr __attribute__((selectany));
 #endif
 
 #include <coroutine>
+#include <cstddef>
 #include <optional>
 
+#include "contomap/infrastructure/CoroutineFramePool.h"
+
 namespace contomap::infrastructure
 {
 
@@ -39,6 +42,26 @@ public:
     */
    struct promise_type
    {
+      /**
+       * Allocates the coroutine frame from the recycling pool.
+       *
+       * @param size the size of the frame.
+       * @return the memory for the frame.
+       */
+      static void *operator new(std::size_t size)
+      {
+         return CoroutineFramePool::allocate(size);
+      }
+      /**
+       * Returns the coroutine frame to the recycling pool.
+       *
+       * @param frame the memory of the frame.
+       * @param size the size of the frame.
+       */
+      static void operator delete(void *frame, std::size_t size) noexcept
+      {
+         CoroutineFramePool::deallocate(frame, size);
+      }
       /**
        * @return generator result as per contract.
        */
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * An InlineMap is an associative container for few entries, which are kept sorted by key in one contiguous block.
+ *
+ * Up to InlineCapacity entries are stored within the map itself, without any allocation. Only beyond that,
+ * the entries are moved to the heap. Lookups are binary searches, and iteration follows the order of the keys.
+ *
+ * Entries are relocated by move construction only, never by move assignment. Inserting or removing an entry
+ * invalidates all iterators and references.
+ *
+ * @tparam Key the type of the keys, which must be ordered.
+ * @tparam Value the type of the values, which shall be move-constructible without throwing.
+ * @tparam InlineCapacity the number of entries to keep without allocation.
+ */
+template <class Key, class Value, size_t InlineCapacity> class InlineMap
+{
+public:
+   /** The type of the entries. */
+   using value_type = std::pair<Key, Value>;
+   /** The type of the mutable iterator. */
+   using iterator = value_type *;
+   /** The type of the constant iterator. */
+   using const_iterator = value_type const *;
+
+   static_assert(InlineCapacity > 0, "an InlineMap needs inline capacity");
+
+   /**
+    * Default constructor.
+    */
+   InlineMap() = default;
+   /**
+    * Deleted copy constructor.
+    */
+   InlineMap(InlineMap const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   InlineMap(InlineMap &&) = delete;
+   ~InlineMap()
+   {
+      clear();
+      releaseHeap();
+   }
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   InlineMap &operator=(InlineMap const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   InlineMap &operator=(InlineMap &&) = delete;
+
+   /**
+    * @return start iterator for iteration.
+    */
+   [[nodiscard]] iterator begin() noexcept
+   {
+      return elements();
+   }
+   /**
+    * @return stop iterator for iteration.
+    */
+   [[nodiscard]] iterator end() noexcept
+   {
+      return elements() + count;
+   }
+   /**
+    * @return start iterator for iteration.
+    */
+   [[nodiscard]] const_iterator begin() const noexcept
+   {
+      return elements();
+   }
+   /**
+    * @return stop iterator for iteration.
+    */
+   [[nodiscard]] const_iterator end() const noexcept
+   {
+      return elements() + count;
+   }
+
+   /**
+    * @return the number of entries.
+    */
+   [[nodiscard]] size_t size() const noexcept
+   {
+      return count;
+   }
+
+   /**
+    * @return true if there are no entries.
+    */
+   [[nodiscard]] bool empty() const noexcept
+   {
+      return count == 0;
+   }
+
+   /**
+    * @param key the key to look for.
+    * @return the iterator to the entry with given key, or end() if there is none.
+    */
+   [[nodiscard]] iterator find(Key const &key) noexcept
+   {
+      return findIn(begin(), end(), key);
+   }
+
+   /**
+    * @param key the key to look for.
+    * @return the iterator to the entry with given key, or end() if there is none.
+    */
+   [[nodiscard]] const_iterator find(Key const &key) const noexcept
+   {
+      return findIn(begin(), end(), key);
+   }
+
+   /**
+    * Inserts a new entry, unless an entry with the same key exists.
+    *
+    * @param key the key of the entry.
+    * @param args the arguments for the constructor of the value.
+    * @tparam Args the types of the arguments.
+    * @return the iterator to the entry with given key, and true if the entry was inserted.
+    */
+   template <class... Args> std::pair<iterator, bool> tryEmplace(Key const &key, Args &&...args)
+   {
+      auto position = lowerBound(begin(), end(), key);
+      if ((position != end()) && (position->first == key))
+      {
+         return { position, false };
+      }
+      auto index = static_cast<size_t>(position - begin());
+      // The entry is created before making room, so that a throwing constructor leaves the map unchanged.
+      value_type entry(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+      if (count == capacity)
+      {
+         grow(index);
+      }
+      else
+      {
+         for (size_t i = count; i > index; i--)
+         {
+            relocate(elements() + i - 1, elements() + i);
+         }
+      }
+      ::new (static_cast<void *>(elements() + index)) value_type(std::move(entry));
+      count++;
+      return { elements() + index, true };
+   }
+
+   /**
+    * Removes the entry at given position.
+    * The entry is destroyed only after it was taken out of the map, so its destructor sees the map without it.
+    *
+    * @param position the iterator to the entry to remove.
+    */
+   void erase(iterator position)
+   {
+      value_type removed(std::move(*position));
+      position->~value_type();
+      for (auto it = position; (it + 1) != end(); it++)
+      {
+         relocate(it + 1, it);
+      }
+      count--;
+   }
+
+   /**
+    * Removes the entry with given key, if present.
+    *
+    * @param key the key of the entry to remove.
+    * @return the number of removed entries.
+    */
+   size_t erase(Key const &key)
+   {
+      auto position = find(key);
+      if (position == end())
+      {
+         return 0;
+      }
+      erase(position);
+      return 1;
+   }
+
+   /**
+    * Removes all entries that match given predicate.
+    * Neither the predicate nor the destructors of the removed values shall modify this map.
+    *
+    * @param predicate the predicate to test each entry with.
+    * @tparam Predicate the type of the predicate.
+    * @return the number of removed entries.
+    */
+   template <class Predicate> size_t eraseIf(Predicate predicate)
+   {
+      size_t removedCount = 0;
+      size_t index = 0;
+      while (index < count)
+      {
+         if (predicate(std::as_const(elements()[index])))
+         {
+            erase(elements() + index);
+            removedCount++;
+         }
+         else
+         {
+            index++;
+         }
+      }
+      return removedCount;
+   }
+
+   /**
+    * Removes all entries. The inline capacity is kept, as is any heap capacity.
+    */
+   void clear() noexcept
+   {
+      std::destroy_n(elements(), count);
+      count = 0;
+   }
+
+private:
+   static void relocate(value_type *from, value_type *to) noexcept
+   {
+      ::new (static_cast<void *>(to)) value_type(std::move(*from));
+      from->~value_type();
+   }
+
+   [[nodiscard]] value_type *elements() noexcept
+   {
+      return (heap != nullptr) ? heap : reinterpret_cast<value_type *>(inlineStorage);
+   }
+
+   [[nodiscard]] value_type const *elements() const noexcept
+   {
+      return (heap != nullptr) ? heap : reinterpret_cast<value_type const *>(inlineStorage);
+   }
+
+   template <class Iterator> [[nodiscard]] static Iterator lowerBound(Iterator first, Iterator last, Key const &key) noexcept
+   {
+      return std::lower_bound(first, last, key, [](value_type const &entry, Key const &value) { return entry.first < value; });
+   }
+
+   template <class Iterator> [[nodiscard]] static Iterator findIn(Iterator first, Iterator last, Key const &key) noexcept
+   {
+      auto position = lowerBound(first, last, key);
+      return ((position != last) && (position->first == key)) ? position : last;
+   }
+
+   void grow(size_t gapIndex)
+   {
+      size_t newCapacity = capacity * 2;
+      auto *newElements = static_cast<value_type *>(::operator new(newCapacity * sizeof(value_type), std::align_val_t { alignof(value_type) }));
+      auto *oldElements = elements();
+      for (size_t i = 0; i < count; i++)
+      {
+         relocate(oldElements + i, newElements + ((i < gapIndex) ? i : (i + 1)));
+      }
+      releaseHeap();
+      heap = newElements;
+      capacity = static_cast<uint32_t>(newCapacity);
+   }
+
+   void releaseHeap() noexcept
+   {
+      if (heap != nullptr)
+      {
+         ::operator delete(heap, std::align_val_t { alignof(value_type) });
+         heap = nullptr;
+      }
+   }
+
+   value_type *heap = nullptr;
+   uint32_t count = 0;
+   uint32_t capacity = InlineCapacity;
+   alignas(value_type) std::byte inlineStorage[sizeof(value_type) * InlineCapacity];
+};
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * An InternedString is a handle to an immutable string that is shared through a process-wide pool.
+ *
+ * Equal contents are stored only once. Handles are cheap to copy, and two handles compare equal if they refer to
+ * the same stored string. The stored string is released from the pool as soon as the last handle is gone.
+ * Handles may be copied and released from any thread.
+ */
+class InternedString
+{
+public:
+   /**
+    * PoolStatistics provides information about the currently stored strings.
+    */
+   struct PoolStatistics
+   {
+      /** The number of distinct strings in the pool. */
+      size_t entryCount = 0;
+      /** The summed length of all distinct strings, in bytes. */
+      size_t byteCount = 0;
+   };
+
+   /**
+    * Default constructor, referring to an empty string.
+    */
+   InternedString() = default;
+
+   /**
+    * Returns the handle to the stored string of given value. The value is added to the pool, if necessary.
+    *
+    * @param value the content to look for.
+    * @return a handle to the shared instance.
+    */
+   [[nodiscard]] static InternedString of(std::string_view value);
+
+   /**
+    * @return the statistics of the shared pool.
+    */
+   [[nodiscard]] static PoolStatistics poolStatistics();
+
+   /**
+    * @return the content as a view.
+    */
+   [[nodiscard]] std::string_view view() const noexcept;
+
+   /**
+    * @return the content as a string reference, valid as long as this handle exists.
+    */
+   [[nodiscard]] std::string const &str() const noexcept;
+
+   /**
+    * @return the content as a zero-terminated character array, valid as long as this handle exists.
+    */
+   [[nodiscard]] char const *c_str() const noexcept;
+
+   /**
+    * @return true if the content is empty.
+    */
+   [[nodiscard]] bool empty() const noexcept;
+
+   /**
+    * Equality operator. As contents are stored only once, this only compares the references.
+    *
+    * @param other the other instance to compare to.
+    * @return true if both refer to the same content.
+    */
+   [[nodiscard]] bool operator==(InternedString const &other) const noexcept;
+
+   /**
+    * Spaceship operator, ordering by content.
+    *
+    * @param other the other instance to compare to.
+    * @return the ordering for this type.
+    */
+   [[nodiscard]] std::strong_ordering operator<=>(InternedString const &other) const noexcept;
+
+private:
+   explicit InternedString(std::shared_ptr<std::string const> value);
+
+   std::shared_ptr<std::string const> value;
+};
+
+}
@@ -1,8 +1,6 @@
 #pragma once
 
-#include <functional>
-#include <memory>
-#include <optional>
+#include <stdexcept>
 
 namespace contomap::infrastructure
 {
@@ -10,89 +8,191 @@ namespace contomap::infrastructure
 class Links;
 
 /**
- * A link provides a bi-directional reference between two instances.
- * Links come in pairs, and as soon as one goes out of scope, the other is informed.
- *
- * @tparam LinkedType the type of the referred party.
+ * A LinkCallback refers to a member function of an object that shall be informed once a link was detached.
+ * It consists of two plain pointers, and therefore does not need any allocation.
  */
-template <class LinkedType> class Link
+class LinkCallback
 {
 public:
    /**
-    * Deleted default constructor.
+    * Default constructor, for a callback that does nothing.
     */
-   Link() = delete;
+   LinkCallback() = default;
+
    /**
-    * Deleted copy constructor.
+    * Factory function to refer to a member function.
+    *
+    * @param target the instance to call the member function on.
+    * @tparam Method the member function to call. It is called without arguments.
+    * @tparam Target the type of the instance.
+    * @return the callback to the member function.
     */
-   Link(Link const &) = delete;
+   template <auto Method, class Target> [[nodiscard]] static LinkCallback to(Target &target)
+   {
+      return LinkCallback(&target, [](void *instance) { (static_cast<Target *>(instance)->*Method)(); });
+   }
+
    /**
-    * Deleted move constructor.
+    * Calls the referred member function, if any.
     */
-   Link(Link &&) = delete;
-   ~Link()
+   void operator()() const
    {
-      if (linked.has_value())
+      if (function != nullptr)
       {
-         auto remote = std::move(remoteUnlink);
-         reset();
-         remote();
+         function(target);
       }
    }
 
+private:
+   LinkCallback(void *target, void (*function)(void *))
+      : target(target)
+      , function(function)
+   {
+   }
+
+   void *target = nullptr;
+   void (*function)(void *) = nullptr;
+};
+
+/**
+ * A LinkEnd is the type-independent part of a Link, which knows about the other end of the pair.
+ */
+class LinkEnd
+{
+public:
+   /**
+    * Deleted copy constructor.
+    */
+   LinkEnd(LinkEnd const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   LinkEnd(LinkEnd &&) = delete;
+   ~LinkEnd()
+   {
+      unlink();
+   }
+
    /**
     * Deleted copy assignment operator.
     * @return this.
     */
-   Link &operator=(Link const &) = delete;
+   LinkEnd &operator=(LinkEnd const &) = delete;
    /**
     * Deleted move assignment operator.
     * @return this.
     */
-   Link &operator=(Link &&) = delete;
+   LinkEnd &operator=(LinkEnd &&) = delete;
 
    /**
-    * @return a reference to the linked type. Throws in case the link was detached.
+    * @return true if this end is currently connected to another end.
     */
-   LinkedType &getLinked() const
+   [[nodiscard]] bool isLinked() const noexcept
    {
-      return linked.value();
+      return remote != nullptr;
    }
 
-private:
-   friend Links;
+   /**
+    * Detaches both ends of the pair. Only the owner of the other end is informed.
+    * As the callback may destroy this instance, nothing is accessed after calling it.
+    */
+   void unlink()
+   {
+      if (remote == nullptr)
+      {
+         return;
+      }
+      auto *other = remote;
+      remote = nullptr;
+      other->remote = nullptr;
+      other->unlinked();
+   }
 
-   explicit Link(LinkedType &linked, std::function<void()> localUnlinked)
-      : linked(linked)
-      , localUnlinked(std::move(localUnlinked))
+protected:
+   /**
+    * Constructor.
+    *
+    * @param unlinked the callback to call once the other end is gone.
+    */
+   explicit LinkEnd(LinkCallback unlinked)
+      : unlinked(unlinked)
    {
    }
 
-   void unlink()
+   /**
+    * Takes over the connection of another end. This end must be detached, and the other end is left detached.
+    * Nobody is informed, as the pair stays connected.
+    *
+    * @param other the end to take the connection from.
+    */
+   void takeOverFrom(LinkEnd &other) noexcept
    {
-      if (linked.has_value())
+      remote = other.remote;
+      other.remote = nullptr;
+      if (remote != nullptr)
       {
-         auto local = std::move(localUnlinked);
-         reset();
-         local();
+         remote->remote = this;
       }
    }
 
-   std::function<void()> wrapUnlink()
+private:
+   friend Links;
+
+   LinkEnd *remote = nullptr;
+   LinkCallback unlinked;
+};
+
+/**
+ * A link provides a bi-directional reference between two instances.
+ * Links come in pairs, and as soon as one goes out of scope, the other is informed.
+ *
+ * Links are embedded into the instances that refer to each other. Each end knows the other end directly,
+ * which is why links are neither copied nor moved.
+ *
+ * @tparam LinkedType the type of the referred party.
+ */
+template <class LinkedType> class Link : public LinkEnd
+{
+public:
+   /**
+    * Constructor for a detached link.
+    *
+    * @param unlinked the callback to call once the other end goes out of scope, or is unlinked.
+    */
+   explicit Link(LinkCallback unlinked = {})
+      : LinkEnd(unlinked)
+   {
+   }
+
+   /**
+    * @return a reference to the linked type. Throws in case the link was detached.
+    */
+   LinkedType &getLinked() const
    {
-      return [this]() { unlink(); };
+      if (!isLinked())
+      {
+         throw std::logic_error("link is detached");
+      }
+      return *linked;
    }
 
-   void reset()
+   /**
+    * Takes over the connection of another link, so that an owner can move its link to a new place.
+    * Any previous connection of this link is unlinked first. The other link is left detached, without informing anyone.
+    *
+    * @param other the link to take the connection from.
+    */
+   void takeOver(Link &other)
    {
-      linked.reset();
-      localUnlinked = []() {};
-      remoteUnlink = []() {};
+      unlink();
+      linked = other.linked;
+      takeOverFrom(other);
    }
 
-   std::optional<std::reference_wrapper<LinkedType>> linked;
-   std::function<void()> localUnlinked;
-   std::function<void()> remoteUnlink;
+private:
+   friend Links;
+
+   LinkedType *linked = nullptr;
 };
 
 /**
@@ -107,25 +207,23 @@ public:
    Links() = delete;
 
    /**
-    * Factory function to create a pair of links.
+    * Connects a pair of links. Any previous connection of either link is unlinked first.
     *
+    * @param toA the link that shall refer to the left side.
     * @param a the reference to the left side.
-    * @param aUnlinked the callback to be called if the right side goes out of scope.
+    * @param toB the link that shall refer to the right side.
     * @param b the reference to the right side.
-    * @param bUnlinked the callback to be called if the the left side goes out of scope.
     * @tparam A the type of the left side.
     * @tparam B the type of the right side.
-    * @return a pair of link instances that can call each other when going out of scope.
     */
-   template <class A, class B>
-   [[nodiscard]] static std::pair<std::unique_ptr<Link<A>>, std::unique_ptr<Link<B>>> between(
-      A &a, std::function<void()> aUnlinked, B &b, std::function<void()> bUnlinked)
+   template <class A, class B> static void between(Link<A> &toA, A &a, Link<B> &toB, B &b)
    {
-      std::unique_ptr<Link<A>> aLink(new Link<A>(a, std::move(aUnlinked)));
-      std::unique_ptr<Link<B>> bLink(new Link<B>(b, std::move(bUnlinked)));
-      aLink->remoteUnlink = bLink->wrapUnlink();
-      bLink->remoteUnlink = aLink->wrapUnlink();
-      return { std::move(aLink), std::move(bLink) };
+      toA.unlink();
+      toB.unlink();
+      toA.linked = &a;
+      toB.linked = &b;
+      toA.remote = &toB;
+      toB.remote = &toA;
    }
 };
 
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * A MemoryAccount tracks the memory that one subsystem holds, such as the undo history or the model.
+ *
+ * Accounts are charged by the allocators of the containers of their subsystem, see AccountedAllocator.
+ * They are process-wide, identified by their name, and may be charged from any thread.
+ */
+class MemoryAccount
+{
+public:
+   /**
+    * Snapshot contains the values of an account at one point in time.
+    */
+   struct Snapshot
+   {
+      /** The number of bytes currently held. */
+      size_t liveBytes = 0;
+      /** The highest number of bytes held at once, since the start or the last reset. */
+      size_t peakBytes = 0;
+      /** The number of allocations so far. */
+      size_t allocationCount = 0;
+      /** The number of bytes allocated so far, including those already released. */
+      size_t allocatedBytes = 0;
+   };
+
+   /**
+    * Returns the account of given name, which is created if necessary.
+    * References to accounts stay valid for the lifetime of the process.
+    *
+    * @param name the name of the subsystem.
+    * @return the account of given name.
+    */
+   [[nodiscard]] static MemoryAccount &named(std::string const &name);
+
+   /**
+    * Returns the account of given tag type, which provides the name of the account as static member NAME.
+    *
+    * @tparam Tag the type identifying the account.
+    * @return the account of the tag.
+    */
+   template <class Tag> [[nodiscard]] static MemoryAccount &of()
+   {
+      static MemoryAccount &account = named(Tag::NAME);
+      return account;
+   }
+
+   /**
+    * Calls the given function for each account, in the order they were created.
+    *
+    * @param consumer the function to call.
+    */
+   static void forEach(std::function<void(MemoryAccount const &)> const &consumer);
+
+   /**
+    * Deleted copy constructor.
+    */
+   MemoryAccount(MemoryAccount const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   MemoryAccount(MemoryAccount &&) = delete;
+   ~MemoryAccount() = default;
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   MemoryAccount &operator=(MemoryAccount const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   MemoryAccount &operator=(MemoryAccount &&) = delete;
+
+   /**
+    * @return the name of the subsystem.
+    */
+   [[nodiscard]] std::string const &getName() const;
+
+   /**
+    * Charges an allocation.
+    *
+    * @param bytes the size of the allocation.
+    */
+   void allocated(size_t bytes) noexcept;
+
+   /**
+    * Credits a deallocation.
+    *
+    * @param bytes the size of the released allocation.
+    */
+   void released(size_t bytes) noexcept;
+
+   /**
+    * Lowers the peak to the currently held bytes, for measuring the peak of a following period.
+    */
+   void resetPeak() noexcept;
+
+   /**
+    * @return the current values.
+    */
+   [[nodiscard]] Snapshot snapshot() const noexcept;
+
+private:
+   explicit MemoryAccount(std::string name);
+
+   std::string name;
+   std::atomic<size_t> liveBytes { 0 };
+   std::atomic<size_t> peakBytes { 0 };
+   std::atomic<size_t> allocationCount { 0 };
+   std::atomic<size_t> allocatedBytes { 0 };
+};
+
+/**
+ * AccountedAllocator is a standard allocator that charges the memory account of a tag.
+ * All instances of the same tag are interchangeable.
+ *
+ * @tparam T the type of the allocated objects.
+ * @tparam Tag the type identifying the account, see MemoryAccount::of().
+ */
+template <class T, class Tag> class AccountedAllocator
+{
+public:
+   /** The type of the allocated objects. */
+   using value_type = T;
+
+   /**
+    * Allocators of other types are rebound to the same tag.
+    *
+    * @tparam U the other type.
+    */
+   template <class U> struct rebind
+   {
+      /** The allocator type for the other type. */
+      using other = AccountedAllocator<U, Tag>;
+   };
+
+   /**
+    * Default constructor.
+    */
+   AccountedAllocator() noexcept = default;
+
+   /**
+    * Converting constructor.
+    *
+    * @tparam U the other type.
+    */
+   template <class U> explicit AccountedAllocator(AccountedAllocator<U, Tag> const &) noexcept
+   {
+   }
+
+   /**
+    * Allocates memory for a number of objects.
+    *
+    * @param count the number of objects.
+    * @return the uninitialized memory.
+    */
+   [[nodiscard]] T *allocate(size_t count)
+   {
+      auto *memory = std::allocator<T>().allocate(count);
+      MemoryAccount::of<Tag>().allocated(count * sizeof(T));
+      return memory;
+   }
+
+   /**
+    * Releases memory that was returned by allocate().
+    *
+    * @param memory the memory to release.
+    * @param count the same number of objects as was requested.
+    */
+   void deallocate(T *memory, size_t count) noexcept
+   {
+      MemoryAccount::of<Tag>().released(count * sizeof(T));
+      std::allocator<T>().deallocate(memory, count);
+   }
+
+   /**
+    * Allocators of the same tag are interchangeable.
+    *
+    * @tparam U the other type.
+    * @return true.
+    */
+   template <class U> [[nodiscard]] bool operator==(AccountedAllocator<U, Tag> const &) const noexcept
+   {
+      return true;
+   }
+};
+
+}
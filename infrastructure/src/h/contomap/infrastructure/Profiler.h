@@ -0,0 +1,202 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * A Profiler keeps rolling statistics of named series of samples, such as the durations of the phases of a frame,
+ * or the number of items processed within.
+ *
+ * Samples are only recorded while the profiler is enabled. While disabled, timing a phase costs a single branch.
+ * A profiler is meant to be used from one thread.
+ */
+class Profiler
+{
+public:
+   /**
+    * The number of most recent samples that the statistics are based on.
+    */
+   static size_t const WINDOW_SIZE;
+
+   /**
+    * Unit describes what the samples of a series represent.
+    */
+   enum class Unit
+   {
+      /** Durations, in milliseconds. */
+      Milliseconds,
+      /** Numbers of items. */
+      Count,
+      /** Amounts of memory, in kibibytes. */
+      Kibibytes,
+   };
+
+   /**
+    * Statistics summarize the samples within the window of a series.
+    */
+   struct Statistics
+   {
+      /** The number of samples considered. */
+      size_t sampleCount = 0;
+      /** The smallest sample. */
+      double minimum = 0.0;
+      /** The arithmetic mean of the samples. */
+      double average = 0.0;
+      /** The value that 99 percent of the samples do not exceed. */
+      double percentile99 = 0.0;
+      /** The most recent sample. */
+      double last = 0.0;
+   };
+
+   /**
+    * A Series is a named sequence of samples, of which the most recent ones are kept.
+    */
+   class Series
+   {
+   public:
+      /**
+       * Constructor.
+       *
+       * @param name the name of the series.
+       * @param unit the unit of the samples.
+       */
+      Series(std::string name, Unit unit);
+
+      /**
+       * @return the name of the series.
+       */
+      [[nodiscard]] std::string const &getName() const;
+
+      /**
+       * @return the unit of the samples.
+       */
+      [[nodiscard]] Unit getUnit() const;
+
+      /**
+       * Adds a sample, replacing the oldest one if the window is full.
+       *
+       * @param value the value to add.
+       */
+      void add(double value);
+
+      /**
+       * Removes all samples.
+       */
+      void clear();
+
+      /**
+       * @return the statistics of the current samples.
+       */
+      [[nodiscard]] Statistics statistics() const;
+
+   private:
+      std::string name;
+      Unit unit;
+      std::vector<double> samples;
+      size_t nextIndex = 0;
+   };
+
+   /**
+    * A Timer measures the time from its construction to its destruction, and adds it to a series.
+    * Nothing is measured if the profiler is disabled at construction.
+    */
+   class Timer
+   {
+   public:
+      /**
+       * Constructor.
+       *
+       * @param profiler the profiler that determines whether to measure.
+       * @param series the series to add the duration to.
+       */
+      Timer(Profiler const &profiler, Series &series);
+      /**
+       * Deleted copy constructor.
+       */
+      Timer(Timer const &) = delete;
+      /**
+       * Deleted move constructor.
+       */
+      Timer(Timer &&) = delete;
+      /**
+       * Destructor. Adds the measured duration.
+       */
+      ~Timer();
+
+      /**
+       * Deleted copy assignment operator.
+       * @return this.
+       */
+      Timer &operator=(Timer const &) = delete;
+      /**
+       * Deleted move assignment operator.
+       * @return this.
+       */
+      Timer &operator=(Timer &&) = delete;
+
+   private:
+      Series *series;
+      std::chrono::steady_clock::time_point start;
+   };
+
+   /**
+    * Returns the series of given name, which is created if necessary.
+    * References to series stay valid for the lifetime of the profiler.
+    *
+    * @param name the name of the series.
+    * @param unit the unit of the samples, for a new series.
+    * @return the series of given name.
+    */
+   [[nodiscard]] Series &series(std::string const &name, Unit unit);
+
+   /**
+    * Adds a sample to the given series, if enabled.
+    *
+    * @param series the series to add to.
+    * @param value the value to add.
+    */
+   void record(Series &series, double value) const;
+
+   /**
+    * Enables or disables the recording of samples. Samples are cleared when recording is enabled.
+    *
+    * @param value true to record samples.
+    */
+   void setEnabled(bool value);
+
+   /**
+    * @return true if samples are recorded.
+    */
+   [[nodiscard]] bool isEnabled() const noexcept
+   {
+      return enabled;
+   }
+
+   /**
+    * Calls the given function for each series, in the order they were created.
+    *
+    * @param consumer the function to call.
+    */
+   void forEach(std::function<void(Series const &)> const &consumer) const;
+
+   /**
+    * Writes the statistics of all series as comma-separated values, with a header line.
+    *
+    * @param out the stream to write to.
+    */
+   void writeCsv(std::ostream &out) const;
+
+private:
+   bool enabled = false;
+   std::vector<std::unique_ptr<Series>> allSeries;
+};
+
+} // namespace contomap::infrastructure
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "contomap/infrastructure/MemoryAccount.h"
+
+namespace contomap::infrastructure
+{
+
+/**
+ * A SlabPool provides the memory for objects of one type from larger blocks, the slabs.
+ *
+ * Objects keep their address for their whole lifetime, and the memory of destroyed objects is reused for new ones.
+ * Objects that are created one after the other are placed next to each other.
+ * All slabs are released at once when the pool is destroyed. This requires that all objects were destroyed before.
+ * Optionally, the slabs are charged to a memory account.
+ *
+ * @tparam T the type of the objects.
+ * @tparam ObjectsPerSlab the number of objects that fit into one slab.
+ */
+template <class T, size_t ObjectsPerSlab = 256> class SlabPool
+{
+public:
+   /**
+    * Deleter destroys objects of a pool, for use with std::unique_ptr.
+    * Without a pool, objects are deleted from the heap.
+    */
+   class Deleter
+   {
+   public:
+      /**
+       * Default constructor, for objects that were allocated from the heap.
+       */
+      Deleter() = default;
+
+      /**
+       * Constructor.
+       *
+       * @param pool the pool the objects were created in.
+       */
+      explicit Deleter(SlabPool *pool)
+         : pool(pool)
+      {
+      }
+
+      /**
+       * Destroys the given object.
+       *
+       * @param object the instance to destroy.
+       */
+      void operator()(T *object) const noexcept
+      {
+         if (pool != nullptr)
+         {
+            pool->destroy(object);
+         }
+         else
+         {
+            delete object;
+         }
+      }
+
+   private:
+      SlabPool *pool = nullptr;
+   };
+
+   /** Pointer is an owning pointer to an object of a pool. */
+   using Pointer = std::unique_ptr<T, Deleter>;
+
+   /**
+    * Default constructor.
+    */
+   SlabPool() = default;
+   /**
+    * Constructor.
+    *
+    * @param account the account to charge the slabs to. May be nullptr.
+    */
+   explicit SlabPool(MemoryAccount *account)
+      : account(account)
+   {
+   }
+   /**
+    * Deleted copy constructor.
+    */
+   SlabPool(SlabPool const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   SlabPool(SlabPool &&) = delete;
+   ~SlabPool()
+   {
+      if (account != nullptr)
+      {
+         account->released(slabs.size() * SLAB_SIZE);
+      }
+   }
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   SlabPool &operator=(SlabPool const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   SlabPool &operator=(SlabPool &&) = delete;
+
+   /**
+    * Creates an owned object, either in given pool, or on the heap if there is no pool.
+    *
+    * @param pool the pool to create the object in. May be nullptr.
+    * @param args the arguments for the constructor.
+    * @tparam Args the types of the arguments.
+    * @return the owning pointer of the created object.
+    */
+   template <class... Args> [[nodiscard]] static Pointer make(SlabPool *pool, Args &&...args)
+   {
+      if (pool == nullptr)
+      {
+         return Pointer(new T(std::forward<Args>(args)...));
+      }
+      return Pointer(pool->create(std::forward<Args>(args)...), Deleter(pool));
+   }
+
+   /**
+    * Creates an object in this pool.
+    *
+    * @param args the arguments for the constructor.
+    * @tparam Args the types of the arguments.
+    * @return the created object, which must be passed to destroy() eventually.
+    */
+   template <class... Args> [[nodiscard]] T *create(Args &&...args)
+   {
+      Slot *slot = acquire();
+      try
+      {
+         T *object = ::new (static_cast<void *>(slot->storage)) T(std::forward<Args>(args)...);
+         liveCount++;
+         return object;
+      }
+      catch (...)
+      {
+         release(slot);
+         throw;
+      }
+   }
+
+   /**
+    * Destroys an object that was created in this pool. Its memory is reused for the next object.
+    *
+    * @param object the object to destroy.
+    */
+   void destroy(T *object) noexcept
+   {
+      object->~T();
+      liveCount--;
+      release(reinterpret_cast<Slot *>(object));
+   }
+
+   /**
+    * @return the number of objects currently alive in this pool.
+    */
+   [[nodiscard]] size_t size() const noexcept
+   {
+      return liveCount;
+   }
+
+   /**
+    * @return the number of allocated slabs.
+    */
+   [[nodiscard]] size_t slabCount() const noexcept
+   {
+      return slabs.size();
+   }
+
+private:
+   union Slot
+   {
+      Slot *nextFree;
+      alignas(T) std::byte storage[sizeof(T)];
+   };
+
+   static size_t constexpr SLAB_SIZE = sizeof(Slot) * ObjectsPerSlab;
+
+   Slot *acquire()
+   {
+      if (freeSlots != nullptr)
+      {
+         Slot *slot = freeSlots;
+         freeSlots = slot->nextFree;
+         return slot;
+      }
+      if (slabs.empty() || (usedInLastSlab == ObjectsPerSlab))
+      {
+         // The slots are left uninitialized, as each is constructed on demand.
+         slabs.emplace_back(new Slot[ObjectsPerSlab]);
+         usedInLastSlab = 0;
+         if (account != nullptr)
+         {
+            account->allocated(SLAB_SIZE);
+         }
+      }
+      return &slabs.back()[usedInLastSlab++];
+   }
+
+   void release(Slot *slot) noexcept
+   {
+      slot->nextFree = freeSlots;
+      freeSlots = slot;
+   }
+
+   MemoryAccount *account = nullptr;
+   std::vector<std::unique_ptr<Slot[]>> slabs;
+   size_t usedInLastSlab = 0;
+   Slot *freeSlots = nullptr;
+   size_t liveCount = 0;
+};
+
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace contomap::infrastructure
+{
+
+class TaskGroup;
+
+/**
+ * A TaskScheduler runs tasks on a fixed set of worker threads, which steal work from each other.
+ *
+ * Each worker keeps its own queue of tasks. Tasks that a worker spawns are added to its own queue, and taken back
+ * last-in-first-out, so that related work stays on the same thread. Idle workers take tasks from the opposite end
+ * of the queues of the others. Tasks spawned from outside the workers are shared through a common queue.
+ *
+ * A scheduler without workers is deterministic: all tasks run immediately on the spawning thread, in the order they
+ * are spawned. This mode is meant for tests and for platforms without threads.
+ *
+ * Tasks are spawned and joined through TaskGroup. Threads that wait for a group help running queued tasks meanwhile.
+ */
+class TaskScheduler
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param workerCount the number of threads to start. Zero for the deterministic mode.
+    */
+   explicit TaskScheduler(size_t workerCount);
+   /**
+    * Deleted copy constructor.
+    */
+   TaskScheduler(TaskScheduler const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   TaskScheduler(TaskScheduler &&) = delete;
+   /**
+    * Destructor. Stops the workers; all task groups must have been waited for.
+    */
+   ~TaskScheduler();
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   TaskScheduler &operator=(TaskScheduler const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   TaskScheduler &operator=(TaskScheduler &&) = delete;
+
+   /**
+    * @return the number of workers that suits this platform: one less than the hardware threads, and none without threads.
+    */
+   [[nodiscard]] static size_t defaultWorkerCount();
+
+   /**
+    * @return the number of worker threads.
+    */
+   [[nodiscard]] size_t workerCount() const noexcept;
+
+   /**
+    * @return the number of threads that can work on tasks at the same time, including the waiting thread.
+    */
+   [[nodiscard]] size_t concurrency() const noexcept;
+
+   /**
+    * Runs the body for all indices of the range, split into chunks that may run in parallel.
+    * Returns once all chunks are done. If any chunk throws, the first exception is rethrown.
+    *
+    * @param begin the first index of the range.
+    * @param end the index past the last one of the range.
+    * @param grainSize the maximum number of indices per chunk. Zero to give each thread a few chunks.
+    * @param body the function to call with the first index, and the index past the last one, of each chunk.
+    */
+   void parallelFor(size_t begin, size_t end, size_t grainSize, std::function<void(size_t, size_t)> const &body);
+
+private:
+   friend TaskGroup;
+
+   struct Job
+   {
+      std::function<void()> task;
+      TaskGroup *group = nullptr;
+   };
+
+   struct WorkerQueue
+   {
+      std::mutex lock;
+      std::deque<Job> jobs;
+   };
+
+   void spawn(Job job);
+   [[nodiscard]] bool runNextJob();
+   [[nodiscard]] bool tryTake(Job &job);
+   [[nodiscard]] size_t currentWorkerIndex() const noexcept;
+   void runWorker(size_t index);
+   static void run(Job &job) noexcept;
+
+   std::vector<std::unique_ptr<WorkerQueue>> queues;
+   WorkerQueue sharedQueue;
+   std::vector<std::thread> workers;
+
+   std::atomic<size_t> queuedCount { 0 };
+   std::atomic<bool> stopping { false };
+   std::mutex sleepLock;
+   std::condition_variable wakeUp;
+};
+
+/**
+ * A TaskGroup spawns tasks on a scheduler and joins them.
+ *
+ * The group must be waited for before it is destroyed, or else the destructor waits and drops any exception.
+ */
+class TaskGroup
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param scheduler the scheduler to run the tasks on.
+    */
+   explicit TaskGroup(TaskScheduler &scheduler);
+   /**
+    * Deleted copy constructor.
+    */
+   TaskGroup(TaskGroup const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   TaskGroup(TaskGroup &&) = delete;
+   /**
+    * Destructor. Waits for all remaining tasks.
+    */
+   ~TaskGroup();
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   TaskGroup &operator=(TaskGroup const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   TaskGroup &operator=(TaskGroup &&) = delete;
+
+   /**
+    * Spawns a task. In the deterministic mode, the task runs immediately.
+    *
+    * @param task the function to run.
+    */
+   void run(std::function<void()> task);
+
+   /**
+    * Waits until all spawned tasks are done, running queued tasks meanwhile.
+    * If any task threw, the first exception is rethrown, and the others are dropped.
+    */
+   void wait();
+
+private:
+   friend TaskScheduler;
+
+   void fail(std::exception_ptr exception) noexcept;
+   void finishOne() noexcept;
+   void join() noexcept;
+
+   TaskScheduler &scheduler;
+   std::atomic<size_t> pendingCount { 0 };
+   std::mutex lock;
+   std::condition_variable finished;
+   std::exception_ptr firstException;
+};
+
+}
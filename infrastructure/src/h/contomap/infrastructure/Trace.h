@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+namespace contomap::infrastructure
+{
+
+/**
+ * Trace records nested zones and counters of the running threads, for inspection as Chrome trace events,
+ * for example with Perfetto or chrome://tracing.
+ *
+ * Each thread records into a ring buffer of its own, without taking locks. When a buffer is full, its oldest events
+ * are overwritten. Names must be string literals, or else outlive the trace, as only their pointers are recorded.
+ *
+ * Code is instrumented through the CONTOMAP_TRACE_ macros, which only record if the build defines CONTOMAP_TRACING,
+ * see the CMake option CONTOMAP_ENABLE_TRACING. Without it, the macros compile to nothing.
+ */
+class Trace
+{
+public:
+   /**
+    * The number of events that the buffer of each thread holds.
+    */
+   static size_t const BUFFER_CAPACITY;
+
+   /**
+    * A Zone records the span from its construction to its destruction.
+    */
+   class Zone
+   {
+   public:
+      /**
+       * Constructor. Records the begin of the zone.
+       *
+       * @param name the name of the zone.
+       */
+      explicit Zone(char const *name) noexcept;
+      /**
+       * Deleted copy constructor.
+       */
+      Zone(Zone const &) = delete;
+      /**
+       * Deleted move constructor.
+       */
+      Zone(Zone &&) = delete;
+      /**
+       * Destructor. Records the end of the zone.
+       */
+      ~Zone();
+
+      /**
+       * Deleted copy assignment operator.
+       * @return this.
+       */
+      Zone &operator=(Zone const &) = delete;
+      /**
+       * Deleted move assignment operator.
+       * @return this.
+       */
+      Zone &operator=(Zone &&) = delete;
+
+   private:
+      char const *name;
+   };
+
+   /**
+    * Records the current value of a counter.
+    *
+    * @param name the name of the counter.
+    * @param value the value to record.
+    */
+   static void counter(char const *name, double value) noexcept;
+
+   /**
+    * Writes all recorded events in the JSON format of Chrome trace events.
+    * Threads should not record meanwhile, as their most recent events may be skipped otherwise.
+    *
+    * @param out the stream to write to.
+    */
+   static void writeChromeJson(std::ostream &out);
+
+   /**
+    * Drops all recorded events. Threads must not record meanwhile.
+    */
+   static void clear();
+};
+
+} // namespace contomap::infrastructure
+
+#ifdef CONTOMAP_TRACING
+#define CONTOMAP_TRACE_CONCAT_DETAIL(a, b) a##b
+#define CONTOMAP_TRACE_CONCAT(a, b) CONTOMAP_TRACE_CONCAT_DETAIL(a, b)
+/** Records a zone, from here to the end of the enclosing block. */
+#define CONTOMAP_TRACE_ZONE(name) contomap::infrastructure::Trace::Zone CONTOMAP_TRACE_CONCAT(traceZone, __LINE__)(name)
+/** Records the current value of a counter. */
+#define CONTOMAP_TRACE_COUNTER(name, value) contomap::infrastructure::Trace::counter(name, static_cast<double>(value))
+#else
+/** Records a zone, from here to the end of the enclosing block. */
+#define CONTOMAP_TRACE_ZONE(name) static_cast<void>(0)
+/** Records the current value of a counter. */
+#define CONTOMAP_TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
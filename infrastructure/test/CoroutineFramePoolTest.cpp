@@ -0,0 +1,96 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/CoroutineFramePool.h"
+#include "contomap/infrastructure/Generator.h"
+#include "contomap/infrastructure/MemoryAccount.h"
+
+using contomap::infrastructure::CoroutineFramePool;
+using contomap::infrastructure::Generator;
+using contomap::infrastructure::MemoryAccount;
+
+static Generator<int> countTo(int last) // NOLINT
+{
+   for (int i = 0; i < last; i++)
+   {
+      co_yield i;
+   }
+}
+
+static int sumOfNested(int outer, int inner)
+{
+   int sum = 0;
+   for (int a : countTo(outer))
+   {
+      for (int b : countTo(inner))
+      {
+         sum += a * b;
+      }
+   }
+   return sum;
+}
+
+TEST(CoroutineFramePoolTest, steadyStateGeneratorsAllocateNoFrames)
+{
+   auto warmUp = sumOfNested(10, 10);
+   auto before = CoroutineFramePool::statistics();
+   auto steady = sumOfNested(10, 10);
+   auto after = CoroutineFramePool::statistics();
+
+   EXPECT_EQ(warmUp, steady);
+   EXPECT_EQ(before.heapAllocationCount, after.heapAllocationCount);
+   EXPECT_EQ(before.recycledCount + 11, after.recycledCount);
+}
+
+TEST(CoroutineFramePoolTest, framesOfSimilarSizeShareBuckets)
+{
+   void *first = CoroutineFramePool::allocate(100);
+   CoroutineFramePool::deallocate(first, 100);
+   void *second = CoroutineFramePool::allocate(120);
+   EXPECT_EQ(first, second);
+   CoroutineFramePool::deallocate(second, 120);
+}
+
+TEST(CoroutineFramePoolTest, largeFramesUseTheHeap)
+{
+   size_t size = CoroutineFramePool::MAX_BUCKET_SIZE + 1;
+   void *frame = CoroutineFramePool::allocate(size);
+   CoroutineFramePool::deallocate(frame, size);
+
+   auto before = CoroutineFramePool::statistics();
+   frame = CoroutineFramePool::allocate(size);
+   CoroutineFramePool::deallocate(frame, size);
+   auto after = CoroutineFramePool::statistics();
+   EXPECT_EQ(before.heapAllocationCount + 1, after.heapAllocationCount);
+   EXPECT_EQ(before.recycledCount, after.recycledCount);
+}
+
+TEST(CoroutineFramePoolTest, threadsKeepSeparatePools)
+{
+   static_cast<void>(sumOfNested(2, 2));
+   CoroutineFramePool::Statistics threadStatistics;
+   std::thread other([&threadStatistics]() {
+      static_cast<void>(sumOfNested(2, 2));
+      threadStatistics = CoroutineFramePool::statistics();
+   });
+   other.join();
+
+   EXPECT_EQ(2, threadStatistics.heapAllocationCount);
+   EXPECT_EQ(1, threadStatistics.recycledCount);
+}
+
+TEST(CoroutineFramePoolTest, heldFramesAreChargedUntilTheirThreadEnds)
+{
+   auto &account = MemoryAccount::of<CoroutineFramePool::MemoryTag>();
+   auto before = account.snapshot();
+   std::thread other([&account, &before]() {
+      static_cast<void>(sumOfNested(2, 2));
+      EXPECT_LT(before.liveBytes, account.snapshot().liveBytes) << "released frames should be kept in the free lists";
+   });
+   other.join();
+
+   auto after = account.snapshot();
+   EXPECT_EQ(before.liveBytes, after.liveBytes);
+   EXPECT_EQ(before.allocationCount + 2, after.allocationCount);
+}
@@ -0,0 +1,143 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include "contomap/infrastructure/InlineMap.h"
+
+using contomap::infrastructure::InlineMap;
+
+class Counted
+{
+public:
+   explicit Counted(int &liveCounter, bool fail = false)
+      : liveCounter(&liveCounter)
+   {
+      if (fail)
+      {
+         throw std::runtime_error("construction failed");
+      }
+      liveCounter++;
+   }
+   Counted(Counted const &) = delete;
+   Counted(Counted &&other) noexcept
+      : liveCounter(other.liveCounter)
+   {
+      other.liveCounter = nullptr;
+   }
+   ~Counted()
+   {
+      if (liveCounter != nullptr)
+      {
+         (*liveCounter)--;
+      }
+   }
+   Counted &operator=(Counted const &) = delete;
+   Counted &operator=(Counted &&) = delete;
+
+private:
+   int *liveCounter;
+};
+
+template <class Map> std::vector<int> keysOf(Map const &map)
+{
+   std::vector<int> keys;
+   for (auto const &[key, value] : map)
+   {
+      keys.push_back(key);
+   }
+   return keys;
+}
+
+TEST(InlineMapTest, entriesAreKeptSortedByKey)
+{
+   InlineMap<int, std::string, 2> map;
+   EXPECT_TRUE(map.empty());
+   EXPECT_TRUE(map.tryEmplace(5, "five").second);
+   EXPECT_TRUE(map.tryEmplace(1, "one").second);
+   EXPECT_TRUE(map.tryEmplace(3, "three").second) << "should grow beyond inline capacity";
+   EXPECT_FALSE(map.tryEmplace(3, "other").second) << "should keep existing entry";
+
+   EXPECT_THAT(keysOf(map), testing::ElementsAre(1, 3, 5));
+   ASSERT_NE(map.end(), map.find(3));
+   EXPECT_EQ("three", map.find(3)->second);
+   EXPECT_EQ(map.end(), map.find(4));
+}
+
+TEST(InlineMapTest, entriesCanBeRemoved)
+{
+   InlineMap<int, std::string, 4> map;
+   for (int key : { 4, 2, 6, 1, 3 })
+   {
+      static_cast<void>(map.tryEmplace(key, std::to_string(key)));
+   }
+   EXPECT_EQ(1, map.erase(2));
+   EXPECT_EQ(0, map.erase(2));
+   EXPECT_EQ(2, map.eraseIf([](auto const &kvp) { return (kvp.first % 2) == 0; }));
+   EXPECT_THAT(keysOf(map), testing::ElementsAre(1, 3));
+}
+
+TEST(InlineMapTest, valuesAreDestroyedExactlyOnce)
+{
+   int live = 0;
+   {
+      InlineMap<int, Counted, 2> map;
+      for (int key = 0; key < 5; key++)
+      {
+         static_cast<void>(map.tryEmplace(key, live));
+      }
+      EXPECT_EQ(5, live);
+      static_cast<void>(map.erase(2));
+      EXPECT_EQ(4, live);
+   }
+   EXPECT_EQ(0, live);
+}
+
+TEST(InlineMapTest, failingConstructionLeavesTheMapUnchanged)
+{
+   int live = 0;
+   InlineMap<int, Counted, 2> map;
+   static_cast<void>(map.tryEmplace(1, live));
+   static_cast<void>(map.tryEmplace(3, live));
+   EXPECT_THROW(static_cast<void>(map.tryEmplace(2, live, true)), std::runtime_error);
+   EXPECT_THAT(keysOf(map), testing::ElementsAre(1, 3));
+   EXPECT_EQ(2, live);
+}
+
+TEST(InlineMapTest, removedEntryIsDestroyedAfterLeavingTheMap)
+{
+   struct Observer
+   {
+      InlineMap<int, Observer, 2> const *map = nullptr;
+      std::vector<size_t> *observedSizes = nullptr;
+
+      Observer(InlineMap<int, Observer, 2> const *map, std::vector<size_t> *observedSizes)
+         : map(map)
+         , observedSizes(observedSizes)
+      {
+      }
+      Observer(Observer &&other) noexcept
+         : map(other.map)
+         , observedSizes(other.observedSizes)
+      {
+         other.observedSizes = nullptr;
+      }
+      ~Observer()
+      {
+         if (observedSizes != nullptr)
+         {
+            observedSizes->push_back(map->size());
+         }
+      }
+   };
+   std::vector<size_t> observedSizes;
+   {
+      InlineMap<int, Observer, 2> map;
+      static_cast<void>(map.tryEmplace(1, &map, &observedSizes));
+      static_cast<void>(map.tryEmplace(2, &map, &observedSizes));
+      static_cast<void>(map.erase(1));
+      EXPECT_THAT(observedSizes, testing::ElementsAre(1));
+      observedSizes.clear();
+   }
+}
@@ -0,0 +1,61 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/InternedString.h"
+
+using contomap::infrastructure::InternedString;
+
+TEST(InternedStringTest, defaultIsEmpty)
+{
+   InternedString value;
+   EXPECT_TRUE(value.empty());
+   EXPECT_EQ("", value.view());
+   EXPECT_EQ(InternedString::of(""), value);
+}
+
+TEST(InternedStringTest, equalContentsShareStorage)
+{
+   auto a = InternedString::of("shared content that is longer than small strings");
+   auto b = InternedString::of(std::string("shared content that is longer than small strings"));
+   EXPECT_EQ(a, b);
+   EXPECT_EQ(a.c_str(), b.c_str());
+   EXPECT_NE(a, InternedString::of("other"));
+}
+
+TEST(InternedStringTest, orderingFollowsContent)
+{
+   auto a = InternedString::of("apple");
+   auto b = InternedString::of("banana");
+   EXPECT_LT(a, b);
+   EXPECT_GT(b, a);
+   EXPECT_EQ(std::strong_ordering::equal, a <=> InternedString::of("apple"));
+}
+
+TEST(InternedStringTest, poolKeepsOnlyDistinctReferencedContents)
+{
+   auto before = InternedString::poolStatistics();
+   {
+      std::vector<InternedString> values;
+      for (int i = 0; i < 1000; i++)
+      {
+         values.emplace_back(InternedString::of("repeated-name-" + std::to_string(i % 10)));
+      }
+      auto during = InternedString::poolStatistics();
+      EXPECT_EQ(before.entryCount + 10, during.entryCount);
+      EXPECT_EQ(before.byteCount + (10 * 15), during.byteCount);
+   }
+   auto after = InternedString::poolStatistics();
+   EXPECT_EQ(before.entryCount, after.entryCount);
+   EXPECT_EQ(before.byteCount, after.byteCount);
+}
+
+TEST(InternedStringTest, contentCanBeInternedAgainAfterRelease)
+{
+   std::string content = "transient content";
+   {
+      auto first = InternedString::of(content);
+   }
+   auto second = InternedString::of(content);
+   EXPECT_EQ(content, second.str());
+}
@@ -1,30 +1,81 @@
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "contomap/infrastructure/Link.h"
 
 using contomap::infrastructure::Link;
+using contomap::infrastructure::LinkCallback;
 using contomap::infrastructure::Links;
 
+class UnlinkCounter
+{
+public:
+   void unlinked()
+   {
+      count++;
+   }
+
+   size_t count = 0;
+};
+
 TEST(LinkTest, linkBehaviour)
 {
-   size_t aUnlinks = 0;
-   size_t bUnlinks = 0;
-   auto aUnlinked = [&aUnlinks]() { aUnlinks++; };
-   auto bUnlinked = [&bUnlinks]() { bUnlinks++; };
+   UnlinkCounter aUnlinks;
+   UnlinkCounter bUnlinks;
    int a = 0;
    float b = 0.0f;
-   auto links = Links::between(a, aUnlinked, b, bUnlinked);
-   EXPECT_EQ(aUnlinks, 0) << "should not unlink A during construction";
-   EXPECT_EQ(bUnlinks, 0) << "should not unlink B during construction";
+   auto toA = std::make_unique<Link<int>>(LinkCallback::to<&UnlinkCounter::unlinked>(aUnlinks));
+   auto toB = std::make_unique<Link<float>>(LinkCallback::to<&UnlinkCounter::unlinked>(bUnlinks));
+   Links::between(*toA, a, *toB, b);
+   EXPECT_EQ(aUnlinks.count, 0) << "should not unlink A during construction";
+   EXPECT_EQ(bUnlinks.count, 0) << "should not unlink B during construction";
+
+   EXPECT_EQ(&a, &toA->getLinked()) << "should provide reference to A";
+   EXPECT_EQ(&b, &toB->getLinked()) << "should provide reference to B";
 
-   EXPECT_EQ(&a, &links.first->getLinked()) << "should provide reference to A";
-   EXPECT_EQ(&b, &links.second->getLinked()) << "should provide reference to B";
+   toA.reset();
+   EXPECT_EQ(aUnlinks.count, 0) << "should not unlink A during destruction of A";
+   EXPECT_EQ(bUnlinks.count, 1) << "should unlink B during destruction of A";
+   EXPECT_FALSE(toB->isLinked()) << "B should be detached";
 
-   links.first.reset();
-   EXPECT_EQ(aUnlinks, 0) << "should not unlink A during destruction of A";
-   EXPECT_EQ(bUnlinks, 1) << "should unlink B during destruction of A";
+   toB.reset();
+   EXPECT_EQ(aUnlinks.count, 0) << "should not unlink A during destruction of unlinked B";
+   EXPECT_EQ(bUnlinks.count, 1) << "should not unlink B during destruction of B";
+}
+
+TEST(LinkTest, explicitUnlinkInformsOnlyTheOtherSide)
+{
+   UnlinkCounter aUnlinks;
+   UnlinkCounter bUnlinks;
+   int a = 0;
+   float b = 0.0f;
+   Link<int> toA(LinkCallback::to<&UnlinkCounter::unlinked>(aUnlinks));
+   Link<float> toB(LinkCallback::to<&UnlinkCounter::unlinked>(bUnlinks));
+   Links::between(toA, a, toB, b);
+
+   toB.unlink();
+   EXPECT_EQ(aUnlinks.count, 1) << "should unlink A when B is unlinked";
+   EXPECT_EQ(bUnlinks.count, 0) << "should not inform the side that unlinked";
+   EXPECT_THROW(static_cast<void>(toA.getLinked()), std::logic_error);
+
+   toA.unlink();
+   EXPECT_EQ(aUnlinks.count, 1) << "should not unlink again";
+}
+
+TEST(LinkTest, relinkingDetachesThePreviousPartner)
+{
+   UnlinkCounter previousUnlinks;
+   int a = 0;
+   float b = 0.0f;
+   float c = 0.0f;
+   Link<int> toA;
+   Link<float> toB(LinkCallback::to<&UnlinkCounter::unlinked>(previousUnlinks));
+   Link<float> toC;
+   Links::between(toA, a, toB, b);
 
-   links.second.reset();
-   EXPECT_EQ(aUnlinks, 0) << "should not unlink A during destruction of unlinked B";
-   EXPECT_EQ(bUnlinks, 1) << "should not unlink B during destruction of B";
+   Links::between(toA, a, toC, c);
+   EXPECT_EQ(previousUnlinks.count, 1) << "previous partner should be informed";
+   EXPECT_FALSE(toB.isLinked());
+   EXPECT_EQ(&c, &toC.getLinked());
 }
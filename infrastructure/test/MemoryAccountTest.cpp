@@ -0,0 +1,75 @@
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/MemoryAccount.h"
+
+using contomap::infrastructure::AccountedAllocator;
+using contomap::infrastructure::MemoryAccount;
+
+struct TestMemoryTag
+{
+   static char const *const NAME;
+};
+
+char const *const TestMemoryTag::NAME = "MemoryAccountTest";
+
+TEST(MemoryAccountTest, accountsAreIdentifiedByName)
+{
+   EXPECT_EQ(&MemoryAccount::named("MemoryAccountTest"), &MemoryAccount::of<TestMemoryTag>());
+   EXPECT_NE(&MemoryAccount::named("MemoryAccountTest"), &MemoryAccount::named("MemoryAccountTest other"));
+
+   bool listed = false;
+   MemoryAccount::forEach([&listed](MemoryAccount const &account) { listed = listed || (account.getName() == "MemoryAccountTest"); });
+   EXPECT_TRUE(listed);
+}
+
+TEST(MemoryAccountTest, liveAndPeakBytesFollowAllocations)
+{
+   auto &account = MemoryAccount::named("MemoryAccountTest peak");
+   auto before = account.snapshot();
+   account.allocated(100);
+   account.allocated(50);
+   account.released(100);
+   auto after = account.snapshot();
+   EXPECT_EQ(before.liveBytes + 50, after.liveBytes);
+   EXPECT_EQ(before.liveBytes + 150, after.peakBytes);
+   EXPECT_EQ(before.allocationCount + 2, after.allocationCount);
+   EXPECT_EQ(before.allocatedBytes + 150, after.allocatedBytes);
+
+   account.resetPeak();
+   EXPECT_EQ(after.liveBytes, account.snapshot().peakBytes);
+   account.released(50);
+}
+
+TEST(MemoryAccountTest, allocatorChargesItsTag)
+{
+   auto &account = MemoryAccount::of<TestMemoryTag>();
+   auto before = account.snapshot();
+   {
+      std::vector<int, AccountedAllocator<int, TestMemoryTag>> values;
+      values.reserve(100);
+      EXPECT_EQ(before.liveBytes + (100 * sizeof(int)), account.snapshot().liveBytes);
+   }
+   auto after = account.snapshot();
+   EXPECT_EQ(before.liveBytes, after.liveBytes);
+   EXPECT_EQ(before.allocationCount + 1, after.allocationCount);
+}
+
+TEST(MemoryAccountTest, accountsCanBeChargedFromSeveralThreads)
+{
+   auto &account = MemoryAccount::named("MemoryAccountTest threads");
+   auto before = account.snapshot();
+   auto charge = [&account]() {
+      for (size_t i = 0; i < 1000; i++)
+      {
+         account.allocated(8);
+      }
+   };
+   std::thread other(charge);
+   charge();
+   other.join();
+   EXPECT_EQ(before.liveBytes + 16000, account.snapshot().liveBytes);
+   account.released(16000);
+}
@@ -0,0 +1,70 @@
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/Profiler.h"
+
+using contomap::infrastructure::Profiler;
+
+TEST(ProfilerTest, disabledProfilerRecordsNothing)
+{
+   Profiler profiler;
+   auto &phase = profiler.series("phase", Profiler::Unit::Milliseconds);
+   auto &items = profiler.series("items", Profiler::Unit::Count);
+   {
+      Profiler::Timer timer(profiler, phase);
+   }
+   profiler.record(items, 10.0);
+   EXPECT_EQ(0, phase.statistics().sampleCount);
+   EXPECT_EQ(0, items.statistics().sampleCount);
+
+   profiler.setEnabled(true);
+   {
+      Profiler::Timer timer(profiler, phase);
+   }
+   profiler.record(items, 10.0);
+   EXPECT_EQ(1, phase.statistics().sampleCount);
+   EXPECT_EQ(1, items.statistics().sampleCount);
+}
+
+TEST(ProfilerTest, statisticsCoverTheMostRecentWindow)
+{
+   Profiler::Series series("values", Profiler::Unit::Count);
+   for (size_t i = 1; i <= Profiler::WINDOW_SIZE + 10; i++)
+   {
+      series.add(static_cast<double>(i));
+   }
+   auto stats = series.statistics();
+   EXPECT_EQ(Profiler::WINDOW_SIZE, stats.sampleCount);
+   EXPECT_DOUBLE_EQ(11.0, stats.minimum);
+   EXPECT_DOUBLE_EQ(static_cast<double>(Profiler::WINDOW_SIZE + 10), stats.last);
+   EXPECT_DOUBLE_EQ((11.0 + static_cast<double>(Profiler::WINDOW_SIZE + 10)) / 2.0, stats.average);
+   EXPECT_LE(stats.percentile99, stats.last);
+   EXPECT_GE(stats.percentile99, static_cast<double>(Profiler::WINDOW_SIZE));
+}
+
+TEST(ProfilerTest, percentileIgnoresRareOutliers)
+{
+   Profiler::Series series("values", Profiler::Unit::Milliseconds);
+   for (size_t i = 0; i < 200; i++)
+   {
+      series.add((i == 50) ? 1000.0 : 1.0);
+   }
+   EXPECT_DOUBLE_EQ(1.0, series.statistics().percentile99);
+}
+
+TEST(ProfilerTest, seriesAreWrittenAsCsvInOrderOfCreation)
+{
+   Profiler profiler;
+   profiler.setEnabled(true);
+   profiler.record(profiler.series("b", Profiler::Unit::Count), 2.0);
+   profiler.record(profiler.series("a", Profiler::Unit::Milliseconds), 1.5);
+   EXPECT_EQ(&profiler.series("b", Profiler::Unit::Count), &profiler.series("b", Profiler::Unit::Count));
+
+   std::ostringstream out;
+   profiler.writeCsv(out);
+   EXPECT_EQ("series,unit,samples,min,avg,p99,last\n"
+             "b,count,1,2,2,2,2\n"
+             "a,ms,1,1.5,1.5,1.5,1.5\n",
+      out.str());
+}
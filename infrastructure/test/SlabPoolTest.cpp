@@ -0,0 +1,122 @@
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/MemoryAccount.h"
+#include "contomap/infrastructure/SlabPool.h"
+
+using contomap::infrastructure::MemoryAccount;
+using contomap::infrastructure::SlabPool;
+
+class Tracked
+{
+public:
+   explicit Tracked(int &liveCounter, bool fail = false)
+      : liveCounter(liveCounter)
+   {
+      if (fail)
+      {
+         throw std::runtime_error("construction failed");
+      }
+      liveCounter++;
+   }
+   Tracked(Tracked const &) = delete;
+   Tracked(Tracked &&) = delete;
+   ~Tracked()
+   {
+      liveCounter--;
+   }
+   Tracked &operator=(Tracked const &) = delete;
+   Tracked &operator=(Tracked &&) = delete;
+
+private:
+   int &liveCounter;
+};
+
+TEST(SlabPoolTest, objectsAreKeptInSlabs)
+{
+   int live = 0;
+   SlabPool<Tracked, 4> pool;
+   std::vector<Tracked *> objects;
+   for (int i = 0; i < 9; i++)
+   {
+      objects.emplace_back(pool.create(live));
+   }
+   EXPECT_EQ(9, live);
+   EXPECT_EQ(9, pool.size());
+   EXPECT_EQ(3, pool.slabCount());
+   EXPECT_EQ(objects[0] + 1, objects[1]) << "consecutive objects should be adjacent";
+
+   for (auto *object : objects)
+   {
+      pool.destroy(object);
+   }
+   EXPECT_EQ(0, live);
+   EXPECT_EQ(0, pool.size());
+}
+
+TEST(SlabPoolTest, memoryOfDestroyedObjectsIsReused)
+{
+   int live = 0;
+   SlabPool<Tracked, 4> pool;
+   auto *first = pool.create(live);
+   auto *second = pool.create(live);
+   pool.destroy(first);
+
+   auto *third = pool.create(live);
+   EXPECT_EQ(first, third);
+   EXPECT_EQ(1, pool.slabCount());
+
+   pool.destroy(second);
+   pool.destroy(third);
+}
+
+TEST(SlabPoolTest, failedConstructionReturnsTheMemory)
+{
+   int live = 0;
+   SlabPool<Tracked, 4> pool;
+   EXPECT_THROW(static_cast<void>(pool.create(live, true)), std::runtime_error);
+   EXPECT_EQ(0, pool.size());
+
+   auto *object = pool.create(live);
+   EXPECT_EQ(1, pool.slabCount());
+   pool.destroy(object);
+}
+
+TEST(SlabPoolTest, pointersDestroyThroughTheirPool)
+{
+   int live = 0;
+   SlabPool<Tracked, 4> pool;
+   {
+      auto pooled = SlabPool<Tracked, 4>::make(&pool, live);
+      auto allocated = SlabPool<Tracked, 4>::make(nullptr, live);
+      EXPECT_EQ(2, live);
+      EXPECT_EQ(1, pool.size()) << "only the pooled object should be in the pool";
+   }
+   EXPECT_EQ(0, live);
+   EXPECT_EQ(0, pool.size());
+}
+
+TEST(SlabPoolTest, slabsAreChargedToTheAccount)
+{
+   int live = 0;
+   auto &account = MemoryAccount::named("SlabPoolTest");
+   auto before = account.snapshot().liveBytes;
+   {
+      SlabPool<Tracked, 4> pool(&account);
+      std::vector<Tracked *> objects;
+      for (int i = 0; i < 5; i++)
+      {
+         objects.emplace_back(pool.create(live));
+      }
+      EXPECT_EQ(before + (2 * 4 * sizeof(Tracked)), account.snapshot().liveBytes);
+      for (auto *object : objects)
+      {
+         pool.destroy(object);
+      }
+      EXPECT_EQ(before + (2 * 4 * sizeof(Tracked)), account.snapshot().liveBytes) << "slabs should be kept until the pool is destroyed";
+   }
+   EXPECT_EQ(before, account.snapshot().liveBytes);
+}
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include "contomap/infrastructure/TaskScheduler.h"
+
+using contomap::infrastructure::TaskGroup;
+using contomap::infrastructure::TaskScheduler;
+
+static uint64_t fibonacci(TaskScheduler &scheduler, uint64_t n) // NOLINT
+{
+   if (n < 2)
+   {
+      return n;
+   }
+   uint64_t a = 0;
+   uint64_t b = 0;
+   TaskGroup group(scheduler);
+   group.run([&scheduler, &a, n]() { a = fibonacci(scheduler, n - 1); });
+   b = fibonacci(scheduler, n - 2);
+   group.wait();
+   return a + b;
+}
+
+TEST(TaskSchedulerTest, deterministicModeRunsTasksInOrderOfSpawning)
+{
+   TaskScheduler scheduler(0);
+   EXPECT_EQ(1, scheduler.concurrency());
+   std::vector<int> order;
+   TaskGroup group(scheduler);
+   group.run([&order]() { order.push_back(1); });
+   order.push_back(2);
+   group.run([&order]() { order.push_back(3); });
+   group.wait();
+   EXPECT_THAT(order, testing::ElementsAre(1, 2, 3));
+
+   std::vector<size_t> chunkStarts;
+   scheduler.parallelFor(0, 10, 3, [&chunkStarts](size_t first, size_t) { chunkStarts.push_back(first); });
+   EXPECT_THAT(chunkStarts, testing::ElementsAre(0, 3, 6, 9));
+}
+
+TEST(TaskSchedulerTest, parallelForCoversEachIndexOnce)
+{
+   TaskScheduler scheduler(4);
+   std::vector<std::atomic<int>> visits(10007);
+   scheduler.parallelFor(0, visits.size(), 0, [&visits](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++)
+      {
+         visits[i].fetch_add(1);
+      }
+   });
+   for (auto const &count : visits)
+   {
+      ASSERT_EQ(1, count.load());
+   }
+}
+
+TEST(TaskSchedulerTest, nestedForksAreJoined)
+{
+   TaskScheduler scheduler(3);
+   EXPECT_EQ(6765, fibonacci(scheduler, 20));
+
+   TaskScheduler deterministic(0);
+   EXPECT_EQ(6765, fibonacci(deterministic, 20));
+}
+
+TEST(TaskSchedulerTest, firstExceptionIsRethrownAfterAllTasksAreDone)
+{
+   for (size_t workerCount : { 0, 2 })
+   {
+      TaskScheduler scheduler(workerCount);
+      std::atomic<int> completed { 0 };
+      TaskGroup group(scheduler);
+      group.run([]() { throw std::runtime_error("failed"); });
+      for (int i = 0; i < 8; i++)
+      {
+         group.run([&completed]() { completed.fetch_add(1); });
+      }
+      EXPECT_THROW(group.wait(), std::runtime_error) << "workers: " << workerCount;
+      EXPECT_EQ(8, completed.load()) << "workers: " << workerCount;
+      EXPECT_NO_THROW(group.wait()) << "exception should be reported once";
+   }
+}
@@ -0,0 +1,67 @@
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+
+#include "contomap/infrastructure/Trace.h"
+
+using contomap::infrastructure::Trace;
+
+static std::string traceJson()
+{
+   std::ostringstream out;
+   Trace::writeChromeJson(out);
+   return out.str();
+}
+
+TEST(TraceTest, zonesAndCountersAreWrittenAsChromeTraceEvents)
+{
+   Trace::clear();
+   {
+      Trace::Zone outer("outer");
+      {
+         Trace::Zone inner("inner \"quoted\"");
+         Trace::counter("items", 42.0);
+      }
+   }
+   auto json = traceJson();
+   EXPECT_THAT(json, testing::StartsWith(R"({"displayTimeUnit":"ms","traceEvents":[{"name":"outer","ph":"B","ts":)"));
+   EXPECT_THAT(json, testing::HasSubstr(R"({"name":"inner \"quoted\"","ph":"B")"));
+   EXPECT_THAT(json, testing::HasSubstr(R"("ph":"C")"));
+   EXPECT_THAT(json, testing::HasSubstr(R"("args":{"value":42.000})"));
+   EXPECT_THAT(json, testing::HasSubstr(R"({"name":"outer","ph":"E")"));
+   EXPECT_THAT(json, testing::EndsWith("}]}"));
+}
+
+TEST(TraceTest, threadsRecordSeparately)
+{
+   Trace::clear();
+   std::thread other([]() { Trace::Zone zone("other"); });
+   other.join();
+   {
+      Trace::Zone zone("main");
+   }
+   auto json = traceJson();
+   auto otherPos = json.find(R"("name":"other")");
+   auto mainPos = json.find(R"("name":"main")");
+   ASSERT_NE(std::string::npos, otherPos);
+   ASSERT_NE(std::string::npos, mainPos);
+   auto tidOf = [&json](size_t pos) { return json.substr(json.find("\"tid\":", pos), json.find('}', pos) - json.find("\"tid\":", pos)); };
+   EXPECT_NE(tidOf(otherPos), tidOf(mainPos));
+}
+
+TEST(TraceTest, overwrittenBeginsSkipTheirEnds)
+{
+   Trace::clear();
+   {
+      Trace::Zone outer("lost");
+      for (size_t i = 0; i < Trace::BUFFER_CAPACITY; i++)
+      {
+         Trace::counter("filler", 1.0);
+      }
+   }
+   auto json = traceJson();
+   EXPECT_THAT(json, testing::Not(testing::HasSubstr(R"("name":"lost")")));
+   EXPECT_THAT(json, testing::HasSubstr(R"("name":"filler")"));
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <raylib.h>
+
+#include "contomap/editor/Editor.h"
+#include "contomap/frontend/MapFile.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+#include "contomap/model/Contomap.h"
+#include "contomap/model/MapImporter.h"
+
+using contomap::editor::Editor;
+using contomap::frontend::MapFile;
+using contomap::model::Contomap;
+using contomap::model::MapImporter;
+
+/**
+ * Determines the format of an input file by its extension.
+ *
+ * @param inputPath the path of the input file.
+ * @return the format, JSON Lines for ".jsonl" and ".ndjson", CSV otherwise.
+ */
+static MapImporter::Format formatOf(std::string const &inputPath)
+{
+   auto endsWith = [&inputPath](std::string const &suffix) {
+      return (inputPath.size() >= suffix.size()) && (inputPath.compare(inputPath.size() - suffix.size(), suffix.size(), suffix) == 0);
+   };
+   return (endsWith(".jsonl") || endsWith(".ndjson")) ? MapImporter::Format::JsonLines : MapImporter::Format::Csv;
+}
+
+/**
+ * Writes the map as a map file. The image is only a placeholder, which the application replaces with the rendered map
+ * the next time it saves the file.
+ *
+ * @param map the map to write.
+ * @param outputPath the path of the file to write.
+ * @return true in case the file was written.
+ */
+static bool save(Contomap map, std::string const &outputPath)
+{
+   Editor editor(std::move(map));
+   contomap::infrastructure::serial::BinaryEncoder encoder;
+   editor.saveState(encoder, false);
+
+   auto image = GenImageColor(64, 64, WHITE);
+   int imageSize = 0;
+   auto exported = ExportImageToMemory(image, ".png", &imageSize);
+   UnloadImage(image);
+   if (exported == nullptr)
+   {
+      return false;
+   }
+   bool saved = MapFile::save(outputPath, exported, encoder.getData());
+   MemFree(exported);
+   return saved;
+}
+
+/**
+ * Creates a new map from the rows of an input file.
+ *
+ * @param inputPath the file to read the rows from.
+ * @param outputPath the map file to write.
+ * @return the exit code.
+ */
+static int import(std::string const &inputPath, std::string const &outputPath)
+{
+   std::ifstream in(inputPath, std::ios::binary);
+   if (!in)
+   {
+      std::cerr << "Failed to open " << inputPath << std::endl;
+      return 1;
+   }
+
+   auto start = std::chrono::steady_clock::now();
+   auto map = Contomap::newMap();
+   MapImporter importer(map);
+   try
+   {
+      importer.read(in, formatOf(inputPath));
+      importer.finish();
+   }
+   catch (std::runtime_error const &e)
+   {
+      std::cerr << inputPath << ": " << e.what() << std::endl;
+      return 1;
+   }
+   if (in.bad())
+   {
+      std::cerr << "Failed to read " << inputPath << std::endl;
+      return 1;
+   }
+   auto const &statistics = importer.getStatistics();
+   std::printf("rows: %zu\ntopics: %zu\noccurrences: %zu\nassociations: %zu\nroles: %zu\n", statistics.rows, statistics.topics,
+      statistics.occurrences, statistics.associations, statistics.roles);
+
+   SetTraceLogLevel(LOG_WARNING);
+   if (!save(std::move(map), outputPath))
+   {
+      std::cerr << "Failed to write " << outputPath << std::endl;
+      return 1;
+   }
+   std::printf("duration [ms]: %.1f\n", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+   return 0;
+}
+
+int main(int argc, char **argv)
+{
+   std::vector<std::string> args(argv, argv + argc);
+   if (args.size() == 3)
+   {
+      return import(args[1], args[2]);
+   }
+   std::cerr << "Usage: " << (args.empty() ? "contomap-import" : args[0]) << " <input.csv|input.jsonl> <map.png>" << std::endl;
+   return 1;
+}
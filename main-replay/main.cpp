@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <raylib.h>
+
+#include "contomap/application/Application.h"
+#include "contomap/frontend/InputFrame.h"
+#include "contomap/frontend/InputRecording.h"
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+#include "contomap/model/Identifier.h"
+
+using contomap::application::Application;
+using contomap::frontend::DisplayEnvironment;
+using contomap::frontend::InputFrame;
+using contomap::frontend::InputRecording;
+using contomap::model::Identifier;
+
+/**
+ * ReplayEnvironment represents a display environment without any interaction outside the window.
+ * Dialogs of the environment are always cancelled, and saved files are not reported.
+ */
+class ReplayEnvironment : public DisplayEnvironment
+{
+public:
+   void closeWindow() override
+   {
+      shouldClose = true;
+   }
+
+   DialogResult showLoadDialog(std::string const &, std::string &, std::vector<std::string> const &, std::string const &) override
+   {
+      return DialogResult::Cancelled;
+   }
+
+   DialogResult showSaveAsDialog(std::string const &, std::string &, std::vector<std::string> const &, std::string const &) override
+   {
+      return DialogResult::Cancelled;
+   }
+
+   void fileSaved(std::string const &) override
+   {
+   }
+
+   /**
+    * @return true in case the window should be closed.
+    */
+   [[nodiscard]] bool shouldCloseWindow() const
+   {
+      return shouldClose;
+   }
+
+private:
+   bool shouldClose = false;
+};
+
+/**
+ * Runs the application with the input devices, and stores the consumed input until the window is closed.
+ *
+ * @param mapPath the map to start with.
+ * @param recordingPath the file to store the recording in.
+ * @return the exit code.
+ */
+static int record(std::string const &mapPath, std::string const &recordingPath)
+{
+   // The seed is set before the application exists, as it creates identifiers from the start.
+   auto identifierSeed = std::random_device {}();
+   Identifier::seedRandom(identifierSeed);
+   ReplayEnvironment environment;
+   Application app(environment);
+   InputRecording recording(identifierSeed);
+
+   SetConfigFlags(FLAG_VSYNC_HINT | FLAG_MSAA_4X_HINT);
+   app.initWindow();
+   SetTargetFPS(60);
+   SetExitKey(KEY_NULL);
+   app.load(mapPath);
+
+   while (!environment.shouldCloseWindow())
+   {
+      if (WindowShouldClose())
+      {
+         app.closeRequested();
+      }
+      auto frame = InputFrame::fromCurrentState();
+      recording.add(frame);
+      app.nextFrame(frame);
+   }
+   auto hash = app.stateHash();
+   app.close();
+
+   contomap::infrastructure::serial::BinaryEncoder encoder;
+   recording.encode(encoder);
+   auto const &data = encoder.getData();
+   std::ofstream out(recordingPath, std::ios::binary);
+   out.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+   out.close();
+   if (!out)
+   {
+      std::cerr << "Failed to write " << recordingPath << std::endl;
+      return 1;
+   }
+   std::printf("frames: %zu\nstate hash: %016llx\n", recording.getFrames().size(), static_cast<unsigned long long>(hash));
+   return 0;
+}
+
+/**
+ * Runs the application in a hidden window, with the input of a recording, as fast as possible.
+ * Prints the statistics of the frame times and the hash of the final state.
+ *
+ * @param mapPath the map to start with.
+ * @param recordingPath the file to read the recording from.
+ * @return the exit code.
+ */
+static int replay(std::string const &mapPath, std::string const &recordingPath)
+{
+   std::ifstream in(recordingPath, std::ios::binary);
+   std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+   contomap::infrastructure::serial::BinaryDecoder decoder(data.data(), data.data() + data.size());
+   InputRecording recording;
+   if (!in || !recording.decode(decoder))
+   {
+      std::cerr << "Failed to read recording " << recordingPath << std::endl;
+      return 1;
+   }
+
+   Identifier::seedRandom(recording.getIdentifierSeed());
+   ReplayEnvironment environment;
+   Application app(environment);
+   SetConfigFlags(FLAG_WINDOW_HIDDEN);
+   SetTraceLogLevel(LOG_WARNING);
+   app.initWindow();
+   SetExitKey(KEY_NULL);
+   app.load(mapPath);
+
+   std::vector<double> frameMilliseconds;
+   frameMilliseconds.reserve(recording.getFrames().size());
+   for (auto const &frame : recording.getFrames())
+   {
+      auto start = std::chrono::steady_clock::now();
+      app.nextFrame(frame);
+      frameMilliseconds.emplace_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+   }
+   auto hash = app.stateHash();
+   app.close();
+
+   std::printf("frames: %zu\n", frameMilliseconds.size());
+   if (!frameMilliseconds.empty())
+   {
+      double sum = 0.0;
+      for (double value : frameMilliseconds)
+      {
+         sum += value;
+      }
+      std::sort(frameMilliseconds.begin(), frameMilliseconds.end());
+      auto percentile = [&frameMilliseconds](double fraction) {
+         return frameMilliseconds[static_cast<size_t>(fraction * static_cast<double>(frameMilliseconds.size() - 1))];
+      };
+      std::printf("frame time [ms]: min %.3f, average %.3f, median %.3f, p99 %.3f, max %.3f\n", frameMilliseconds.front(),
+         sum / static_cast<double>(frameMilliseconds.size()), percentile(0.5), percentile(0.99), frameMilliseconds.back());
+   }
+   std::printf("state hash: %016llx\n", static_cast<unsigned long long>(hash));
+   return 0;
+}
+
+int main(int argc, char **argv)
+{
+   std::vector<std::string> args(argv, argv + argc);
+   if ((args.size() == 4) && (args[1] == "record"))
+   {
+      return record(args[2], args[3]);
+   }
+   if ((args.size() == 4) && (args[1] == "replay"))
+   {
+      return replay(args[2], args[3]);
+   }
+   std::cerr << "Usage: " << (args.empty() ? "contomap-replay" : args[0]) << " (record|replay) <map.png> <recording>" << std::endl;
+   return 1;
+}
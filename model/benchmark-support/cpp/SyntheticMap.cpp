@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "contomap/benchmark/SyntheticMap.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::model::Contomap;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
+using contomap::model::TopicNameValue;
+
+static float constexpr TOPIC_SPACING_X = 200.0f;
+static float constexpr TOPIC_SPACING_Y = 120.0f;
+static float constexpr OCCURRENCE_SPACING = 40.0f;
+
+// The raw output of the engine is used, as the standard distributions differ between library implementations.
+static std::string wordOf(std::mt19937 &random, size_t length)
+{
+   std::string word;
+   for (size_t i = 0; i < length; i++)
+   {
+      word.push_back(static_cast<char>(((i == 0) ? 'A' : 'a') + static_cast<char>(random() % 26)));
+   }
+   return word;
+}
+
+static TopicNameValue nameValueOf(std::string const &text)
+{
+   return std::get<TopicNameValue>(TopicNameValue::from(text));
+}
+
+static Contomap newSeededMap(uint32_t seed)
+{
+   Identifier::seedRandom(seed);
+   return Contomap::newMap();
+}
+
+SyntheticMap::SyntheticMap(Parameters const &parameters)
+   : map(newSeededMap(parameters.seed))
+   , deepestScope(Identifiers::ofSingle(map.getDefaultScope()))
+{
+   std::mt19937 random(parameters.seed);
+   std::vector<Identifier> scopeTopicIds;
+   for (size_t i = 0; i < parameters.scopeDepth; i++)
+   {
+      auto &scopeTopic = map.newTopic();
+      static_cast<void>(scopeTopic.newName(Identifiers {}, nameValueOf("Scope " + std::to_string(i))));
+      scopeTopicIds.push_back(scopeTopic.getId());
+      deepestScope.add(scopeTopic.getId());
+   }
+   auto scopeOfDepth = [this, &scopeTopicIds](size_t depth) {
+      auto scope = Identifiers::ofSingle(map.getDefaultScope());
+      for (size_t i = 0; i < depth; i++)
+      {
+         scope.add(scopeTopicIds[i]);
+      }
+      return scope;
+   };
+
+   auto columns = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(parameters.topicCount)))));
+   std::vector<std::reference_wrapper<Topic>> groupTopics;
+   for (size_t i = 0; i < parameters.topicCount; i++)
+   {
+      auto &topic = map.newTopic();
+      auto name = wordOf(random, parameters.nameLength);
+      static_cast<void>(topic.newName(Identifiers {}, nameValueOf(name)));
+      auto depth = i % (parameters.scopeDepth + 1);
+      if (depth > 0)
+      {
+         static_cast<void>(topic.newName(Identifiers::ofSingle(scopeTopicIds[depth - 1]), nameValueOf(wordOf(random, parameters.nameLength))));
+      }
+
+      auto x = (static_cast<float>(i % columns) * TOPIC_SPACING_X) + static_cast<float>(random() % 50);
+      auto y = (static_cast<float>(i / columns) * TOPIC_SPACING_Y) + static_cast<float>(random() % 30);
+      for (size_t j = 0; j < parameters.occurrencesPerTopic; j++)
+      {
+         auto offset = static_cast<float>(j) * OCCURRENCE_SPACING;
+         static_cast<void>(topic.newOccurrence(scopeOfDepth((i + j) % (parameters.scopeDepth + 1)), SpacialCoordinate::absoluteAt(x + offset, y + offset)));
+      }
+      topicIds.push_back(topic.getId());
+      names.emplace_back(std::move(name));
+
+      if (parameters.associationFanOut < 2)
+      {
+         continue;
+      }
+      groupTopics.emplace_back(topic);
+      if ((groupTopics.size() == parameters.associationFanOut) || (i + 1 == parameters.topicCount))
+      {
+         auto &association = map.newAssociation(scopeOfDepth(depth), SpacialCoordinate::absoluteAt(x, y + (TOPIC_SPACING_Y / 2.0f)));
+         for (Topic &member : groupTopics)
+         {
+            static_cast<void>(member.newRole(association));
+         }
+         groupTopics.clear();
+      }
+   }
+}
+
+Contomap &SyntheticMap::getMap()
+{
+   return map;
+}
+
+Contomap const &SyntheticMap::getMap() const
+{
+   return map;
+}
+
+Identifiers const &SyntheticMap::getDeepestScope() const
+{
+   return deepestScope;
+}
+
+std::vector<Identifier> const &SyntheticMap::getTopicIds() const
+{
+   return topicIds;
+}
+
+std::vector<std::string> const &SyntheticMap::getNames() const
+{
+   return names;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "contomap/model/Contomap.h"
+
+namespace contomap::benchmark
+{
+
+/**
+ * SyntheticMap generates a map of configurable shape, for benchmarks.
+ *
+ * The map only depends on the parameters, so that runs are comparable. This includes the identifiers:
+ * the generator of identifiers of the current thread is seeded as well, and remains so for any items created afterwards.
+ */
+class SyntheticMap
+{
+public:
+   /**
+    * Parameters describe the shape of the generated map.
+    */
+   struct Parameters
+   {
+      /** The number of topics, not counting the default scope and the scope topics. */
+      size_t topicCount = 1000;
+      /** The number of occurrences of each topic. */
+      size_t occurrencesPerTopic = 1;
+      /** The number of consecutive topics that share an association. Values below two create no associations. */
+      size_t associationFanOut = 2;
+      /** The number of scope topics. Occurrences are in the default scope plus up to this many of the scope topics. */
+      size_t scopeDepth = 1;
+      /** The number of characters of each name. */
+      size_t nameLength = 12;
+      /** The seed for identifiers, names, and locations. */
+      uint32_t seed = 1;
+   };
+
+   /**
+    * Constructor. Generates the map.
+    *
+    * @param parameters the shape of the map.
+    */
+   explicit SyntheticMap(Parameters const &parameters);
+
+   /**
+    * @return the generated map.
+    */
+   [[nodiscard]] contomap::model::Contomap &getMap();
+   /**
+    * @return the generated map.
+    */
+   [[nodiscard]] contomap::model::Contomap const &getMap() const;
+
+   /**
+    * @return the scope that contains the default scope and all scope topics.
+    */
+   [[nodiscard]] contomap::model::Identifiers const &getDeepestScope() const;
+
+   /**
+    * @return the identifiers of all topics, except the default scope and the scope topics, in order of creation.
+    */
+   [[nodiscard]] std::vector<contomap::model::Identifier> const &getTopicIds() const;
+
+   /**
+    * @return the default names of the topics, in the same order as getTopicIds().
+    */
+   [[nodiscard]] std::vector<std::string> const &getNames() const;
+
+private:
+   contomap::model::Contomap map;
+   contomap::model::Identifiers deepestScope;
+   std::vector<contomap::model::Identifier> topicIds;
+   std::vector<std::string> names;
+};
+
+}
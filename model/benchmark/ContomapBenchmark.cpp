@@ -0,0 +1,155 @@
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/benchmark/SyntheticMap.h"
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+#include "contomap/model/Contomap.h"
+#include "contomap/model/Topics.h"
+
+using contomap::benchmark::SyntheticMap;
+using contomap::infrastructure::serial::BinaryDecoder;
+using contomap::infrastructure::serial::BinaryEncoder;
+using contomap::model::Association;
+using contomap::model::Contomap;
+using contomap::model::Identifiers;
+using contomap::model::Occurrence;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
+using contomap::model::TopicNameValue;
+using contomap::model::Topics;
+
+static std::vector<uint8_t> encodedMapOf(size_t topicCount)
+{
+   auto map = Contomap::newMap();
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   std::vector<std::reference_wrapper<Topic>> topics;
+   for (size_t i = 0; i < topicCount; i++)
+   {
+      auto &topic = map.newTopic();
+      auto position = static_cast<float>(i);
+      static_cast<void>(topic.newOccurrence(scope, SpacialCoordinate::absoluteAt(position, position)));
+      static_cast<void>(topic.newName(scope, std::get<TopicNameValue>(TopicNameValue::from("Topic " + std::to_string(i)))));
+      topics.emplace_back(topic);
+   }
+   for (size_t i = 1; i < topicCount; i += 2)
+   {
+      auto &association = map.newAssociation(scope, SpacialCoordinate::absoluteAt(0.0f, 0.0f));
+      static_cast<void>(topics[i - 1].get().newRole(association));
+      static_cast<void>(topics[i].get().newRole(association));
+   }
+
+   BinaryEncoder encoder;
+   map.encode(encoder);
+   return encoder.getData();
+}
+
+static void loadAndDestroy(benchmark::State &state)
+{
+   auto data = encodedMapOf(static_cast<size_t>(state.range(0)));
+   for (auto _ : state)
+   {
+      BinaryDecoder decoder(data.data(), data.data() + data.size());
+      auto map = Contomap::newMap();
+      map.decode(decoder, 0x00);
+      benchmark::DoNotOptimize(map);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(loadAndDestroy)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void loadAndReplace(benchmark::State &state)
+{
+   auto data = encodedMapOf(static_cast<size_t>(state.range(0)));
+   auto current = Contomap::newMap();
+   for (auto _ : state)
+   {
+      BinaryDecoder decoder(data.data(), data.data() + data.size());
+      auto loaded = Contomap::newMap();
+      loaded.decode(decoder, 0x00);
+      // As with undo and redo, the loaded map replaces the current one, which is torn down in doing so.
+      current = std::move(loaded);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(loadAndReplace)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void createSyntheticMap(benchmark::State &state)
+{
+   SyntheticMap::Parameters parameters { .topicCount = static_cast<size_t>(state.range(0)), .occurrencesPerTopic = static_cast<size_t>(state.range(1)) };
+   for (auto _ : state)
+   {
+      SyntheticMap map(parameters);
+      benchmark::DoNotOptimize(map);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(createSyntheticMap)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 4 })->Unit(benchmark::kMillisecond);
+
+static void findTopicsByScope(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = static_cast<size_t>(state.range(0)), .scopeDepth = static_cast<size_t>(state.range(1)) });
+   auto const &map = synthetic.getMap();
+   auto scope = synthetic.getDeepestScope();
+   for (auto _ : state)
+   {
+      size_t count = 0;
+      for ([[maybe_unused]] Topic const &topic : map.find(Topics::thatAreIn(scope)))
+      {
+         count++;
+      }
+      benchmark::DoNotOptimize(count);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(findTopicsByScope)->Args({ 10000, 1 })->Args({ 10000, 4 })->Unit(benchmark::kMicrosecond);
+
+static void findTopicsByName(benchmark::State &state)
+{
+   SyntheticMap synthetic(SyntheticMap::Parameters { .topicCount = static_cast<size_t>(state.range(0)), .nameLength = static_cast<size_t>(state.range(1)) });
+   auto const &map = synthetic.getMap();
+   auto const &names = synthetic.getNames();
+   size_t index = 0;
+   for (auto _ : state)
+   {
+      auto const &name = names[index];
+      index = (index + 7919) % names.size();
+      size_t count = 0;
+      for ([[maybe_unused]] Topic const &topic : map.find(Topics::withANameLike(name.substr(0, name.size() / 2))))
+      {
+         count++;
+      }
+      benchmark::DoNotOptimize(count);
+   }
+}
+BENCHMARK(findTopicsByName)->Args({ 10000, 8 })->Args({ 10000, 32 })->Unit(benchmark::kMicrosecond);
+
+static void deleteOccurrencesCascading(benchmark::State &state)
+{
+   SyntheticMap::Parameters parameters { .topicCount = static_cast<size_t>(state.range(0)), .associationFanOut = static_cast<size_t>(state.range(1)) };
+   // The maps are replaced while the timing is paused, so that neither their creation nor their destruction is measured.
+   std::optional<SyntheticMap> synthetic;
+   for (auto _ : state)
+   {
+      state.PauseTiming();
+      synthetic.emplace(parameters);
+      auto &map = synthetic->getMap();
+      Identifiers occurrenceIds;
+      for (auto topicId : synthetic->getTopicIds())
+      {
+         for (Occurrence const &occurrence : map.findTopic(topicId).value().get().occurrencesIn(synthetic->getDeepestScope()))
+         {
+            occurrenceIds.add(occurrence.getId());
+         }
+      }
+      state.ResumeTiming();
+
+      map.deleteOccurrences(occurrenceIds);
+      benchmark::DoNotOptimize(map);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(deleteOccurrencesCascading)->Args({ 1000, 2 })->Args({ 1000, 8 })->Unit(benchmark::kMillisecond);
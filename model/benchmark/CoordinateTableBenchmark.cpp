@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/model/Contomap.h"
+#include "contomap/model/Topics.h"
+
+using contomap::model::Contomap;
+using contomap::model::Coordinates;
+using contomap::model::CoordinateTable;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Occurrence;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
+using contomap::model::Topics;
+
+static Contomap mapWithOccurrences(size_t count, Identifiers &ids)
+{
+   auto map = Contomap::newMap();
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   for (size_t i = 0; i < count; i++)
+   {
+      auto &topic = map.newTopic();
+      auto x = static_cast<float>(i % 1000) * 20.0f;
+      auto y = static_cast<float>(i / 1000) * 20.0f;
+      ids.add(topic.newOccurrence(scope, SpacialCoordinate::absoluteAt(x, y)).getId());
+   }
+   return map;
+}
+
+static CoordinateTable::Bounds const VIEWPORT { .minX = 4000.0f, .minY = 0.0f, .maxX = 6000.0f, .maxY = 1000.0f };
+
+static void boundsByTraversal(benchmark::State &state)
+{
+   Identifiers ids;
+   auto map = mapWithOccurrences(static_cast<size_t>(state.range(0)), ids);
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   for (auto _ : state)
+   {
+      CoordinateTable::Bounds bounds { .minX = 0.0f, .minY = 0.0f, .maxX = 0.0f, .maxY = 0.0f };
+      for (Topic const &topic : map.find(Topics::thatAreIn(scope)))
+      {
+         for (Occurrence const &occurrence : topic.occurrencesIn(scope))
+         {
+            auto point = occurrence.getLocation().getSpacial().getAbsoluteReference();
+            bounds.minX = std::min(bounds.minX, point.X());
+            bounds.minY = std::min(bounds.minY, point.Y());
+            bounds.maxX = std::max(bounds.maxX, point.X());
+            bounds.maxY = std::max(bounds.maxY, point.Y());
+         }
+      }
+      benchmark::DoNotOptimize(bounds);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(boundsByTraversal)->Arg(1000)->Arg(100000);
+
+static void boundsByTable(benchmark::State &state)
+{
+   Identifiers ids;
+   auto map = mapWithOccurrences(static_cast<size_t>(state.range(0)), ids);
+   for (auto _ : state)
+   {
+      benchmark::DoNotOptimize(map.getOccurrenceLocations().bounds());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(boundsByTable)->Arg(1000)->Arg(100000);
+
+static void cullingByTraversal(benchmark::State &state)
+{
+   Identifiers ids;
+   auto map = mapWithOccurrences(static_cast<size_t>(state.range(0)), ids);
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   std::vector<Occurrence const *> visible;
+   for (auto _ : state)
+   {
+      visible.clear();
+      for (Topic const &topic : map.find(Topics::thatAreIn(scope)))
+      {
+         for (Occurrence const &occurrence : topic.occurrencesIn(scope))
+         {
+            auto point = occurrence.getLocation().getSpacial().getAbsoluteReference();
+            if ((point.X() >= VIEWPORT.minX) && (point.X() <= VIEWPORT.maxX) && (point.Y() >= VIEWPORT.minY) && (point.Y() <= VIEWPORT.maxY))
+            {
+               visible.push_back(&occurrence);
+            }
+         }
+      }
+      benchmark::DoNotOptimize(visible.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(cullingByTraversal)->Arg(1000)->Arg(100000);
+
+static void cullingByTable(benchmark::State &state)
+{
+   Identifiers ids;
+   auto map = mapWithOccurrences(static_cast<size_t>(state.range(0)), ids);
+   std::vector<size_t> rows;
+   for (auto _ : state)
+   {
+      rows.clear();
+      map.getOccurrenceLocations().collectWithin(VIEWPORT, rows);
+      benchmark::DoNotOptimize(rows.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(cullingByTable)->Arg(1000)->Arg(100000);
+
+static void translateByTraversal(benchmark::State &state)
+{
+   Identifiers ids;
+   auto map = mapWithOccurrences(static_cast<size_t>(state.range(0)), ids);
+   auto offset = SpacialCoordinate::Offset::of(1.0f, -1.0f);
+   for (auto _ : state)
+   {
+      for (Occurrence &occurrence : map.findOccurrences(ids))
+      {
+         occurrence.moveBy(offset);
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(translateByTraversal)->Arg(1000)->Arg(100000);
+
+static void translateByTable(benchmark::State &state)
+{
+   // The map provides its tables read-only, so the kernel runs on a table of its own, filled the same way.
+   CoordinateTable table;
+   std::vector<std::unique_ptr<Coordinates>> locations;
+   for (int64_t i = 0; i < state.range(0); i++)
+   {
+      auto &location = locations.emplace_back(std::make_unique<Coordinates>(SpacialCoordinate::absoluteAt(static_cast<float>(i), 0.0f)));
+      location->placeIn(&table, Identifier::random(), {});
+   }
+   auto offset = SpacialCoordinate::Offset::of(1.0f, -1.0f);
+   for (auto _ : state)
+   {
+      table.translateAll(offset);
+      benchmark::ClobberMemory();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(translateByTable)->Arg(1000)->Arg(100000);
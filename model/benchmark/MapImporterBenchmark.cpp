@@ -0,0 +1,94 @@
+#include <istream>
+#include <streambuf>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/model/Contomap.h"
+#include "contomap/model/MapImporter.h"
+
+using contomap::model::Contomap;
+using contomap::model::MapImporter;
+
+// Produces the rows of an inventory-like input on demand, so that the input itself takes no memory.
+// Every group of three topics is linked by one association.
+class SyntheticRows : public std::streambuf
+{
+public:
+   explicit SyntheticRows(size_t rowCount)
+      : remainingRows(rowCount)
+   {
+      row = "kind,key,name,x,y,topic,association\n";
+      setg(row.data(), row.data(), row.data() + row.size());
+   }
+
+protected:
+   int_type underflow() override
+   {
+      if (remainingRows == 0)
+      {
+         return traits_type::eof();
+      }
+      remainingRows--;
+      nextRow();
+      setg(row.data(), row.data(), row.data() + row.size());
+      return traits_type::to_int_type(row.front());
+   }
+
+private:
+   void nextRow()
+   {
+      auto position = std::to_string((rowIndex % 1000) * 100) + "," + std::to_string((rowIndex / 1000) * 60);
+      switch (rowIndex % 8)
+      {
+      case 0:
+      case 1:
+      case 2:
+         topicIndex++;
+         row = "topic,t" + std::to_string(topicIndex) + ",Item " + std::to_string(topicIndex) + "," + position + ",,\n";
+         break;
+      case 3:
+         associationIndex++;
+         row = "association,a" + std::to_string(associationIndex) + ",," + position + ",,\n";
+         break;
+      case 4:
+      case 5:
+      case 6:
+         row = "role,,,,,t" + std::to_string(topicIndex - (6 - (rowIndex % 8))) + ",a" + std::to_string(associationIndex) + "\n";
+         break;
+      default:
+         row = "occurrence,,," + position + ",t" + std::to_string(topicIndex) + ",\n";
+         break;
+      }
+      rowIndex++;
+   }
+
+   size_t remainingRows;
+   size_t rowIndex = 0;
+   size_t topicIndex = 0;
+   size_t associationIndex = 0;
+   std::string row;
+};
+
+static void importRows(benchmark::State &state)
+{
+   auto rowCount = static_cast<size_t>(state.range(0));
+   for (auto _ : state)
+   {
+      auto map = Contomap::newMap();
+      MapImporter importer(map);
+      SyntheticRows rows(rowCount);
+      std::istream input(&rows);
+      importer.read(input, MapImporter::Format::Csv);
+      importer.finish();
+      benchmark::DoNotOptimize(map);
+      state.PauseTiming();
+      {
+         // Destroying the map is not part of the import.
+         auto discarded = std::move(map);
+      }
+      state.ResumeTiming();
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(importRows)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
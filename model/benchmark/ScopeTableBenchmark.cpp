@@ -0,0 +1,109 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "contomap/model/Contomap.h"
+#include "contomap/model/Topics.h"
+
+using contomap::model::Contomap;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Occurrence;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
+using contomap::model::Topics;
+
+static size_t constexpr SCOPE_TOPIC_COUNT = 20;
+
+// Occurrences are spread over a few hundred distinct scopes, each combining the default scope with up to two scope topics.
+static Contomap mapWithScopedOccurrences(size_t count, Identifiers &viewScope)
+{
+   auto map = Contomap::newMap();
+   std::vector<Identifier> scopeTopicIds;
+   for (size_t i = 0; i < SCOPE_TOPIC_COUNT; i++)
+   {
+      scopeTopicIds.push_back(map.newTopic().getId());
+   }
+   viewScope = Identifiers::ofSingle(map.getDefaultScope());
+   viewScope.add(scopeTopicIds[0]);
+   viewScope.add(scopeTopicIds[1]);
+   for (size_t i = 0; i < count; i++)
+   {
+      auto scope = Identifiers::ofSingle(map.getDefaultScope());
+      scope.add(scopeTopicIds[i % SCOPE_TOPIC_COUNT]);
+      scope.add(scopeTopicIds[(i / SCOPE_TOPIC_COUNT) % SCOPE_TOPIC_COUNT]);
+      static_cast<void>(map.newTopic().newOccurrence(scope, SpacialCoordinate::absoluteAt(0.0f, 0.0f)));
+   }
+   return map;
+}
+
+static std::vector<Occurrence const *> allOccurrencesOf(Contomap const &map)
+{
+   Identifiers ids;
+   auto const &locations = map.getOccurrenceLocations();
+   for (size_t row = 0; row < locations.size(); row++)
+   {
+      ids.add(locations.idAt(row));
+   }
+   std::vector<Occurrence const *> occurrences;
+   for (Occurrence const &occurrence : map.findOccurrences(ids))
+   {
+      occurrences.push_back(&occurrence);
+   }
+   return occurrences;
+}
+
+static void scopeTestByIdentifierSets(benchmark::State &state)
+{
+   Identifiers viewScope;
+   auto map = mapWithScopedOccurrences(static_cast<size_t>(state.range(0)), viewScope);
+   auto occurrences = allOccurrencesOf(map);
+   for (auto _ : state)
+   {
+      size_t visibleCount = 0;
+      for (auto const *occurrence : occurrences)
+      {
+         visibleCount += occurrence->isIn(viewScope) ? 1 : 0;
+      }
+      benchmark::DoNotOptimize(visibleCount);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scopeTestByIdentifierSets)->Arg(1000)->Arg(100000);
+
+static void scopeTestBySelection(benchmark::State &state)
+{
+   Identifiers viewScope;
+   auto map = mapWithScopedOccurrences(static_cast<size_t>(state.range(0)), viewScope);
+   auto occurrences = allOccurrencesOf(map);
+   for (auto _ : state)
+   {
+      auto selection = map.getScopes().selectWithin(viewScope);
+      size_t visibleCount = 0;
+      for (auto const *occurrence : occurrences)
+      {
+         visibleCount += occurrence->isIn(*selection) ? 1 : 0;
+      }
+      benchmark::DoNotOptimize(visibleCount);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scopeTestBySelection)->Arg(1000)->Arg(100000);
+
+static void topicsInScope(benchmark::State &state)
+{
+   Identifiers viewScope;
+   auto map = mapWithScopedOccurrences(static_cast<size_t>(state.range(0)), viewScope);
+   for (auto _ : state)
+   {
+      size_t visibleCount = 0;
+      for (Topic const &topic : map.find(Topics::thatAreIn(viewScope)))
+      {
+         static_cast<void>(topic);
+         visibleCount++;
+      }
+      benchmark::DoNotOptimize(visibleCount);
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(topicsInScope)->Arg(1000)->Arg(100000);
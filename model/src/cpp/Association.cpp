@@ -3,44 +3,52 @@
 #include "contomap/model/Topic.h"
 
 using contomap::infrastructure::Link;
-using contomap::infrastructure::Links;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Encoder;
 using contomap::model::Association;
+using contomap::model::CoordinateTable;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
+using contomap::model::InternedScope;
 using contomap::model::OptionalIdentifier;
 using contomap::model::Role;
+using contomap::model::ScopeTable;
 using contomap::model::SpacialCoordinate;
 using contomap::model::Style;
 using contomap::model::Topic;
 
-Association::Association(Identifier id)
+Association::Association(Identifier id, CoordinateTable *coordinateTable)
    : id(id)
 {
+   location.placeIn(coordinateTable, id, scope);
 }
 
-Association::Association(Identifier id, Identifiers scope, SpacialCoordinate spacial)
+Association::Association(Identifier id, InternedScope scope, SpacialCoordinate spacial, CoordinateTable *coordinateTable)
    : id(id)
    , scope(std::move(scope))
    , location(spacial)
 {
+   location.placeIn(coordinateTable, id, this->scope);
 }
 
 void Association::encodeProperties(Encoder &coder) const
 {
    Coder::Scope propertiesScope(coder, "properties");
-   scope.encode(coder, "scope");
+   scope.identifiers().encode(coder, "scope");
    location.encode(coder, "location");
    type.encode(coder, "type");
    appearance.encode(coder, "appearance");
    encodeReifiable(coder);
 }
 
-void Association::decodeProperties(contomap::infrastructure::serial::Decoder &coder, uint8_t version, std::function<Topic &(Identifier)> const &topicResolver)
+void Association::decodeProperties(
+   contomap::infrastructure::serial::Decoder &coder, uint8_t version, std::function<Topic &(Identifier)> const &topicResolver, ScopeTable *scopeTable)
 {
    Coder::Scope propertiesScope(coder, "properties");
-   scope.decode(coder, "scope");
+   Identifiers decodedScope;
+   decodedScope.decode(coder, "scope");
+   scope = ScopeTable::intern(scopeTable, std::move(decodedScope));
+   location.setScope(scope);
    location.decode(coder, "location", version);
    type = OptionalIdentifier::from(coder, "type");
    appearance.decode(coder, "appearance", version);
@@ -69,7 +77,12 @@ void Association::moveBy(SpacialCoordinate::Offset offset)
 
 bool Association::isIn(Identifiers const &thatScope) const
 {
-   return thatScope.contains(scope);
+   return scope.isIn(thatScope);
+}
+
+bool Association::isIn(ScopeTable::Selection const &selection) const
+{
+   return selection.contains(scope);
 }
 
 bool Association::isWithoutScope() const
@@ -77,12 +90,11 @@ bool Association::isWithoutScope() const
    return scope.empty();
 }
 
-std::unique_ptr<Link<Association>> Association::link(Role &role, std::function<void()> associationUnlinked)
+void Association::link(Role &role, Link<Association> &associationLink)
 {
    Identifier roleId = role.getId();
-   auto links = Links::between(*this, std::move(associationUnlinked), role, [this, roleId]() { roles.erase(roleId); });
-   roles.emplace(roleId, std::make_unique<RoleEntry>(std::move(links.second)));
-   return std::move(links.first);
+   auto it = roles.try_emplace(roleId, *this, roleId).first;
+   it->second.linkWith(role, associationLink);
 }
 
 bool Association::hasRoles() const
@@ -94,7 +106,8 @@ void Association::removeTopicReferences(Identifier topicId)
 {
    if (scope.contains(topicId))
    {
-      scope.clear();
+      scope = {};
+      location.setScope(scope);
    }
    if (type.isAssigned() && (type.value() == topicId))
    {
@@ -2,10 +2,10 @@
 
 using contomap::model::Association;
 using contomap::model::Associations;
-using contomap::model::Filter;
 using contomap::model::Identifiers;
+using contomap::model::filters::InScope;
 
-std::unique_ptr<Filter<Association>> Associations::thatAreIn(Identifiers const &scope)
+InScope<Association> Associations::thatAreIn(Identifiers const &scope)
 {
-   return Filter<Association>::of([scope](Association const &association, [[maybe_unused]] ContomapView const &view) { return association.isIn(scope); });
+   return InScope<Association>(scope);
 }
@@ -1,21 +1,59 @@
 #include <exception>
 
+#include "contomap/infrastructure/Trace.h"
 #include "contomap/model/Contomap.h"
 #include "contomap/model/Filter.h"
 
 using contomap::infrastructure::Search;
+using contomap::infrastructure::SlabPool;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
 using contomap::model::Association;
 using contomap::model::Contomap;
+using contomap::model::CoordinateTable;
+using contomap::model::EntityPools;
 using contomap::model::Identifier;
+using contomap::model::ScopeTable;
 using contomap::model::Topic;
+using contomap::model::TopicNameIndex;
+
+Contomap::NameIndexDeferral::NameIndexDeferral(Contomap &map)
+   : index(*map.nameIndex)
+{
+   index.deferPostings();
+}
+
+Contomap::NameIndexDeferral::~NameIndexDeferral()
+{
+   index.flushPostings();
+}
 
 Contomap::Contomap()
-   : defaultScope(Identifier::random())
+   : nameIndex(std::make_unique<TopicNameIndex>())
+   , pools(std::make_unique<EntityPools>())
+   , defaultScope(Identifier::random())
+{
+   topics.emplace(defaultScope, newTopicEntity(defaultScope));
+}
+
+Contomap::~Contomap()
+{
+   destroyEntities();
+}
+
+Contomap &Contomap::operator=(Contomap &&other) noexcept
 {
-   topics.emplace(defaultScope, std::make_unique<Topic>(defaultScope));
+   if (this != &other)
+   {
+      destroyEntities();
+      nameIndex = std::move(other.nameIndex);
+      pools = std::move(other.pools);
+      topics = std::move(other.topics);
+      associations = std::move(other.associations);
+      defaultScope = other.defaultScope;
+   }
+   return *this;
 }
 
 Contomap Contomap::newMap()
@@ -31,14 +69,16 @@ Identifier Contomap::getDefaultScope() const
 Topic &Contomap::newTopic()
 {
    auto id = Identifier::random();
-   auto it = topics.emplace(id, std::make_unique<Topic>(id));
+   auto it = topics.emplace(id, newTopicEntity(id));
    return *it.first->second;
 }
 
 Association &Contomap::newAssociation(Identifiers scope, SpacialCoordinate location)
 {
    auto id = Identifier::random();
-   auto it = associations.emplace(id, std::make_unique<Association>(id, std::move(scope), location));
+   auto association
+      = SlabPool<Association>::make(&pools->associations, id, pools->scopes.intern(std::move(scope)), location, &pools->associationLocations);
+   auto it = associations.emplace(id, std::move(association));
    return *it.first->second;
 }
 
@@ -86,6 +126,26 @@ std::optional<std::reference_wrapper<Topic const>> Contomap::findTopic(Identifie
    return (it != topics.end()) ? std::optional<std::reference_wrapper<Topic const>>(*it->second) : std::optional<std::reference_wrapper<Topic const>>();
 }
 
+TopicNameIndex const &Contomap::getTopicNameIndex() const
+{
+   return *nameIndex;
+}
+
+CoordinateTable const &Contomap::getOccurrenceLocations() const
+{
+   return pools->occurrenceLocations;
+}
+
+CoordinateTable const &Contomap::getAssociationLocations() const
+{
+   return pools->associationLocations;
+}
+
+ScopeTable const &Contomap::getScopes() const
+{
+   return pools->scopes;
+}
+
 std::optional<std::reference_wrapper<Topic>> Contomap::findTopic(Identifier id)
 {
    auto it = topics.find(id);
@@ -200,6 +260,7 @@ bool Contomap::topicShouldBeRemoved(Topic const &topic)
 
 void Contomap::deleteTopicsCascading(Identifiers toDelete)
 {
+   CONTOMAP_TRACE_ZONE("Contomap::deleteTopicsCascading");
    while (!toDelete.empty())
    {
       Identifiers localToDelete = toDelete;
@@ -210,6 +271,7 @@ void Contomap::deleteTopicsCascading(Identifiers toDelete)
          if (it != topics.end())
          {
             deleting(toDelete, *it->second);
+            nameIndex->removeTopic(topicId);
             topics.erase(it);
          }
       }
@@ -244,6 +306,7 @@ void Contomap::deleting(Identifiers &toDelete, Topic &topic)
 
 void Contomap::encode(Encoder &coder) const
 {
+   CONTOMAP_TRACE_ZONE("Contomap::encode");
    Coder::Scope mapScope(coder, "contomap");
    coder.codeArray("topics", topics.begin(), topics.end(), [](Encoder &nested, auto const &kvp) {
       Coder::Scope nestedScope(nested, "");
@@ -265,15 +328,19 @@ void Contomap::encode(Encoder &coder) const
 
 void Contomap::decode(Decoder &coder, uint8_t version)
 {
-   associations.clear();
-   topics.clear();
+   CONTOMAP_TRACE_ZONE("Contomap::decode");
+   destroyEntities();
+   nameIndex->clear();
 
    Coder::Scope mapScope(coder, "contomap");
-   coder.codeArray("topics", [this](Decoder &nested, size_t) {
-      Coder::Scope nestedScope(nested, "");
-      auto id = Identifier::from(nested, "id");
-      topics.emplace(id, std::make_unique<Topic>(id));
-   });
+   {
+      CONTOMAP_TRACE_ZONE("Contomap::decode topics");
+      coder.codeArray("topics", [this](Decoder &nested, size_t) {
+         Coder::Scope nestedScope(nested, "");
+         auto id = Identifier::from(nested, "id");
+         topics.emplace(id, newTopicEntity(id));
+      });
+   }
    auto topicResolver = [this](Identifier id) -> Topic & {
       auto it = topics.find(id);
       if (it == topics.end())
@@ -282,13 +349,16 @@ void Contomap::decode(Decoder &coder, uint8_t version)
       }
       return *it->second;
    };
-   coder.codeArray("associations", [this, version, &topicResolver](Decoder &nested, size_t) {
-      Coder::Scope nestedScope(nested, "");
-      auto id = Identifier::from(nested, "id");
-      auto association = std::make_unique<Association>(id);
-      association->decodeProperties(nested, version, topicResolver);
-      associations.emplace(id, std::move(association));
-   });
+   {
+      CONTOMAP_TRACE_ZONE("Contomap::decode associations");
+      coder.codeArray("associations", [this, version, &topicResolver](Decoder &nested, size_t) {
+         Coder::Scope nestedScope(nested, "");
+         auto id = Identifier::from(nested, "id");
+         auto association = SlabPool<Association>::make(&pools->associations, id, &pools->associationLocations);
+         association->decodeProperties(nested, version, topicResolver, &pools->scopes);
+         associations.emplace(id, std::move(association));
+      });
+   }
    auto associationResolver = [this](Identifier id) -> Association & {
       auto it = associations.find(id);
       if (it == associations.end())
@@ -297,12 +367,27 @@ void Contomap::decode(Decoder &coder, uint8_t version)
       }
       return *it->second;
    };
-   coder.codeArray("topicRelated", [version, &topicResolver, &associationResolver](Decoder &nested, size_t) {
-      Coder::Scope nestedScope(nested, "");
-      Identifier topicId = Identifier::from(nested, "id");
-      auto &topic = topicResolver(topicId);
-      topic.decodeRelated(nested, version, topicResolver, associationResolver);
-   });
+   {
+      CONTOMAP_TRACE_ZONE("Contomap::decode topicRelated");
+      coder.codeArray("topicRelated", [version, &topicResolver, &associationResolver](Decoder &nested, size_t) {
+         Coder::Scope nestedScope(nested, "");
+         Identifier topicId = Identifier::from(nested, "id");
+         auto &topic = topicResolver(topicId);
+         topic.decodeRelated(nested, version, topicResolver, associationResolver);
+      });
+   }
 
    defaultScope = Identifier::from(coder, "defaultScope");
 }
+
+SlabPool<Topic>::Pointer Contomap::newTopicEntity(Identifier id)
+{
+   return SlabPool<Topic>::make(&pools->topics, id, *nameIndex, *pools);
+}
+
+void Contomap::destroyEntities()
+{
+   // Associations go first, as destroying them also removes their roles from the topics.
+   associations.clear();
+   topics.clear();
+}
@@ -0,0 +1,18 @@
+#include <algorithm>
+
+#include "contomap/model/ContomapView.h"
+
+using contomap::model::ContomapView;
+using contomap::model::Identifier;
+
+std::optional<std::vector<Identifier>> ContomapView::topicsNamedLike(std::optional<std::string_view> nameSearch) const
+{
+   if (!nameSearch.has_value())
+   {
+      return {};
+   }
+   auto ids = getTopicNameIndex().find(std::string(*nameSearch)).getTopics();
+   // The index ranks by relevance. Sorting restores the order in which a full scan would yield the topics.
+   std::sort(ids.begin(), ids.end());
+   return ids;
+}
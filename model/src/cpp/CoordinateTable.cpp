@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define CONTOMAP_COORDINATE_TABLE_SSE
+#endif
+
+#include "contomap/model/CoordinateTable.h"
+#include "contomap/model/Coordinates.h"
+
+using contomap::model::Coordinates;
+using contomap::model::CoordinateTable;
+using contomap::model::Identifier;
+using contomap::model::InternedScope;
+using contomap::model::ScopeTable;
+using contomap::model::SpacialCoordinate;
+
+#ifdef CONTOMAP_COORDINATE_TABLE_SSE
+static size_t constexpr LANES = 4;
+
+static float lowestOf(__m128 values)
+{
+   values = _mm_min_ps(values, _mm_movehl_ps(values, values));
+   values = _mm_min_ss(values, _mm_shuffle_ps(values, values, _MM_SHUFFLE(1, 1, 1, 1)));
+   return _mm_cvtss_f32(values);
+}
+
+static float highestOf(__m128 values)
+{
+   values = _mm_max_ps(values, _mm_movehl_ps(values, values));
+   values = _mm_max_ss(values, _mm_shuffle_ps(values, values, _MM_SHUFFLE(1, 1, 1, 1)));
+   return _mm_cvtss_f32(values);
+}
+#endif
+
+size_t CoordinateTable::size() const noexcept
+{
+   return xs.size();
+}
+
+SpacialCoordinate::AbsolutePoint CoordinateTable::pointAt(size_t row) const
+{
+   return SpacialCoordinate::AbsolutePoint::at(xs[row], ys[row]);
+}
+
+Identifier CoordinateTable::idAt(size_t row) const
+{
+   return ids[row];
+}
+
+InternedScope const &CoordinateTable::scopeAt(size_t row) const
+{
+   return scopes[row];
+}
+
+std::optional<CoordinateTable::Bounds> CoordinateTable::bounds() const
+{
+   size_t count = xs.size();
+   if (count == 0)
+   {
+      return {};
+   }
+   Bounds result { .minX = xs[0], .minY = ys[0], .maxX = xs[0], .maxY = ys[0] };
+   size_t row = 0;
+#ifdef CONTOMAP_COORDINATE_TABLE_SSE
+   if (count >= LANES)
+   {
+      __m128 minX = _mm_loadu_ps(xs.data());
+      __m128 minY = _mm_loadu_ps(ys.data());
+      __m128 maxX = minX;
+      __m128 maxY = minY;
+      for (row = LANES; (row + LANES) <= count; row += LANES)
+      {
+         __m128 x = _mm_loadu_ps(xs.data() + row);
+         __m128 y = _mm_loadu_ps(ys.data() + row);
+         minX = _mm_min_ps(minX, x);
+         minY = _mm_min_ps(minY, y);
+         maxX = _mm_max_ps(maxX, x);
+         maxY = _mm_max_ps(maxY, y);
+      }
+      result = Bounds { .minX = lowestOf(minX), .minY = lowestOf(minY), .maxX = highestOf(maxX), .maxY = highestOf(maxY) };
+   }
+#endif
+   for (; row < count; row++)
+   {
+      result.minX = std::min(result.minX, xs[row]);
+      result.minY = std::min(result.minY, ys[row]);
+      result.maxX = std::max(result.maxX, xs[row]);
+      result.maxY = std::max(result.maxY, ys[row]);
+   }
+   return result;
+}
+
+void CoordinateTable::collectWithin(Bounds const &area, std::vector<size_t> &rows) const
+{
+   size_t count = xs.size();
+   size_t row = 0;
+#ifdef CONTOMAP_COORDINATE_TABLE_SSE
+   __m128 minX = _mm_set1_ps(area.minX);
+   __m128 minY = _mm_set1_ps(area.minY);
+   __m128 maxX = _mm_set1_ps(area.maxX);
+   __m128 maxY = _mm_set1_ps(area.maxY);
+   for (; (row + LANES) <= count; row += LANES)
+   {
+      __m128 x = _mm_loadu_ps(xs.data() + row);
+      __m128 y = _mm_loadu_ps(ys.data() + row);
+      __m128 insideX = _mm_and_ps(_mm_cmpge_ps(x, minX), _mm_cmple_ps(x, maxX));
+      __m128 insideY = _mm_and_ps(_mm_cmpge_ps(y, minY), _mm_cmple_ps(y, maxY));
+      auto mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_and_ps(insideX, insideY)));
+      while (mask != 0)
+      {
+         rows.push_back(row + static_cast<size_t>(std::countr_zero(mask)));
+         mask &= mask - 1;
+      }
+   }
+#endif
+   for (; row < count; row++)
+   {
+      if ((xs[row] >= area.minX) && (xs[row] <= area.maxX) && (ys[row] >= area.minY) && (ys[row] <= area.maxY))
+      {
+         rows.push_back(row);
+      }
+   }
+}
+
+void CoordinateTable::collectIn(ScopeTable::Selection const &selection, std::vector<size_t> &rows) const
+{
+   for (size_t row = 0; row < scopes.size(); row++)
+   {
+      if (selection.contains(scopes[row]))
+      {
+         rows.push_back(row);
+      }
+   }
+}
+
+void CoordinateTable::translateAll(SpacialCoordinate::Offset offset)
+{
+   size_t count = xs.size();
+   size_t row = 0;
+#ifdef CONTOMAP_COORDINATE_TABLE_SSE
+   __m128 deltaX = _mm_set1_ps(offset.X());
+   __m128 deltaY = _mm_set1_ps(offset.Y());
+   for (; (row + LANES) <= count; row += LANES)
+   {
+      _mm_storeu_ps(xs.data() + row, _mm_add_ps(_mm_loadu_ps(xs.data() + row), deltaX));
+      _mm_storeu_ps(ys.data() + row, _mm_add_ps(_mm_loadu_ps(ys.data() + row), deltaY));
+   }
+#endif
+   for (; row < count; row++)
+   {
+      xs[row] += offset.X();
+      ys[row] += offset.Y();
+   }
+}
+
+size_t CoordinateTable::add(Coordinates &owner, Identifier id, SpacialCoordinate::AbsolutePoint point, InternedScope const &scope)
+{
+   xs.push_back(point.X());
+   ys.push_back(point.Y());
+   scopes.push_back(scope);
+   ids.push_back(id);
+   owners.push_back(&owner);
+   return owners.size() - 1;
+}
+
+void CoordinateTable::remove(size_t row)
+{
+   size_t last = owners.size() - 1;
+   if (row != last)
+   {
+      xs[row] = xs[last];
+      ys[row] = ys[last];
+      scopes[row] = std::move(scopes[last]);
+      ids[row] = ids[last];
+      owners[row] = owners[last];
+      owners[row]->row = row;
+   }
+   xs.pop_back();
+   ys.pop_back();
+   scopes.pop_back();
+   ids.pop_back();
+   owners.pop_back();
+}
+
+void CoordinateTable::setPoint(size_t row, SpacialCoordinate::AbsolutePoint point)
+{
+   xs[row] = point.X();
+   ys[row] = point.Y();
+}
+
+void CoordinateTable::setScope(size_t row, InternedScope const &scope)
+{
+   scopes[row] = scope;
+}
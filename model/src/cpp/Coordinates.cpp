@@ -1,9 +1,13 @@
+#include "contomap/model/CoordinateTable.h"
 #include "contomap/model/Coordinates.h"
 
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
 using contomap::model::Coordinates;
+using contomap::model::CoordinateTable;
+using contomap::model::Identifier;
+using contomap::model::InternedScope;
 using contomap::model::SpacialCoordinate;
 
 Coordinates::Coordinates(SpacialCoordinate spacial)
@@ -11,29 +15,76 @@ Coordinates::Coordinates(SpacialCoordinate spacial)
 {
 }
 
+Coordinates::~Coordinates()
+{
+   if (table != nullptr)
+   {
+      table->remove(row);
+   }
+}
+
+void Coordinates::placeIn(CoordinateTable *coordinateTable, Identifier owner, InternedScope const &scope)
+{
+   if (coordinateTable == nullptr)
+   {
+      return;
+   }
+   auto current = getSpacial();
+   if (table != nullptr)
+   {
+      table->remove(row);
+   }
+   table = coordinateTable;
+   row = table->add(*this, owner, current.getAbsoluteReference(), scope);
+}
+
+void Coordinates::setScope(InternedScope const &scope)
+{
+   if (table != nullptr)
+   {
+      table->setScope(row, scope);
+   }
+}
+
 void Coordinates::encode(Encoder &coder, std::string const &name) const
 {
    Coder::Scope scope(coder, name);
-   spacial.encode(coder, "spacial");
+   getSpacial().encode(coder, "spacial");
 }
 
 void Coordinates::decode(Decoder &coder, std::string const &name, uint8_t version)
 {
    Coder::Scope scope(coder, name);
-   spacial.decode(coder, "spacial", version);
+   SpacialCoordinate decoded;
+   decoded.decode(coder, "spacial", version);
+   setSpacial(decoded);
 }
 
 void Coordinates::setSpacial(SpacialCoordinate value)
 {
-   spacial = value;
+   if (table != nullptr)
+   {
+      table->setPoint(row, value.getAbsoluteReference());
+   }
+   else
+   {
+      spacial = value;
+   }
 }
 
 SpacialCoordinate Coordinates::getSpacial() const
 {
+   if (table != nullptr)
+   {
+      auto point = table->pointAt(row);
+      return SpacialCoordinate::absoluteAt(point.X(), point.Y());
+   }
    return spacial;
 }
 
 void Coordinates::moveBy(contomap::model::SpacialCoordinate::Offset offset)
 {
-   spacial.moveBy(offset);
+   auto moved = getSpacial();
+   moved.moveBy(offset);
+   setSpacial(moved);
 }
@@ -0,0 +1,14 @@
+#include "contomap/model/EntityPools.h"
+
+using contomap::infrastructure::MemoryAccount;
+using contomap::model::EntityPools;
+
+char const *const EntityPools::MemoryTag::NAME = "model";
+
+EntityPools::EntityPools()
+   : topics(&MemoryAccount::of<MemoryTag>())
+   , associations(&MemoryAccount::of<MemoryTag>())
+   , occurrences(&MemoryAccount::of<MemoryTag>())
+   , roles(&MemoryAccount::of<MemoryTag>())
+{
+}
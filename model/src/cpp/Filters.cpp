@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <ranges>
+
+#include "contomap/model/ContomapView.h"
+#include "contomap/model/Filters.h"
+#include "contomap/model/Topic.h"
+#include "contomap/model/TopicNameIndex.h"
+
+using contomap::model::ContomapView;
+using contomap::model::Identifiers;
+using contomap::model::ScopeTable;
+using contomap::model::Topic;
+using contomap::model::TopicName;
+using contomap::model::TopicNameIndex;
+using contomap::model::filters::NameLike;
+using contomap::model::filters::OccursAs;
+using contomap::model::filters::ScopeSelector;
+
+ScopeSelector::ScopeSelector(Identifiers scope)
+   : scope(std::move(scope))
+{
+}
+
+ScopeSelector::ScopeSelector(ScopeSelector const &other)
+   : scope(other.scope)
+{
+}
+
+ScopeSelector::ScopeSelector(ScopeSelector &&other) noexcept
+   : scope(std::move(other.scope))
+{
+}
+
+ScopeTable::Selection const &ScopeSelector::within(ContomapView const &view) const
+{
+   auto const &table = view.getScopes();
+   auto const *selected = current.load(std::memory_order_acquire);
+   if ((selected != nullptr) && (selected->table == &table))
+   {
+      return *selected->selection;
+   }
+
+   std::lock_guard guard(selectingMutex);
+   selected = current.load(std::memory_order_relaxed);
+   if ((selected == nullptr) || (selected->table != &table))
+   {
+      selected = selections.emplace_back(std::make_unique<Selected const>(Selected { .table = &table, .selection = table.selectWithin(scope) })).get();
+      current.store(selected, std::memory_order_release);
+   }
+   return *selected->selection;
+}
+
+OccursAs::OccursAs(Identifiers occurrences)
+   : occurrences(std::move(occurrences))
+{
+}
+
+bool OccursAs::matches(Topic const &topic, ContomapView const &) const
+{
+   return topic.occursAsAnyOf(occurrences);
+}
+
+std::optional<std::string_view> OccursAs::nameSearch() const
+{
+   return {};
+}
+
+NameLike::NameLike(std::string searchValue)
+   : searchValue(std::move(searchValue))
+   , foldedSearchValue(TopicNameIndex::fold(this->searchValue))
+{
+}
+
+bool NameLike::matches(Topic const &topic, ContomapView const &) const
+{
+   auto names = std::ranges::common_view(topic.allNames());
+   auto begin = names.begin();
+   auto end = names.end();
+   if (begin == end)
+   {
+      return searchValue.empty();
+   }
+   return !searchValue.empty() && std::any_of(begin, end, [this](TopicName const &name) { return contains(name.getValue().raw()); });
+}
+
+std::optional<std::string_view> NameLike::nameSearch() const
+{
+   return searchValue;
+}
+
+bool NameLike::contains(std::string const &value) const
+{
+   return TopicNameIndex::foldedContains(value, foldedSearchValue);
+}
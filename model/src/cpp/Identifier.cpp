@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <random>
+#include <vector>
 
 #include "contomap/model/Identifier.h"
 
@@ -8,6 +11,40 @@ using contomap::infrastructure::serial::Encoder;
 using contomap::model::Identifier;
 
 std::string const Identifier::ALLOWED_CHARACTERS("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ");
+// Batches start small and grow up to this size, so that short bulk allocations do not pay for a large batch.
+size_t const Identifier::BULK_ALLOCATION_SIZE = 1 << 16;
+
+namespace
+{
+
+struct BulkAllocationState
+{
+   size_t users = 0;
+   size_t batchSize = 0;
+   // Kept in descending order, so that the next identifier is taken from the back.
+   std::vector<Identifier::ValueType> values;
+};
+
+thread_local BulkAllocationState bulkAllocation;
+thread_local std::mt19937 generator(std::random_device {}());
+
+}
+
+Identifier::BulkAllocation::BulkAllocation()
+{
+   bulkAllocation.users++;
+}
+
+Identifier::BulkAllocation::~BulkAllocation()
+{
+   bulkAllocation.users--;
+   if (bulkAllocation.users == 0)
+   {
+      bulkAllocation.batchSize = 0;
+      bulkAllocation.values.clear();
+      bulkAllocation.values.shrink_to_fit();
+   }
+}
 
 Identifier::Identifier(ValueType const &value)
    : value(value)
@@ -28,16 +65,37 @@ Identifier Identifier::from(Decoder &coder, std::string const &name)
 }
 
 Identifier Identifier::random()
+{
+   if (bulkAllocation.users == 0)
+   {
+      return Identifier(randomValue());
+   }
+   auto &values = bulkAllocation.values;
+   if (values.empty())
+   {
+      bulkAllocation.batchSize = std::clamp<size_t>(bulkAllocation.batchSize * 2, 1 << 10, BULK_ALLOCATION_SIZE);
+      values.resize(bulkAllocation.batchSize);
+      std::generate(values.begin(), values.end(), randomValue);
+      std::sort(values.begin(), values.end(), std::greater<> {});
+   }
+   Identifier id(values.back());
+   values.pop_back();
+   return id;
+}
+
+void Identifier::seedRandom(uint32_t value)
+{
+   generator.seed(value);
+   bulkAllocation.values.clear();
+}
+
+Identifier::ValueType Identifier::randomValue()
 {
    // This algorithm creates a random identifier using the set of allowed characters, with the
    // extra requirement that no more than two letters are allowed in sequence. This is done
    // in order to avoid the accidental creation of words. There is still the potential that
    // words are created in "leet speak" by interpreting digits as letters, or that valid two-letter
    // words come out, yet this is negligible.
-   static thread_local std::mt19937 gen([]() {
-      std::random_device rd;
-      return rd();
-   }());
    std::uniform_int_distribution<size_t> allowedDigits(0, 9);
    std::uniform_int_distribution<size_t> allowedCharacters(0, ALLOWED_CHARACTERS.size() - 1);
    std::uniform_int_distribution<size_t> *currentSet = &allowedCharacters;
@@ -45,12 +103,23 @@ Identifier Identifier::random()
    size_t lettersInRow = 0;
    for (char &part : value)
    {
-      size_t index = (*currentSet)(gen);
+      size_t index = (*currentSet)(generator);
       part = ALLOWED_CHARACTERS[index];
       lettersInRow = (index < 10) ? 0 : (lettersInRow + 1);
       currentSet = (lettersInRow >= 2) ? &allowedDigits : &allowedCharacters;
    }
-   return Identifier(value);
+   return value;
+}
+
+size_t Identifier::hash() const noexcept
+{
+   // FNV-1a, which is sufficient for the short, random values.
+   uint64_t result = 0xCBF29CE484222325ULL;
+   for (char part : value)
+   {
+      result = (result ^ static_cast<uint8_t>(part)) * 0x100000001B3ULL;
+   }
+   return static_cast<size_t>(result);
 }
 
 void Identifier::encode(Encoder &coder, std::string const &name) const
@@ -25,6 +25,16 @@ Identifiers::CollectionType::const_iterator Identifiers::end() const
    return set.end();
 }
 
+size_t Identifiers::hash() const noexcept
+{
+   size_t result = set.size();
+   for (auto const &id : set)
+   {
+      result = (result * 31) ^ id.hash();
+   }
+   return result;
+}
+
 size_t Identifiers::size() const
 {
    return set.size();
@@ -0,0 +1,77 @@
+#include <utility>
+
+#include "contomap/model/InternedScope.h"
+
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::InternedScope;
+
+InternedScope::InternedScope(std::shared_ptr<Entry const> entry)
+   : entry(std::move(entry))
+{
+}
+
+InternedScope InternedScope::detached(Identifiers identifiers)
+{
+   if (identifiers.empty())
+   {
+      return {};
+   }
+   size_t hash = identifiers.hash();
+   return InternedScope(
+      std::make_shared<Entry const>(Entry { .identifiers = std::move(identifiers), .hash = hash, .table = nullptr, .key = DETACHED_KEY, .revision = 0 }));
+}
+
+Identifiers const &InternedScope::identifiers() const noexcept
+{
+   static Identifiers const EMPTY;
+   return (entry != nullptr) ? entry->identifiers : EMPTY;
+}
+
+size_t InternedScope::hash() const noexcept
+{
+   static size_t const EMPTY_HASH = Identifiers().hash();
+   return (entry != nullptr) ? entry->hash : EMPTY_HASH;
+}
+
+size_t InternedScope::size() const noexcept
+{
+   return (entry != nullptr) ? entry->identifiers.size() : 0;
+}
+
+bool InternedScope::empty() const noexcept
+{
+   return entry == nullptr;
+}
+
+bool InternedScope::contains(Identifier id) const
+{
+   return (entry != nullptr) && entry->identifiers.contains(id);
+}
+
+bool InternedScope::isIn(Identifiers const &viewScope) const
+{
+   return (entry == nullptr) || viewScope.contains(entry->identifiers);
+}
+
+bool InternedScope::isNarrowerThan(InternedScope const &other) const
+{
+   return (size() > other.size()) || ((size() == other.size()) && (identifiers() < other.identifiers()));
+}
+
+bool InternedScope::operator==(InternedScope const &other) const
+{
+   if (entry == other.entry)
+   {
+      return true;
+   }
+   if ((entry == nullptr) || (other.entry == nullptr))
+   {
+      return false;
+   }
+   if ((entry->table != nullptr) && (entry->table == other.entry->table))
+   {
+      return false;
+   }
+   return (entry->hash == other.entry->hash) && (entry->identifiers == other.entry->identifiers);
+}
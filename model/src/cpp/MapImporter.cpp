@@ -0,0 +1,582 @@
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <variant>
+
+#include "contomap/infrastructure/Trace.h"
+#include "contomap/model/MapImporter.h"
+
+using contomap::model::Association;
+using contomap::model::Contomap;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::MapImporter;
+using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
+using contomap::model::TopicNameValue;
+
+namespace
+{
+
+// The same scope as the editor uses for the default names of topics.
+Identifiers const DEFAULT_NAME_SCOPE;
+
+[[noreturn]] void failAt(size_t lineNumber, std::string const &message)
+{
+   throw std::runtime_error("line " + std::to_string(lineNumber) + ": " + message);
+}
+
+bool isBlank(std::string_view line)
+{
+   return std::all_of(line.begin(), line.end(), [](char c) { return (c == ' ') || (c == '\t') || (c == '\r'); });
+}
+
+void trimLineEnd(std::string &line)
+{
+   if (!line.empty() && (line.back() == '\r'))
+   {
+      line.pop_back();
+   }
+}
+
+// Splits one CSV record into given fields, reusing their storage. Quoted fields may span several lines.
+// Returns false at the end of the input.
+bool readCsvRecord(std::istream &input, std::string &line, size_t &lineNumber, std::vector<std::string> &fields)
+{
+   do
+   {
+      if (!std::getline(input, line))
+      {
+         return false;
+      }
+      lineNumber++;
+   } while (isBlank(line));
+   trimLineEnd(line);
+
+   size_t fieldCount = 0;
+   auto nextField = [&fields, &fieldCount]() -> std::string & {
+      if (fieldCount == fields.size())
+      {
+         fields.emplace_back();
+      }
+      auto &field = fields[fieldCount++];
+      field.clear();
+      return field;
+   };
+
+   auto *field = &nextField();
+   bool quoted = false;
+   size_t startLineNumber = lineNumber;
+   size_t pos = 0;
+   while (true)
+   {
+      if (pos == line.size())
+      {
+         if (!quoted)
+         {
+            break;
+         }
+         if (!std::getline(input, line))
+         {
+            failAt(startLineNumber, "unterminated quoted field");
+         }
+         lineNumber++;
+         trimLineEnd(line);
+         field->push_back('\n');
+         pos = 0;
+         continue;
+      }
+      char c = line[pos++];
+      if (quoted)
+      {
+         if (c != '"')
+         {
+            field->push_back(c);
+         }
+         else if ((pos < line.size()) && (line[pos] == '"'))
+         {
+            field->push_back('"');
+            pos++;
+         }
+         else
+         {
+            quoted = false;
+         }
+      }
+      else if (c == ',')
+      {
+         field = &nextField();
+      }
+      else if ((c == '"') && field->empty())
+      {
+         quoted = true;
+      }
+      else
+      {
+         field->push_back(c);
+      }
+   }
+   fields.resize(fieldCount);
+   return true;
+}
+
+void appendUtf8(std::string &text, uint32_t codePoint)
+{
+   if (codePoint < 0x80)
+   {
+      text.push_back(static_cast<char>(codePoint));
+   }
+   else if (codePoint < 0x800)
+   {
+      text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+      text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+   }
+   else if (codePoint < 0x10000)
+   {
+      text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+      text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+   }
+   else
+   {
+      text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+      text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+   }
+}
+
+// Parses one line that holds a flat JSON object. Member values must be strings or numbers; they are kept as text.
+class JsonLineParser
+{
+public:
+   JsonLineParser(std::string_view text, size_t lineNumber)
+      : text(text)
+      , lineNumber(lineNumber)
+   {
+   }
+
+   void parse(std::vector<std::string> &names, std::vector<std::string> &values)
+   {
+      names.clear();
+      values.clear();
+      expect('{');
+      if (peek() == '}')
+      {
+         pos++;
+      }
+      else
+      {
+         do
+         {
+            names.emplace_back();
+            parseString(names.back());
+            expect(':');
+            values.emplace_back();
+            parseValue(values.back());
+         } while (accept(','));
+         expect('}');
+      }
+      if (peek() != '\0')
+      {
+         failAt(lineNumber, "unexpected content after object");
+      }
+   }
+
+private:
+   char peek()
+   {
+      while ((pos < text.size()) && ((text[pos] == ' ') || (text[pos] == '\t') || (text[pos] == '\r')))
+      {
+         pos++;
+      }
+      return (pos < text.size()) ? text[pos] : '\0';
+   }
+
+   bool accept(char expected)
+   {
+      if (peek() != expected)
+      {
+         return false;
+      }
+      pos++;
+      return true;
+   }
+
+   void expect(char expected)
+   {
+      if (!accept(expected))
+      {
+         failAt(lineNumber, std::string("expected '") + expected + "'");
+      }
+   }
+
+   void parseValue(std::string &value)
+   {
+      char c = peek();
+      if (c == '"')
+      {
+         parseString(value);
+         return;
+      }
+      if ((c == '{') || (c == '['))
+      {
+         failAt(lineNumber, "nested values are not supported");
+      }
+      auto start = pos;
+      while ((pos < text.size()) && (text[pos] != ',') && (text[pos] != '}') && (text[pos] != ' ') && (text[pos] != '\t'))
+      {
+         pos++;
+      }
+      auto literal = text.substr(start, pos - start);
+      if (literal.empty())
+      {
+         failAt(lineNumber, "missing value");
+      }
+      if (literal != "null")
+      {
+         value.assign(literal);
+      }
+   }
+
+   void parseString(std::string &value)
+   {
+      expect('"');
+      while (true)
+      {
+         if (pos >= text.size())
+         {
+            failAt(lineNumber, "unterminated string");
+         }
+         char c = text[pos++];
+         if (c == '"')
+         {
+            return;
+         }
+         if (c != '\\')
+         {
+            value.push_back(c);
+            continue;
+         }
+         if (pos >= text.size())
+         {
+            failAt(lineNumber, "unterminated string");
+         }
+         char escaped = text[pos++];
+         switch (escaped)
+         {
+         case 'b':
+            value.push_back('\b');
+            break;
+         case 'f':
+            value.push_back('\f');
+            break;
+         case 'n':
+            value.push_back('\n');
+            break;
+         case 'r':
+            value.push_back('\r');
+            break;
+         case 't':
+            value.push_back('\t');
+            break;
+         case 'u':
+            appendUtf8(value, parseCodePoint());
+            break;
+         default:
+            value.push_back(escaped);
+            break;
+         }
+      }
+   }
+
+   uint32_t parseCodeUnit()
+   {
+      uint32_t unit = 0;
+      auto digits = text.substr(pos, 4);
+      auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), unit, 16);
+      if ((digits.size() != 4) || (error != std::errc {}) || (end != digits.data() + digits.size()))
+      {
+         failAt(lineNumber, "invalid unicode escape");
+      }
+      pos += 4;
+      return unit;
+   }
+
+   uint32_t parseCodePoint()
+   {
+      uint32_t unit = parseCodeUnit();
+      bool isHighSurrogate = (unit >= 0xD800) && (unit <= 0xDBFF);
+      if (isHighSurrogate && text.substr(pos).starts_with("\\u"))
+      {
+         pos += 2;
+         uint32_t low = parseCodeUnit();
+         if ((low < 0xDC00) || (low > 0xDFFF))
+         {
+            failAt(lineNumber, "invalid surrogate pair");
+         }
+         return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+      }
+      return unit;
+   }
+
+   std::string_view text;
+   size_t lineNumber;
+   size_t pos = 0;
+};
+
+}
+
+class MapImporter::Row
+{
+public:
+   Row(size_t lineNumber, std::vector<std::string> const &names, std::vector<std::string> const &values)
+      : lineNumber(lineNumber)
+      , names(names)
+      , values(values)
+   {
+   }
+
+   [[nodiscard]] size_t getLineNumber() const
+   {
+      return lineNumber;
+   }
+
+   [[nodiscard]] std::string_view field(std::string_view name) const
+   {
+      auto count = std::min(names.size(), values.size());
+      for (size_t i = 0; i < count; i++)
+      {
+         if (names[i] == name)
+         {
+            return values[i];
+         }
+      }
+      return {};
+   }
+
+   [[nodiscard]] std::string_view required(std::string_view name) const
+   {
+      auto value = field(name);
+      if (value.empty())
+      {
+         fail("missing field \"" + std::string(name) + "\"");
+      }
+      return value;
+   }
+
+   [[nodiscard]] SpacialCoordinate location() const
+   {
+      return SpacialCoordinate::absoluteAt(coordinate("x"), coordinate("y"));
+   }
+
+   [[noreturn]] void fail(std::string const &message) const
+   {
+      failAt(lineNumber, message);
+   }
+
+private:
+   [[nodiscard]] float coordinate(std::string_view name) const
+   {
+      auto text = required(name);
+      float value = 0.0f;
+      auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+      if ((error != std::errc {}) || (end != text.data() + text.size()))
+      {
+         fail("invalid number for \"" + std::string(name) + "\"");
+      }
+      return value;
+   }
+
+   size_t lineNumber;
+   std::vector<std::string> const &names;
+   std::vector<std::string> const &values;
+};
+
+MapImporter::MapImporter(Contomap &map)
+   : map(map)
+   , scope(Identifiers::ofSingle(map.getDefaultScope()))
+{
+}
+
+void MapImporter::read(std::istream &input, Format format)
+{
+   CONTOMAP_TRACE_ZONE("MapImporter::read");
+   Contomap::NameIndexDeferral deferral(map);
+   Identifier::BulkAllocation bulkAllocation;
+   if (format == Format::Csv)
+   {
+      readCsv(input);
+   }
+   else
+   {
+      readJsonLines(input);
+   }
+}
+
+void MapImporter::finish()
+{
+   CONTOMAP_TRACE_ZONE("MapImporter::finish");
+   for (auto const &pending : pendingRoles)
+   {
+      auto topic = topicsByKey.find(pending.topicKey);
+      if (topic == topicsByKey.end())
+      {
+         failAt(pending.lineNumber, "unknown topic \"" + pending.topicKey + "\"");
+      }
+      auto association = associationsByKey.find(pending.associationKey);
+      if (association == associationsByKey.end())
+      {
+         failAt(pending.lineNumber, "unknown association \"" + pending.associationKey + "\"");
+      }
+      link(topic->second, association->second);
+   }
+   pendingRoles.clear();
+}
+
+MapImporter::Statistics const &MapImporter::getStatistics() const
+{
+   return statistics;
+}
+
+void MapImporter::readCsv(std::istream &input)
+{
+   std::string line;
+   size_t lineNumber = 0;
+   std::vector<std::string> names;
+   if (!readCsvRecord(input, line, lineNumber, names))
+   {
+      return;
+   }
+   std::vector<std::string> values;
+   size_t recordLineNumber = lineNumber + 1;
+   while (readCsvRecord(input, line, lineNumber, values))
+   {
+      add(Row(recordLineNumber, names, values));
+      recordLineNumber = lineNumber + 1;
+   }
+}
+
+void MapImporter::readJsonLines(std::istream &input)
+{
+   std::string line;
+   size_t lineNumber = 0;
+   std::vector<std::string> names;
+   std::vector<std::string> values;
+   while (std::getline(input, line))
+   {
+      lineNumber++;
+      if (isBlank(line))
+      {
+         continue;
+      }
+      JsonLineParser(line, lineNumber).parse(names, values);
+      add(Row(lineNumber, names, values));
+   }
+}
+
+void MapImporter::add(Row const &row)
+{
+   auto kind = row.required("kind");
+   if (kind == "topic")
+   {
+      addTopic(row);
+   }
+   else if (kind == "occurrence")
+   {
+      addOccurrence(row);
+   }
+   else if (kind == "association")
+   {
+      addAssociation(row);
+   }
+   else if (kind == "role")
+   {
+      addRole(row);
+   }
+   else
+   {
+      row.fail("unknown kind \"" + std::string(kind) + "\"");
+   }
+   statistics.rows++;
+}
+
+void MapImporter::addTopic(Row const &row)
+{
+   std::string key(row.required("key"));
+   auto location = row.location();
+   std::variant<std::monostate, TopicNameValue> name;
+   if (auto rawName = row.field("name"); !rawName.empty())
+   {
+      name = TopicNameValue::from(std::string(rawName));
+      if (!std::holds_alternative<TopicNameValue>(name))
+      {
+         row.fail("invalid name");
+      }
+   }
+   if (topicsByKey.contains(key))
+   {
+      row.fail("duplicate topic \"" + key + "\"");
+   }
+
+   auto &topic = map.newTopic();
+   if (std::holds_alternative<TopicNameValue>(name))
+   {
+      static_cast<void>(topic.newName(DEFAULT_NAME_SCOPE, std::get<TopicNameValue>(name)));
+   }
+   static_cast<void>(topic.newOccurrence(scope, location));
+   topicsByKey.emplace(std::move(key), topic);
+   statistics.topics++;
+   statistics.occurrences++;
+}
+
+void MapImporter::addOccurrence(Row const &row)
+{
+   auto &topic = topicFor(row, row.required("topic"));
+   static_cast<void>(topic.newOccurrence(scope, row.location()));
+   statistics.occurrences++;
+}
+
+void MapImporter::addAssociation(Row const &row)
+{
+   std::string key(row.required("key"));
+   auto location = row.location();
+   if (associationsByKey.contains(key))
+   {
+      row.fail("duplicate association \"" + key + "\"");
+   }
+   auto &association = map.newAssociation(scope, location);
+   associationsByKey.emplace(std::move(key), association);
+   statistics.associations++;
+}
+
+void MapImporter::addRole(Row const &row)
+{
+   std::string topicKey(row.required("topic"));
+   std::string associationKey(row.required("association"));
+   auto topic = topicsByKey.find(topicKey);
+   auto association = associationsByKey.find(associationKey);
+   if ((topic == topicsByKey.end()) || (association == associationsByKey.end()))
+   {
+      pendingRoles.emplace_back(
+         PendingRole { .lineNumber = row.getLineNumber(), .topicKey = std::move(topicKey), .associationKey = std::move(associationKey) });
+      return;
+   }
+   link(topic->second, association->second);
+}
+
+void MapImporter::link(Topic &topic, Association &association)
+{
+   static_cast<void>(topic.newRole(association));
+   statistics.roles++;
+}
+
+Topic &MapImporter::topicFor(Row const &row, std::string_view key)
+{
+   auto it = topicsByKey.find(std::string(key));
+   if (it == topicsByKey.end())
+   {
+      row.fail("unknown topic \"" + std::string(key) + "\"");
+   }
+   return it->second;
+}
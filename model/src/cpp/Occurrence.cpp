@@ -1,36 +1,46 @@
 #include "contomap/model/Occurrence.h"
 #include "contomap/model/Topic.h"
 
+using contomap::infrastructure::SlabPool;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
+using contomap::model::CoordinateTable;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
+using contomap::model::InternedScope;
 using contomap::model::Occurrence;
 using contomap::model::OptionalIdentifier;
+using contomap::model::ScopeTable;
 using contomap::model::Style;
 using contomap::model::Topic;
 
-Occurrence::Occurrence(Identifier id, Topic &topic, Identifiers scope, SpacialCoordinate spacial)
+Occurrence::Occurrence(Identifier id, Topic &topic, InternedScope scope, SpacialCoordinate spacial, CoordinateTable *coordinateTable)
    : id(id)
    , topic(topic)
    , scope(std::move(scope))
    , location(spacial)
 {
+   location.placeIn(coordinateTable, id, this->scope);
 }
 
-Occurrence::Occurrence(Identifier id, Topic &topic)
+Occurrence::Occurrence(Identifier id, Topic &topic, CoordinateTable *coordinateTable)
    : id(id)
    , topic(topic)
 {
+   location.placeIn(coordinateTable, id, scope);
 }
 
-std::unique_ptr<Occurrence> Occurrence::from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id, Topic &topic,
-   std::function<Topic &(contomap::model::Identifier)> const &topicResolver)
+SlabPool<Occurrence>::Pointer Occurrence::from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id, Topic &topic,
+   std::function<Topic &(contomap::model::Identifier)> const &topicResolver, SlabPool<Occurrence> *pool, CoordinateTable *coordinateTable,
+   ScopeTable *scopeTable)
 {
    Coder::Scope serialScope(coder, "occurrence");
-   std::unique_ptr<Occurrence> occurrence(new Occurrence(id, topic));
-   occurrence->scope.decode(coder, "scope");
+   auto occurrence = SlabPool<Occurrence>::make(pool, id, topic, coordinateTable);
+   Identifiers scope;
+   scope.decode(coder, "scope");
+   occurrence->scope = ScopeTable::intern(scopeTable, std::move(scope));
+   occurrence->location.setScope(occurrence->scope);
    occurrence->location.decode(coder, "location", version);
    occurrence->type = OptionalIdentifier::from(coder, "type");
    // TODO: throw if topicResolver can not find type
@@ -42,7 +52,7 @@ std::unique_ptr<Occurrence> Occurrence::from(contomap::infrastructure::serial::D
 void Occurrence::encode(Encoder &coder) const
 {
    Coder::Scope serialScope(coder, "occurrence");
-   scope.encode(coder, "scope");
+   scope.identifiers().encode(coder, "scope");
    location.encode(coder, "location");
    type.encode(coder, "type");
    appearance.encode(coder, "appearance");
@@ -61,7 +71,7 @@ Topic const &Occurrence::getTopic() const
 
 Identifiers const &Occurrence::getScope() const
 {
-   return scope;
+   return scope.identifiers();
 }
 
 contomap::model::Coordinates const &Occurrence::getLocation() const
@@ -71,7 +81,12 @@ contomap::model::Coordinates const &Occurrence::getLocation() const
 
 bool Occurrence::isIn(Identifiers const &thatScope) const
 {
-   return thatScope.contains(scope);
+   return scope.isIn(thatScope);
+}
+
+bool Occurrence::isIn(ScopeTable::Selection const &selection) const
+{
+   return selection.contains(scope);
 }
 
 bool Occurrence::scopeContains(Identifier thatId) const
@@ -81,7 +96,7 @@ bool Occurrence::scopeContains(Identifier thatId) const
 
 bool Occurrence::hasNarrowerScopeThan(Occurrence const &other) const
 {
-   return (scope.size() > other.scope.size()) || (hasSameScopeSizeAs(other) && (scope < other.scope));
+   return scope.isNarrowerThan(other.scope);
 }
 
 bool Occurrence::hasSameScopeSizeAs(Occurrence const &other) const
@@ -2,6 +2,8 @@
 #include "contomap/model/Association.h"
 #include "contomap/model/Topic.h"
 
+using contomap::infrastructure::LinkCallback;
+using contomap::infrastructure::SlabPool;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
@@ -14,20 +16,22 @@ using contomap::model::Topic;
 
 Role::Role(Identifier id, Topic &topic, Association &association)
    : id(id)
-   , topic(topic.link(*this, [this]() { unlink(); }))
-   , association(association.link(*this, [this]() { unlink(); }))
+   , topic(LinkCallback::to<&Role::unlink>(*this))
+   , association(LinkCallback::to<&Role::unlink>(*this))
 {
+   topic.link(*this, this->topic);
+   association.link(*this, this->association);
 }
 
-std::unique_ptr<Role> Role::from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id,
+SlabPool<Role>::Pointer Role::from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id,
    std::function<Topic &(contomap::model::Identifier)> const &topicResolver,
-   std::function<Association &(contomap::model::Identifier)> const &associationResolver)
+   std::function<Association &(contomap::model::Identifier)> const &associationResolver, SlabPool<Role> *pool)
 {
    Coder::Scope scope(coder, "role");
    auto topicId = Identifier::from(coder, "topic");
    auto associationId = Identifier::from(coder, "association");
 
-   auto role = std::make_unique<Role>(id, topicResolver(topicId), associationResolver(associationId));
+   auto role = SlabPool<Role>::make(pool, id, topicResolver(topicId), associationResolver(associationId));
    role->type = OptionalIdentifier::from(coder, "type");
    // TODO: throw if topicResolver can not find type
    role->appearance.decode(coder, "appearance", version);
@@ -38,8 +42,8 @@ std::unique_ptr<Role> Role::from(contomap::infrastructure::serial::Decoder &code
 void Role::encode(contomap::infrastructure::serial::Encoder &coder) const
 {
    Coder::Scope scope(coder, "role");
-   topic->getLinked().getId().encode(coder, "topic");
-   association->getLinked().getId().encode(coder, "association");
+   topic.getLinked().getId().encode(coder, "topic");
+   association.getLinked().getId().encode(coder, "association");
    type.encode(coder, "type");
    appearance.encode(coder, "appearance");
    encodeReifiable(coder);
@@ -52,7 +56,7 @@ Identifier Role::getId() const
 
 Identifier Role::getParent() const
 {
-   return association->getLinked().getId();
+   return association.getLinked().getId();
 }
 
 void Role::setAppearance(Style style)
@@ -82,6 +86,6 @@ OptionalIdentifier Role::getType() const
 
 void Role::unlink()
 {
-   association.reset();
-   topic.reset();
+   association.unlink();
+   topic.unlink();
 }
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "contomap/model/ScopeTable.h"
+
+using contomap::model::Identifiers;
+using contomap::model::InternedScope;
+using contomap::model::ScopeTable;
+
+ScopeTable::Selection::Selection(ScopeTable const *table, Identifiers viewScope, uint64_t revision)
+   : table(table)
+   , viewScope(std::move(viewScope))
+   , revision(revision)
+{
+}
+
+bool ScopeTable::Selection::contains(InternedScope const &scope) const
+{
+   auto const *entry = scope.entry.get();
+   if (entry == nullptr)
+   {
+      return true;
+   }
+   // Entries of later revisions may have been created after this selection, possibly reusing the number of a released one.
+   if ((entry->table == table) && (entry->revision <= revision))
+   {
+      return within[entry->key];
+   }
+   return viewScope.contains(entry->identifiers);
+}
+
+Identifiers const &ScopeTable::Selection::getViewScope() const noexcept
+{
+   return viewScope;
+}
+
+InternedScope ScopeTable::intern(ScopeTable *table, Identifiers scope)
+{
+   return (table != nullptr) ? table->intern(std::move(scope)) : InternedScope::detached(std::move(scope));
+}
+
+InternedScope ScopeTable::intern(Identifiers scope)
+{
+   if (scope.empty())
+   {
+      return {};
+   }
+   std::lock_guard<std::mutex> guard(lock);
+   auto it = keysByScope.find(scope);
+   if (it != keysByScope.end())
+   {
+      auto entry = entries[it->second].lock();
+      if (entry == nullptr)
+      {
+         // The scope was released, but not swept yet. It is created anew, under its previous number.
+         entry = createEntry(it->second, std::move(scope));
+      }
+      return InternedScope(entry);
+   }
+   if (releasedKeys.empty() && (entries.size() >= nextSweepSize))
+   {
+      sweepReleased();
+   }
+   uint32_t key = 0;
+   if (releasedKeys.empty())
+   {
+      key = static_cast<uint32_t>(entries.size());
+      entries.emplace_back();
+   }
+   else
+   {
+      key = releasedKeys.back();
+      releasedKeys.pop_back();
+   }
+   keysByScope.emplace(scope, key);
+   return InternedScope(createEntry(key, std::move(scope)));
+}
+
+size_t ScopeTable::size() const
+{
+   std::lock_guard<std::mutex> guard(lock);
+   return static_cast<size_t>(std::count_if(entries.begin(), entries.end(), [](auto const &entry) { return !entry.expired(); }));
+}
+
+std::shared_ptr<ScopeTable::Selection const> ScopeTable::selectWithin(Identifiers const &viewScope) const
+{
+   std::lock_guard<std::mutex> guard(lock);
+   auto cached = std::find_if(cachedSelections.begin(), cachedSelections.end(),
+      [&viewScope](auto const &selection) { return selection->viewScope == viewScope; });
+   if (cached != cachedSelections.end())
+   {
+      if ((*cached)->revision == revision)
+      {
+         std::rotate(cachedSelections.begin(), cached, std::next(cached));
+         return cachedSelections.front();
+      }
+      cachedSelections.erase(cached);
+   }
+
+   std::shared_ptr<Selection> selection(new Selection(this, viewScope, revision));
+   selection->within.reserve(entries.size());
+   std::transform(entries.begin(), entries.end(), std::back_inserter(selection->within), [&viewScope](auto const &weakEntry) {
+      auto entry = weakEntry.lock();
+      return (entry != nullptr) && viewScope.contains(entry->identifiers);
+   });
+   if (cachedSelections.size() >= CACHED_SELECTIONS_LIMIT)
+   {
+      cachedSelections.pop_back();
+   }
+   cachedSelections.insert(cachedSelections.begin(), selection);
+   return selection;
+}
+
+std::shared_ptr<InternedScope::Entry const> ScopeTable::createEntry(uint32_t key, Identifiers scope)
+{
+   revision++;
+   size_t hash = scope.hash();
+   auto entry = std::make_shared<InternedScope::Entry const>(
+      InternedScope::Entry { .identifiers = std::move(scope), .hash = hash, .table = this, .key = key, .revision = revision });
+   entries[key] = entry;
+   return entry;
+}
+
+void ScopeTable::sweepReleased()
+{
+   for (auto it = keysByScope.begin(); it != keysByScope.end();)
+   {
+      if (entries[it->second].expired())
+      {
+         entries[it->second].reset();
+         releasedKeys.push_back(it->second);
+         it = keysByScope.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+   // Sweeping again only once the table doubled keeps the cost per interned scope constant.
+   nextSweepSize = std::max(MINIMUM_SWEEP_SIZE, keysByScope.size() * 2);
+}
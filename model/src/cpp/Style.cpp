@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <iterator>
+#include <map>
+
 #include "contomap/model/Style.h"
 
 using contomap::infrastructure::serial::Coder;
@@ -46,12 +50,17 @@ Style Style::averageOf(std::vector<Style> const &styles)
       uint32_t alpha = 0;
       uint32_t count = 0;
    };
-   std::map<ColorType, AccumulatedColor> accumulated;
+   std::array<AccumulatedColor, COLOR_TYPE_COUNT> accumulated {};
    for (auto const &style : styles)
    {
-      for (auto const &[type, value] : style.colors)
+      for (size_t index = 0; index < COLOR_TYPE_COUNT; index++)
       {
-         auto &acc = accumulated[type];
+         if ((style.presence & (1 << index)) == 0)
+         {
+            continue;
+         }
+         auto const &value = style.colors[index];
+         auto &acc = accumulated[index];
          acc.red += static_cast<uint32_t>(value.red);
          acc.green += static_cast<uint32_t>(value.green);
          acc.blue += static_cast<uint32_t>(value.blue);
@@ -60,25 +69,34 @@ Style Style::averageOf(std::vector<Style> const &styles)
       }
    }
    Style result;
-   for (auto &[type, acc] : accumulated)
+   for (size_t index = 0; index < COLOR_TYPE_COUNT; index++)
    {
-      result.colors[type] = Color {
+      auto const &acc = accumulated[index];
+      if (acc.count == 0)
+      {
+         continue;
+      }
+      result.colors[index] = Color {
          .red = static_cast<uint8_t>(acc.red / acc.count),
          .green = static_cast<uint8_t>(acc.green / acc.count),
          .blue = static_cast<uint8_t>(acc.blue / acc.count),
          .alpha = static_cast<uint8_t>(acc.alpha / acc.count),
       };
+      result.presence = static_cast<uint8_t>(result.presence | (1 << index));
    }
    return result;
 }
 
 void Style::encode(Encoder &coder, std::string const &name) const
 {
+   static std::array<ColorType, COLOR_TYPE_COUNT> const TYPES { ColorType::Text, ColorType::Line, ColorType::Fill };
+   std::vector<ColorType> presentTypes;
+   std::copy_if(TYPES.begin(), TYPES.end(), std::back_inserter(presentTypes), [this](ColorType type) { return has(type); });
    Coder::Scope scope(coder, name);
-   coder.codeArray("colors", colors.begin(), colors.end(), [](Encoder &nested, auto const &kvp) {
+   coder.codeArray("colors", presentTypes.begin(), presentTypes.end(), [this](Encoder &nested, ColorType type) {
       Coder::Scope nestedScope(nested, "");
-      nested.code("type", typeToSerial(kvp.first));
-      kvp.second.encode(nested, "color");
+      nested.code("type", typeToSerial(type));
+      colors[indexOf(type)].encode(nested, "color");
    });
 }
 
@@ -90,46 +108,52 @@ void Style::decode(Decoder &coder, std::string const &name, uint8_t)
       uint8_t serialType = 0x00;
       nested.code("type", serialType);
       auto color = Color::from(nested, "color");
-      colors.emplace(typeFromSerial(serialType), color);
+      auto type = typeFromSerial(serialType);
+      if (!has(type))
+      {
+         *this = with(type, color);
+      }
    });
 }
 
 Style Style::withDefaultsFrom(Style const &other) const
 {
    Style copy(*this);
-   for (auto const &[type, value] : other.colors)
+   for (size_t index = 0; index < COLOR_TYPE_COUNT; index++)
    {
-      if (!copy.colors.contains(type))
+      if ((other.presence & ~presence & (1 << index)) != 0)
       {
-         copy.colors[type] = value;
+         copy.colors[index] = other.colors[index];
       }
    }
+   copy.presence = static_cast<uint8_t>(presence | other.presence);
    return copy;
 }
 
 Style Style::with(ColorType type, Color value) const
 {
    Style copy(*this);
-   copy.colors[type] = value;
+   copy.colors[indexOf(type)] = value;
+   copy.presence = static_cast<uint8_t>(presence | bitOf(type));
    return copy;
 }
 
 Style Style::without(ColorType type) const
 {
    Style copy(*this);
-   copy.colors.erase(type);
+   copy.colors[indexOf(type)] = DEFAULT_COLOR;
+   copy.presence = static_cast<uint8_t>(presence & ~bitOf(type));
    return copy;
 }
 
 bool Style::has(ColorType type) const
 {
-   return colors.contains(type);
+   return (presence & bitOf(type)) != 0;
 }
 
 Style::Color Style::get(ColorType type, Color defaultColor) const
 {
-   auto it = colors.find(type);
-   return (it != colors.end()) ? it->second : defaultColor;
+   return has(type) ? colors[indexOf(type)] : defaultColor;
 }
 
 Style::ColorType Style::typeFromSerial(uint8_t value)
@@ -143,3 +167,13 @@ uint8_t Style::typeToSerial(ColorType type)
    static std::map<ColorType, uint8_t> CONSTANTS { { ColorType::Line, 0x01 }, { ColorType::Fill, 0x02 }, { ColorType::Text, 0x03 } };
    return CONSTANTS.at(type);
 }
+
+size_t Style::indexOf(ColorType type) noexcept
+{
+   return static_cast<size_t>(type);
+}
+
+uint8_t Style::bitOf(ColorType type) noexcept
+{
+   return static_cast<uint8_t>(1 << indexOf(type));
+}
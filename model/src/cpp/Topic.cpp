@@ -1,26 +1,39 @@
+#include "contomap/model/EntityPools.h"
 #include "contomap/model/Topic.h"
 
 using contomap::infrastructure::Link;
-using contomap::infrastructure::Links;
 using contomap::infrastructure::Search;
+using contomap::infrastructure::SlabPool;
 using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Decoder;
 using contomap::infrastructure::serial::Encoder;
 using contomap::model::Association;
+using contomap::model::CoordinateTable;
+using contomap::model::EntityPools;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
 using contomap::model::Occurrence;
 using contomap::model::Reified;
 using contomap::model::Role;
+using contomap::model::ScopeTable;
 using contomap::model::SpacialCoordinate;
 using contomap::model::Topic;
 using contomap::model::TopicName;
+using contomap::model::TopicNameIndex;
 
 Topic::Topic(Identifier id)
    : id(id)
 {
 }
 
+Topic::Topic(Identifier id, TopicNameIndex &nameIndex, EntityPools &pools)
+   : id(id)
+   , nameIndex(nameIndex)
+   , pools(&pools)
+{
+   nameIndex.addTopic(id);
+}
+
 Topic::~Topic()
 {
    clearReified();
@@ -47,7 +60,7 @@ void Topic::encodeRelated(Encoder &coder) const
    coder.codeArray("roles", roles.begin(), roles.end(), [](Encoder &nested, auto const &kvp) {
       Coder::Scope nestedScope(nested, "");
       kvp.first.encode(nested, "id");
-      kvp.second->role().encode(nested);
+      kvp.second.role().encode(nested);
    });
 }
 
@@ -58,20 +71,21 @@ void Topic::decodeRelated(
    coder.codeArray("names", [this, version](Decoder &nested, size_t) {
       Coder::Scope nameScope(nested, "");
       auto nameId = Identifier::from(nested, "id");
-      auto name = TopicName::from(nested, version, nameId);
-      names.emplace(nameId, name);
+      auto name = TopicName::from(nested, version, nameId, scopeTable());
+      indexName(names.tryEmplace(nameId, std::move(name)).first->second);
    });
    coder.codeArray("occurrences", [this, version, &topicResolver](Decoder &nested, size_t) {
       Coder::Scope nestedScope(nested, "");
       Identifier occurrenceId = Identifier::from(nested, "id");
-      occurrences.emplace(occurrenceId, Occurrence::from(nested, version, occurrenceId, *this, topicResolver));
+      occurrences.tryEmplace(
+         occurrenceId, Occurrence::from(nested, version, occurrenceId, *this, topicResolver, occurrencePool(), occurrenceLocations(), scopeTable()));
    });
    coder.codeArray("roles", [this, version, &topicResolver, &associationResolver](Decoder &nested, size_t) {
       Coder::Scope nestedScope(nested, "");
       Identifier roleId = Identifier::from(nested, "id");
-      auto role = Role::from(nested, version, roleId, topicResolver, associationResolver);
+      auto role = Role::from(nested, version, roleId, topicResolver, associationResolver, rolePool());
       auto it = roles.find(roleId);
-      it->second->own(std::move(role));
+      it->second.own(std::move(role));
    });
 }
 
@@ -83,7 +97,8 @@ Identifier Topic::getId() const
 TopicName &Topic::newName(Identifiers scope, contomap::model::TopicNameValue const &value)
 {
    auto nameId = Identifier::random();
-   auto it = names.emplace(nameId, TopicName(nameId, std::move(scope), value));
+   auto it = names.tryEmplace(nameId, nameId, ScopeTable::intern(scopeTable(), std::move(scope)), value);
+   indexName(it.first->second);
    return it.first->second;
 }
 
@@ -101,6 +116,7 @@ void Topic::setNameInScope(Identifiers const &scope, TopicNameValue value)
    if (existingName.has_value())
    {
       existingName.value().get().setValue(std::move(value));
+      indexName(existingName.value());
    }
    else
    {
@@ -115,13 +131,17 @@ void Topic::removeNameInScope(Identifiers const &scope)
    {
       return;
    }
-   names.erase(existingName.value().get().getId());
+   auto nameId = existingName.value().get().getId();
+   unindexName(nameId);
+   names.erase(nameId);
 }
 
 Occurrence &Topic::newOccurrence(Identifiers scope, SpacialCoordinate location)
 {
    auto occurrenceId = Identifier::random();
-   auto it = occurrences.emplace(occurrenceId, std::make_unique<Occurrence>(occurrenceId, *this, std::move(scope), location));
+   auto occurrence
+      = SlabPool<Occurrence>::make(occurrencePool(), occurrenceId, *this, ScopeTable::intern(scopeTable(), std::move(scope)), location, occurrenceLocations());
+   auto it = occurrences.tryEmplace(occurrenceId, std::move(occurrence));
    return *it.first->second;
 }
 
@@ -133,33 +153,24 @@ bool Topic::removeOccurrence(Identifier occurrenceId)
 Role &Topic::newRole(Association &association)
 {
    auto roleId = Identifier::random();
-   auto role = std::make_unique<Role>(roleId, *this, association);
+   auto role = SlabPool<Role>::make(rolePool(), roleId, *this, association);
    auto it = roles.find(roleId);
-   it->second->own(std::move(role));
-   return it->second->role();
+   it->second.own(std::move(role));
+   return it->second.role();
 }
 
-std::unique_ptr<Link<Topic>> Topic::link(Role &role, std::function<void()> topicUnlinked)
+void Topic::link(Role &role, Link<Topic> &topicLink)
 {
    Identifier roleId = role.getId();
-   auto links = Links::between(*this, std::move(topicUnlinked), role, [this, roleId]() { roles.erase(roleId); });
-   roles.emplace(roleId, std::make_unique<RoleEntry>(std::move(links.second)));
-   return std::move(links.first);
+   auto it = roles.tryEmplace(roleId, *this, roleId).first;
+   it->second.linkWith(role, topicLink);
 }
 
 void Topic::removeRolesOf(Association &association)
 {
-   Identifiers toRemove;
-   for (auto const &[roleId, entry] : roles)
-   {
-      if (entry->role().getParent() == association.getId())
-      {
-         toRemove.add(roleId);
-      }
-   }
-   std::erase_if(roles, [&toRemove](auto const &kvp) {
+   roles.eraseIf([&association](auto const &kvp) {
       auto const &entry = kvp.second;
-      return toRemove.contains(entry->role().getId());
+      return entry.role().getParent() == association.getId();
    });
 }
 
@@ -170,9 +181,17 @@ void Topic::removeRole(Identifier roleId)
 
 bool Topic::isIn(Identifiers const &scope) const
 {
+   // The few occurrences of a topic are checked directly. Selecting the scope from the table would take its lock, and, for
+   // ever changing scopes, replace the selections that are cached for the view scope. Callers that check many topics
+   // select the scope once, and use the overload for a selection.
    return std::any_of(occurrences.begin(), occurrences.end(), [&scope](auto const &kvp) { return kvp.second->isIn(scope); });
 }
 
+bool Topic::isIn(ScopeTable::Selection const &selection) const
+{
+   return std::any_of(occurrences.begin(), occurrences.end(), [&selection](auto const &kvp) { return kvp.second->isIn(selection); });
+}
+
 bool Topic::occursAsAnyOf(Identifiers const &occurrenceIds) const
 {
    return std::any_of(occurrences.begin(), occurrences.end(), [&occurrenceIds](auto const &kvp) { return occurrenceIds.contains(kvp.first); });
@@ -185,6 +204,7 @@ bool Topic::isWithoutOccurrences() const
 
 Search<Occurrence const> Topic::occurrencesIn(contomap::model::Identifiers scope) const // NOLINT
 {
+   // As with isIn(), the scopes of the occurrences are checked directly.
    for (auto const &kvp : occurrences)
    {
       auto const &occurrence = kvp.second;
@@ -195,6 +215,25 @@ Search<Occurrence const> Topic::occurrencesIn(contomap::model::Identifiers scope
    }
 }
 
+Search<Occurrence const> Topic::occurrencesIn(ScopeTable::Selection const &selection) const // NOLINT
+{
+   for (auto const &kvp : occurrences)
+   {
+      if (kvp.second->isIn(selection))
+      {
+         co_yield *kvp.second;
+      }
+   }
+}
+
+Search<Occurrence const> Topic::allOccurrences() const // NOLINT
+{
+   for (auto const &kvp : occurrences)
+   {
+      co_yield *kvp.second;
+   }
+}
+
 std::optional<std::reference_wrapper<Occurrence const>> Topic::closestOccurrenceTo(contomap::model::Identifiers const &scope) const
 {
    auto scopedView = std::ranges::common_view(occurrencesIn(scope));
@@ -235,7 +274,7 @@ Occurrence const &Topic::previousOccurrenceBefore(Identifier reference) const
    }
    if (it == occurrences.begin())
    {
-      return *occurrences.rbegin()->second;
+      return *std::prev(occurrences.end())->second;
    }
    it--;
    return *it->second;
@@ -275,9 +314,9 @@ Search<Role const> Topic::rolesAssociatedWith(Identifiers associations) const //
    for (auto const &kvp : roles)
    {
       auto const &entry = kvp.second;
-      if (associations.contains(entry->role().getParent()))
+      if (associations.contains(entry.role().getParent()))
       {
-         co_yield entry->role();
+         co_yield entry.role();
       }
    }
 }
@@ -288,7 +327,7 @@ Search<Role const> Topic::findRoles(contomap::model::Identifiers const &ids) con
    {
       if (ids.contains(roleId))
       {
-         co_yield entry->role();
+         co_yield entry.role();
       }
    }
 }
@@ -299,20 +338,25 @@ Search<Role> Topic::findRoles(contomap::model::Identifiers const &ids) // NOLINT
    {
       if (ids.contains(roleId))
       {
-         co_yield entry->role();
+         co_yield entry.role();
       }
    }
 }
 
 void Topic::removeTopicReferences(Identifier topicId)
 {
-   std::erase_if(occurrences, [&topicId](auto const &kvp) {
+   occurrences.eraseIf([&topicId](auto const &kvp) {
       auto const &occurrence = kvp.second;
       return occurrence->scopeContains(topicId);
    });
-   std::erase_if(names, [&topicId](auto const &kvp) {
+   names.eraseIf([this, &topicId](auto const &kvp) {
       auto const &name = kvp.second;
-      return name.scopeContains(topicId);
+      bool isReferencing = name.scopeContains(topicId);
+      if (isReferencing)
+      {
+         unindexName(kvp.first);
+      }
+      return isReferencing;
    });
    for (auto &kvp : occurrences)
    {
@@ -325,7 +369,7 @@ void Topic::removeTopicReferences(Identifier topicId)
    }
    for (auto &kvp : roles)
    {
-      auto &role = kvp.second->role();
+      auto &role = kvp.second.role();
       auto typeId = role.getType();
       if (typeId.isAssigned() && (typeId.value() == topicId))
       {
@@ -336,10 +380,11 @@ void Topic::removeTopicReferences(Identifier topicId)
 
 std::optional<std::reference_wrapper<TopicName>> Topic::findNameByScope(Identifiers const &scope)
 {
+   size_t scopeHash = scope.hash();
    for (auto &kvp : names)
    {
       auto &name = kvp.second;
-      if (name.scopeEquals(scope))
+      if ((name.scopeHash() == scopeHash) && name.scopeEquals(scope))
       {
          return { name };
       }
@@ -347,6 +392,22 @@ std::optional<std::reference_wrapper<TopicName>> Topic::findNameByScope(Identifi
    return {};
 }
 
+void Topic::indexName(TopicName const &name)
+{
+   if (nameIndex.has_value())
+   {
+      nameIndex.value().get().setName(id, name.getId(), name.getValue().raw());
+   }
+}
+
+void Topic::unindexName(Identifier nameId)
+{
+   if (nameIndex.has_value())
+   {
+      nameIndex.value().get().removeName(nameId);
+   }
+}
+
 void Topic::setReified(Reified &item)
 {
    clearReified();
@@ -363,3 +424,23 @@ void Topic::clearReified()
    reified.reset();
    old.clearReifier();
 }
+
+SlabPool<Occurrence> *Topic::occurrencePool() const
+{
+   return (pools != nullptr) ? &pools->occurrences : nullptr;
+}
+
+SlabPool<Role> *Topic::rolePool() const
+{
+   return (pools != nullptr) ? &pools->roles : nullptr;
+}
+
+CoordinateTable *Topic::occurrenceLocations() const
+{
+   return (pools != nullptr) ? &pools->occurrenceLocations : nullptr;
+}
+
+ScopeTable *Topic::scopeTable() const
+{
+   return (pools != nullptr) ? &pools->scopes : nullptr;
+}
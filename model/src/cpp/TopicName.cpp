@@ -6,29 +6,31 @@ using contomap::infrastructure::serial::Coder;
 using contomap::infrastructure::serial::Encoder;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
+using contomap::model::InternedScope;
+using contomap::model::ScopeTable;
 using contomap::model::TopicName;
 using contomap::model::TopicNameValue;
 
-TopicName::TopicName(Identifier id, Identifiers scope, TopicNameValue value)
+TopicName::TopicName(Identifier id, InternedScope scope, TopicNameValue value)
    : id(id)
    , scope(std::move(scope))
    , value(std::move(value))
 {
 }
 
-TopicName TopicName::from(contomap::infrastructure::serial::Decoder &coder, uint8_t, contomap::model::Identifier id)
+TopicName TopicName::from(contomap::infrastructure::serial::Decoder &coder, uint8_t, contomap::model::Identifier id, ScopeTable *scopeTable)
 {
    Coder::Scope nameScope(coder, "topicName");
    Identifiers scope;
    scope.decode(coder, "scope");
    auto value = TopicNameValue::from(coder);
-   return { id, scope, value };
+   return { id, ScopeTable::intern(scopeTable, std::move(scope)), value };
 }
 
 void TopicName::encode(Encoder &coder) const
 {
    Coder::Scope nameScope(coder, "topicName");
-   scope.encode(coder, "scope");
+   scope.identifiers().encode(coder, "scope");
    value.encode(coder);
 }
 
@@ -42,14 +44,19 @@ void TopicName::setValue(TopicNameValue newValue)
    value = std::move(newValue);
 }
 
-TopicNameValue TopicName::getValue() const
+TopicNameValue const &TopicName::getValue() const
 {
    return value;
 }
 
 bool TopicName::isIn(Identifiers const &thatScope) const
 {
-   return thatScope.contains(scope);
+   return scope.isIn(thatScope);
+}
+
+bool TopicName::isIn(ScopeTable::Selection const &selection) const
+{
+   return selection.contains(scope);
 }
 
 bool TopicName::scopeContains(contomap::model::Identifier thatId) const
@@ -59,12 +66,17 @@ bool TopicName::scopeContains(contomap::model::Identifier thatId) const
 
 bool TopicName::scopeEquals(Identifiers const &thatScope) const
 {
-   return scope == thatScope;
+   return scope.identifiers() == thatScope;
+}
+
+size_t TopicName::scopeHash() const
+{
+   return scope.hash();
 }
 
 bool TopicName::hasNarrowerScopeThan(TopicName const &other) const
 {
-   return (scope.size() > other.scope.size()) || (hasSameScopeSizeAs(other) && (scope < other.scope));
+   return scope.isNarrowerThan(other.scope);
 }
 
 bool TopicName::hasSameScopeSizeAs(TopicName const &other) const
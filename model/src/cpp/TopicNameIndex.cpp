@@ -0,0 +1,387 @@
+#include <algorithm>
+#include <tuple>
+
+#include "contomap/model/TopicNameIndex.h"
+
+using contomap::model::Identifier;
+using contomap::model::TopicNameIndex;
+
+// Applying pending postings in chunks keeps the memory of a deferral bounded, while the chunks stay large enough to be sorted efficiently.
+size_t const TopicNameIndex::PENDING_POSTINGS_LIMIT = 1 << 20;
+
+std::string const &TopicNameIndex::Result::getSearchValue() const
+{
+   return searchValue;
+}
+
+uint64_t TopicNameIndex::Result::getRevision() const
+{
+   return revision;
+}
+
+std::vector<Identifier> const &TopicNameIndex::Result::getTopics() const
+{
+   return topicIds;
+}
+
+size_t TopicNameIndex::Result::size() const
+{
+   return topicIds.size();
+}
+
+std::string TopicNameIndex::fold(std::string_view text)
+{
+   std::string result;
+   result.reserve(text.size());
+   std::array<char, 2> folded {};
+   for (size_t i = 0; i < text.size();)
+   {
+      auto length = foldUnitAt(text, i, folded);
+      result.append(folded.data(), length);
+      i += length;
+   }
+   return result;
+}
+
+bool TopicNameIndex::foldedContains(std::string_view text, std::string_view foldedSearchValue)
+{
+   // Folding keeps the length of each unit, so a match in the folded text starts at the same position as in the original.
+   std::array<char, 2> folded {};
+   for (size_t start = 0; start < text.size();)
+   {
+      size_t startLength = foldUnitAt(text, start, folded);
+      size_t length = startLength;
+      size_t matched = 0;
+      for (size_t i = start; foldedSearchValue.compare(matched, length, folded.data(), length) == 0;)
+      {
+         matched += length;
+         i += length;
+         if (matched == foldedSearchValue.size())
+         {
+            return true;
+         }
+         if (i >= text.size())
+         {
+            return false;
+         }
+         length = foldUnitAt(text, i, folded);
+      }
+      start += startLength;
+   }
+   return foldedSearchValue.empty();
+}
+
+void TopicNameIndex::addTopic(Identifier topicId)
+{
+   namesByTopic.try_emplace(topicId);
+   revision++;
+}
+
+void TopicNameIndex::removeTopic(Identifier topicId)
+{
+   auto topicIt = namesByTopic.find(topicId);
+   if (topicIt == namesByTopic.end())
+   {
+      return;
+   }
+   auto nameIds = topicIt->second;
+   for (auto const &nameId : nameIds)
+   {
+      auto nameIt = names.find(nameId);
+      if (nameIt != names.end())
+      {
+         unlinkName(nameIt);
+      }
+   }
+   namesByTopic.erase(topicId);
+   revision++;
+}
+
+void TopicNameIndex::setName(Identifier topicId, Identifier nameId, std::string_view value)
+{
+   auto existing = names.find(nameId);
+   if (existing != names.end())
+   {
+      unlinkName(existing);
+   }
+   auto [it, inserted] = names.emplace(nameId, NameEntry { .topicId = topicId, .folded = fold(value) });
+   namesByTopic[topicId].insert(nameId);
+   for (auto trigram : trigramsOf(it->second.folded))
+   {
+      if (deferringPostings)
+      {
+         pendingPostings.emplace_back(trigram, nameId);
+      }
+      else
+      {
+         postings[trigram].insert(nameId);
+      }
+   }
+   if (pendingPostings.size() >= PENDING_POSTINGS_LIMIT)
+   {
+      applyPendingPostings();
+   }
+   revision++;
+}
+
+void TopicNameIndex::removeName(Identifier nameId)
+{
+   auto it = names.find(nameId);
+   if (it == names.end())
+   {
+      return;
+   }
+   unlinkName(it);
+   revision++;
+}
+
+void TopicNameIndex::clear()
+{
+   names.clear();
+   namesByTopic.clear();
+   postings.clear();
+   pendingPostings.clear();
+   revision++;
+}
+
+void TopicNameIndex::deferPostings()
+{
+   deferringPostings = true;
+}
+
+void TopicNameIndex::flushPostings()
+{
+   applyPendingPostings();
+   deferringPostings = false;
+   revision++;
+}
+
+uint64_t TopicNameIndex::getRevision() const
+{
+   return revision;
+}
+
+TopicNameIndex::Result TopicNameIndex::find(std::string const &searchValue) const
+{
+   auto folded = fold(searchValue);
+   if (folded.empty())
+   {
+      return findUnnamed(searchValue);
+   }
+   std::vector<Identifier> candidates;
+   if (folded.size() < 3)
+   {
+      candidates.reserve(names.size());
+      std::transform(names.begin(), names.end(), std::back_inserter(candidates), [](auto const &kvp) { return kvp.first; });
+   }
+   else if (auto const *shortest = shortestPostingsFor(folded); shortest != nullptr)
+   {
+      candidates.assign(shortest->begin(), shortest->end());
+   }
+   return rank(searchValue, std::move(folded), candidates);
+}
+
+TopicNameIndex::Result TopicNameIndex::find(std::string const &searchValue, Result const &previous) const
+{
+   auto folded = fold(searchValue);
+   bool isRefinement = (previous.revision == revision) && !previous.foldedSearchValue.empty() && (folded.find(previous.foldedSearchValue) != std::string::npos);
+   if (!isRefinement)
+   {
+      return find(searchValue);
+   }
+   return rank(searchValue, std::move(folded), previous.nameIds);
+}
+
+size_t TopicNameIndex::foldUnitAt(std::string_view text, size_t index, std::array<char, 2> &folded)
+{
+   auto foldCodePoint = [](uint32_t codePoint) -> uint32_t {
+      bool isLatin1Capital = (codePoint >= 0xC0) && (codePoint <= 0xDE) && (codePoint != 0xD7);
+      bool isGreekCapital = (codePoint >= 0x391) && (codePoint <= 0x3A9) && (codePoint != 0x3A2);
+      bool isCyrillicCapital = (codePoint >= 0x410) && (codePoint <= 0x42F);
+      if (isLatin1Capital || isGreekCapital || isCyrillicCapital)
+      {
+         return codePoint + 0x20;
+      }
+      if ((codePoint >= 0x400) && (codePoint <= 0x40F))
+      {
+         return codePoint + 0x50;
+      }
+      return codePoint;
+   };
+
+   // Only single bytes and two-byte sequences are folded, and they keep their length. Any other byte is taken as it is.
+   auto c = static_cast<unsigned char>(text[index]);
+   if ((c >= 'A') && (c <= 'Z'))
+   {
+      folded[0] = static_cast<char>(c - 'A' + 'a');
+      return 1;
+   }
+   if (((c & 0xE0) == 0xC0) && ((index + 1) < text.size()) && ((static_cast<unsigned char>(text[index + 1]) & 0xC0) == 0x80))
+   {
+      uint32_t codePoint = foldCodePoint(((c & 0x1Fu) << 6) | (static_cast<unsigned char>(text[index + 1]) & 0x3Fu));
+      folded[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+      folded[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+      return 2;
+   }
+   folded[0] = static_cast<char>(c);
+   return 1;
+}
+
+std::vector<TopicNameIndex::Trigram> TopicNameIndex::trigramsOf(std::string_view folded)
+{
+   std::vector<Trigram> result;
+   for (size_t i = 0; (i + 2) < folded.size(); i++)
+   {
+      result.emplace_back((static_cast<Trigram>(static_cast<unsigned char>(folded[i])) << 16)
+         | (static_cast<Trigram>(static_cast<unsigned char>(folded[i + 1])) << 8) | static_cast<Trigram>(static_cast<unsigned char>(folded[i + 2])));
+   }
+   std::sort(result.begin(), result.end());
+   result.erase(std::unique(result.begin(), result.end()), result.end());
+   return result;
+}
+
+TopicNameIndex::Relevance TopicNameIndex::relevanceOf(std::string_view folded, std::string_view foldedSearchValue)
+{
+   if (folded == foldedSearchValue)
+   {
+      return Relevance::Exact;
+   }
+   auto pos = folded.find(foldedSearchValue);
+   if (pos == 0)
+   {
+      return Relevance::Prefix;
+   }
+   auto isSeparator = [](char c) { return (c == ' ') || (c == '-') || (c == '_') || (c == '.') || (c == '(') || (c == '/'); };
+   for (; pos != std::string_view::npos; pos = folded.find(foldedSearchValue, pos + 1))
+   {
+      if (isSeparator(folded[pos - 1]))
+      {
+         return Relevance::WordStart;
+      }
+   }
+   return Relevance::Substring;
+}
+
+TopicNameIndex::Result TopicNameIndex::findUnnamed(std::string const &searchValue) const
+{
+   Result result;
+   result.searchValue = searchValue;
+   result.revision = revision;
+   for (auto const &[topicId, nameIds] : namesByTopic)
+   {
+      if (nameIds.empty())
+      {
+         result.topicIds.emplace_back(topicId);
+      }
+   }
+   return result;
+}
+
+TopicNameIndex::Result TopicNameIndex::rank(std::string const &searchValue, std::string foldedSearchValue, std::vector<Identifier> const &candidates) const
+{
+   struct Ranked
+   {
+      Relevance relevance;
+      std::string_view name;
+      Identifier topicId;
+
+      [[nodiscard]] bool operator<(Ranked const &other) const
+      {
+         return std::make_tuple(relevance, name.size(), name, topicId) < std::make_tuple(other.relevance, other.name.size(), other.name, other.topicId);
+      }
+   };
+
+   Result result;
+   result.searchValue = searchValue;
+   result.revision = revision;
+   std::map<Identifier, Ranked> bestByTopic;
+   for (auto const &nameId : candidates)
+   {
+      auto it = names.find(nameId);
+      if ((it == names.end()) || (it->second.folded.find(foldedSearchValue) == std::string::npos))
+      {
+         continue;
+      }
+      auto const &entry = it->second;
+      result.nameIds.emplace_back(nameId);
+      Ranked ranked { .relevance = relevanceOf(entry.folded, foldedSearchValue), .name = entry.folded, .topicId = entry.topicId };
+      auto [best, inserted] = bestByTopic.try_emplace(entry.topicId, ranked);
+      if (!inserted && (ranked < best->second))
+      {
+         best->second = ranked;
+      }
+   }
+
+   std::vector<Ranked> ordered;
+   ordered.reserve(bestByTopic.size());
+   std::transform(bestByTopic.begin(), bestByTopic.end(), std::back_inserter(ordered), [](auto const &kvp) { return kvp.second; });
+   std::sort(ordered.begin(), ordered.end());
+   result.topicIds.reserve(ordered.size());
+   std::transform(ordered.begin(), ordered.end(), std::back_inserter(result.topicIds), [](Ranked const &ranked) { return ranked.topicId; });
+   result.foldedSearchValue = std::move(foldedSearchValue);
+   return result;
+}
+
+std::set<Identifier> const *TopicNameIndex::shortestPostingsFor(std::string_view foldedSearchValue) const
+{
+   std::set<Identifier> const *shortest = nullptr;
+   for (auto trigram : trigramsOf(foldedSearchValue))
+   {
+      auto it = postings.find(trigram);
+      if (it == postings.end())
+      {
+         return nullptr;
+      }
+      if ((shortest == nullptr) || (it->second.size() < shortest->size()))
+      {
+         shortest = &it->second;
+      }
+   }
+   return shortest;
+}
+
+void TopicNameIndex::unlinkName(std::map<Identifier, NameEntry>::iterator it)
+{
+   applyPendingPostings();
+   auto const &[nameId, entry] = *it;
+   for (auto trigram : trigramsOf(entry.folded))
+   {
+      auto postingIt = postings.find(trigram);
+      if (postingIt == postings.end())
+      {
+         continue;
+      }
+      postingIt->second.erase(nameId);
+      if (postingIt->second.empty())
+      {
+         postings.erase(postingIt);
+      }
+   }
+   auto topicIt = namesByTopic.find(entry.topicId);
+   if (topicIt != namesByTopic.end())
+   {
+      topicIt->second.erase(nameId);
+   }
+   names.erase(it);
+}
+
+void TopicNameIndex::applyPendingPostings()
+{
+   if (pendingPostings.empty())
+   {
+      return;
+   }
+   std::sort(pendingPostings.begin(), pendingPostings.end());
+   auto postingIt = postings.end();
+   std::set<Identifier>::iterator hint;
+   for (auto const &[trigram, nameId] : pendingPostings)
+   {
+      if ((postingIt == postings.end()) || (postingIt->first != trigram))
+      {
+         postingIt = postings.try_emplace(trigram).first;
+         hint = postingIt->second.end();
+      }
+      hint = std::next(postingIt->second.insert(hint, nameId));
+   }
+   pendingPostings.clear();
+}
@@ -2,9 +2,10 @@
 
 #include "contomap/model/TopicNameValue.h"
 
+using contomap::infrastructure::InternedString;
 using contomap::model::TopicNameValue;
 
-TopicNameValue::TopicNameValue(std::string value)
+TopicNameValue::TopicNameValue(InternedString value)
    : value(std::move(value))
 {
 }
@@ -15,7 +16,7 @@ std::variant<std::monostate, TopicNameValue> TopicNameValue::from(std::string va
    {
       return {};
    }
-   return TopicNameValue(std::move(value));
+   return TopicNameValue(InternedString::of(value));
 }
 
 TopicNameValue TopicNameValue::from(contomap::infrastructure::serial::Decoder &coder)
@@ -32,10 +33,15 @@ TopicNameValue TopicNameValue::from(contomap::infrastructure::serial::Decoder &c
 
 void TopicNameValue::encode(contomap::infrastructure::serial::Encoder &coder) const
 {
-   coder.code("value", value);
+   coder.code("value", value.str());
+}
+
+std::string const &TopicNameValue::raw() const
+{
+   return value.str();
 }
 
-std::string TopicNameValue::raw() const
+InternedString const &TopicNameValue::interned() const
 {
    return value;
 }
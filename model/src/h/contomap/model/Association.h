@@ -2,12 +2,15 @@
 
 #include "contomap/infrastructure/Link.h"
 #include "contomap/infrastructure/serial/Encoder.h"
+#include "contomap/model/CoordinateTable.h"
 #include "contomap/model/Coordinates.h"
 #include "contomap/model/Identifier.h"
 #include "contomap/model/Identifiers.h"
+#include "contomap/model/InternedScope.h"
 #include "contomap/model/OptionalIdentifier.h"
 #include "contomap/model/Reifiable.h"
 #include "contomap/model/Role.h"
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/Style.h"
 
 namespace contomap::model
@@ -25,16 +28,19 @@ public:
     * Constructor.
     *
     * @param id the primary identifier of this association.
+    * @param coordinateTable the table to keep the location in. May be nullptr to keep it with the instance.
     */
-   explicit Association(contomap::model::Identifier id);
+   Association(contomap::model::Identifier id, contomap::model::CoordinateTable *coordinateTable);
    /**
     * Constructor.
     *
     * @param id the primary identifier of this association.
     * @param scope the scope within which this association is valid.
     * @param spacial the known, initial point where the association is happening.
+    * @param coordinateTable the table to keep the location in. May be nullptr to keep it with the instance.
     */
-   Association(contomap::model::Identifier id, contomap::model::Identifiers scope, contomap::model::SpacialCoordinate spacial);
+   Association(contomap::model::Identifier id, contomap::model::InternedScope scope, contomap::model::SpacialCoordinate spacial,
+      contomap::model::CoordinateTable *coordinateTable);
 
    /**
     * Serializes the properties of the association.
@@ -49,9 +55,10 @@ public:
     * @param coder the decoder to use.
     * @param version the version to consider.
     * @param topicResolver the function to use for resolving topic references.
+    * @param scopeTable the table to intern the scope in. May be nullptr to keep it detached.
     */
    void decodeProperties(contomap::infrastructure::serial::Decoder &coder, uint8_t version,
-      std::function<contomap::model::Topic &(contomap::model::Identifier)> const &topicResolver);
+      std::function<contomap::model::Topic &(contomap::model::Identifier)> const &topicResolver, contomap::model::ScopeTable *scopeTable);
 
    /**
     * @return the unique identifier of this association instance.
@@ -85,6 +92,14 @@ public:
     */
    [[nodiscard]] bool isIn(contomap::model::Identifiers const &thatScope) const;
 
+   /**
+    * Return true if this instance is in the view scope of given selection.
+    *
+    * @param selection the selection of scopes to look up.
+    * @return true if the association is in the selected view scope.
+    */
+   [[nodiscard]] bool isIn(contomap::model::ScopeTable::Selection const &selection) const;
+
    /**
     * @return true if the association is nowhere presented.
     */
@@ -94,10 +109,9 @@ public:
     * Establishes a link with given role.
     *
     * @param role the role instance to link with.
-    * @param associationUnlinked the function to pass on to the returned link.
-    * @return the link that refers to this instance.
+    * @param associationLink the link of the role that shall refer to this instance.
     */
-   [[nodiscard]] std::unique_ptr<contomap::infrastructure::Link<Association>> link(contomap::model::Role &role, std::function<void()> associationUnlinked);
+   void link(contomap::model::Role &role, contomap::infrastructure::Link<Association> &associationLink);
 
    /**
     * @return true if the association has at least one role.
@@ -141,29 +155,40 @@ private:
    class RoleEntry
    {
    public:
-      explicit RoleEntry(std::unique_ptr<contomap::infrastructure::Link<contomap::model::Role>> link)
-         : link(std::move(link))
+      RoleEntry(Association &owner, contomap::model::Identifier roleId)
+         : owner(owner)
+         , roleId(roleId)
+         , link(contomap::infrastructure::LinkCallback::to<&RoleEntry::unlinked>(*this))
       {
       }
 
-      contomap::model::Role &role()
+      void linkWith(contomap::model::Role &role, contomap::infrastructure::Link<Association> &associationLink)
       {
-         return link->getLinked();
+         contomap::infrastructure::Links::between(associationLink, owner, link, role);
       }
 
    private:
-      std::unique_ptr<contomap::infrastructure::Link<contomap::model::Role>> link;
+      void unlinked()
+      {
+         // Erasing destroys this instance, so the key must not refer to it.
+         auto id = roleId;
+         owner.roles.erase(id);
+      }
+
+      Association &owner;
+      contomap::model::Identifier roleId;
+      contomap::infrastructure::Link<contomap::model::Role> link;
    };
 
    contomap::model::Identifier id;
-   contomap::model::Identifiers scope;
+   contomap::model::InternedScope scope;
 
    contomap::model::Coordinates location;
 
    contomap::model::OptionalIdentifier type;
    contomap::model::Style appearance;
 
-   std::map<contomap::model::Identifier, std::unique_ptr<RoleEntry>> roles;
+   std::map<contomap::model::Identifier, RoleEntry> roles;
 };
 
 }
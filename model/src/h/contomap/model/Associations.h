@@ -1,9 +1,7 @@
 #pragma once
 
-#include <memory>
-
 #include "contomap/model/Association.h"
-#include "contomap/model/Filter.h"
+#include "contomap/model/Filters.h"
 
 namespace contomap::model
 {
@@ -19,12 +17,12 @@ public:
    Associations() = delete;
 
    /**
-    * Factory function for creating a Filter for associations.
+    * Factory function for creating a filter expression for associations.
     *
     * @param scope the view scope to filter for.
-    * @return a Filter instance that matches all associations with a least one occurrence in given scope.
+    * @return an expression that matches all associations with a least one occurrence in given scope.
     */
-   static std::unique_ptr<contomap::model::Filter<contomap::model::Association>> thatAreIn(contomap::model::Identifiers const &scope);
+   [[nodiscard]] static contomap::model::filters::InScope<contomap::model::Association> thatAreIn(contomap::model::Identifiers const &scope);
 };
 
 }
@@ -2,10 +2,12 @@
 
 #include <map>
 
+#include "contomap/infrastructure/MemoryAccount.h"
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
 #include "contomap/model/Association.h"
 #include "contomap/model/ContomapView.h"
+#include "contomap/model/EntityPools.h"
 #include "contomap/model/Identifier.h"
 #include "contomap/model/Topic.h"
 
@@ -18,11 +20,74 @@ namespace contomap::model
 class Contomap : public contomap::model::ContomapView
 {
 public:
+   /**
+    * NameIndexDeferral defers the maintenance of the name index of a map while it exists.
+    * It is meant for creating many named topics at once. Name searches find these topics only after the deferral ended.
+    */
+   class NameIndexDeferral
+   {
+   public:
+      /**
+       * Constructor.
+       *
+       * @param map the map of which to defer the name index maintenance.
+       */
+      explicit NameIndexDeferral(Contomap &map);
+      /**
+       * Deleted copy constructor.
+       */
+      NameIndexDeferral(NameIndexDeferral const &) = delete;
+      /**
+       * Deleted move constructor.
+       */
+      NameIndexDeferral(NameIndexDeferral &&) = delete;
+      ~NameIndexDeferral();
+
+      /**
+       * Deleted copy assignment operator.
+       * @return this.
+       */
+      NameIndexDeferral &operator=(NameIndexDeferral const &) = delete;
+      /**
+       * Deleted move assignment operator.
+       * @return this.
+       */
+      NameIndexDeferral &operator=(NameIndexDeferral &&) = delete;
+
+   private:
+      contomap::model::TopicNameIndex &index;
+   };
+
    /**
     * @return a new map instance with a default view scope.
     */
    static Contomap newMap();
 
+   /**
+    * Move constructor.
+    *
+    * @param other the map to take over.
+    */
+   Contomap(Contomap &&other) noexcept = default;
+   /**
+    * Deleted copy constructor.
+    */
+   Contomap(Contomap const &) = delete;
+   ~Contomap() override;
+
+   /**
+    * Move assignment operator. The entities of this map are destroyed before the pools they are kept in.
+    *
+    * @param other the map to take over.
+    * @return this.
+    */
+   Contomap &operator=(Contomap &&other) noexcept;
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   Contomap &operator=(Contomap const &) = delete;
+
    [[nodiscard]] contomap::model::Identifier getDefaultScope() const override;
 
    /**
@@ -74,6 +139,76 @@ public:
    [[nodiscard]] contomap::infrastructure::Search<contomap::model::Topic const> find(
       std::shared_ptr<contomap::model::Filter<contomap::model::Topic>> filter) const override;
 
+   /**
+    * Find topics that match a filter expression, for potential modification.
+    *
+    * The expression is evaluated inline while iterating the topics.
+    * In case it requires a name search, only the topics found through the name index are tested.
+    *
+    * @tparam Expression the type of the expression.
+    * @param expression the expression to evaluate.
+    * @return a Search instance that can be iterated once.
+    */
+   template <contomap::model::filters::FilterExpressionFor<contomap::model::Topic> Expression>
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Topic> find(Expression expression) // NOLINT
+   {
+      if (auto candidates = topicsNamedLike(expression.nameSearch()); candidates.has_value())
+      {
+         for (auto id : *candidates)
+         {
+            auto it = topics.find(id);
+            if ((it != topics.end()) && expression.matches(*it->second, *this))
+            {
+               co_yield *it->second;
+            }
+         }
+      }
+      else
+      {
+         for (auto &it : topics)
+         {
+            if (expression.matches(*it.second, *this))
+            {
+               co_yield *it.second;
+            }
+         }
+      }
+   }
+
+   /**
+    * Find topics that match a filter expression.
+    *
+    * @tparam Expression the type of the expression.
+    * @param expression the expression to evaluate.
+    * @return a Search instance that can be iterated once.
+    * @see find(Expression)
+    */
+   template <contomap::model::filters::FilterExpressionFor<contomap::model::Topic> Expression>
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Topic const> find(Expression expression) const // NOLINT
+   {
+      if (auto candidates = topicsNamedLike(expression.nameSearch()); candidates.has_value())
+      {
+         for (auto id : *candidates)
+         {
+            auto it = topics.find(id);
+            if ((it != topics.end()) && expression.matches(*it->second, *this))
+            {
+               co_yield *it->second;
+            }
+         }
+      }
+      else
+      {
+         for (auto const &it : topics)
+         {
+            if (expression.matches(*it.second, *this))
+            {
+               co_yield *it.second;
+            }
+         }
+      }
+   }
+
    /**
     * Find a topic with a specific identifier, for potential modification.
     *
@@ -83,9 +218,33 @@ public:
    [[nodiscard]] std::optional<std::reference_wrapper<contomap::model::Topic>> findTopic(contomap::model::Identifier id);
    [[nodiscard]] std::optional<std::reference_wrapper<contomap::model::Topic const>> findTopic(contomap::model::Identifier id) const override;
 
+   [[nodiscard]] contomap::model::TopicNameIndex const &getTopicNameIndex() const override;
+   [[nodiscard]] contomap::model::CoordinateTable const &getOccurrenceLocations() const override;
+   [[nodiscard]] contomap::model::CoordinateTable const &getAssociationLocations() const override;
+   [[nodiscard]] contomap::model::ScopeTable const &getScopes() const override;
+
    [[nodiscard]] contomap::infrastructure::Search<contomap::model::Association const> find(
       std::shared_ptr<contomap::model::Filter<contomap::model::Association>> filter) const override;
 
+   /**
+    * Find associations that match a filter expression. The expression is evaluated inline while iterating the associations.
+    *
+    * @tparam Expression the type of the expression.
+    * @param expression the expression to evaluate.
+    * @return a Search instance that can be iterated once.
+    */
+   template <contomap::model::filters::FilterExpressionFor<contomap::model::Association> Expression>
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Association const> find(Expression expression) const // NOLINT
+   {
+      for (auto const &it : associations)
+      {
+         if (expression.matches(*it.second, *this))
+         {
+            co_yield *it.second;
+         }
+      }
+   }
+
    /**
     * Find a association with a specific identifier, for potential modification.
     *
@@ -136,8 +295,19 @@ private:
    bool topicShouldBeRemoved(Topic const &topic);
    void deleting(contomap::model::Identifiers &toDelete, contomap::model::Topic &topic);
 
-   std::map<contomap::model::Identifier, std::unique_ptr<contomap::model::Topic>> topics;
-   std::map<contomap::model::Identifier, std::unique_ptr<contomap::model::Association>> associations;
+   [[nodiscard]] contomap::infrastructure::SlabPool<contomap::model::Topic>::Pointer newTopicEntity(contomap::model::Identifier id);
+   void destroyEntities();
+
+   template <class T>
+   using EntityMap = std::map<contomap::model::Identifier, typename contomap::infrastructure::SlabPool<T>::Pointer, std::less<contomap::model::Identifier>,
+      contomap::infrastructure::AccountedAllocator<std::pair<contomap::model::Identifier const, typename contomap::infrastructure::SlabPool<T>::Pointer>,
+         contomap::model::EntityPools::MemoryTag>>;
+
+   // The index and the pools are held by pointer, as the entities refer to them while the map itself may be moved.
+   std::unique_ptr<contomap::model::TopicNameIndex> nameIndex;
+   std::unique_ptr<contomap::model::EntityPools> pools;
+   EntityMap<contomap::model::Topic> topics;
+   EntityMap<contomap::model::Association> associations;
    contomap::model::Identifier defaultScope;
 };
 
@@ -1,13 +1,19 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 #include "contomap/infrastructure/Generator.h"
 #include "contomap/model/Association.h"
+#include "contomap/model/CoordinateTable.h"
 #include "contomap/model/Filter.h"
 #include "contomap/model/Identifier.h"
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/Style.h"
 #include "contomap/model/Topic.h"
+#include "contomap/model/TopicNameIndex.h"
 
 namespace contomap::model
 {
@@ -38,6 +44,27 @@ public:
       std::shared_ptr<contomap::model::Filter<contomap::model::Topic>> filter) const = 0;
    // clang-format on
 
+   /**
+    * Find topics that match a filter expression.
+    *
+    * In case the expression requires a name search, only the topics found through the name index are tested.
+    * Otherwise, all topics are tested.
+    *
+    * @tparam Expression the type of the expression.
+    * @param expression the expression to evaluate.
+    * @return a Search instance that can be iterated once.
+    */
+   template <contomap::model::filters::FilterExpressionFor<contomap::model::Topic> Expression>
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Topic const> find(Expression expression) const
+   {
+      auto candidates = topicsNamedLike(expression.nameSearch());
+      if (!candidates.has_value())
+      {
+         return find(std::shared_ptr<Filter<Topic>>(Filter<Topic>::of(std::move(expression))));
+      }
+      return findAmong(std::move(*candidates), std::move(expression));
+   }
+
    /**
     * Find a topic with a specific identifier.
     *
@@ -46,6 +73,26 @@ public:
     */
    [[nodiscard]] virtual std::optional<std::reference_wrapper<Topic const>> findTopic(contomap::model::Identifier id) const = 0;
 
+   /**
+    * @return the full-text index over the names of all topics.
+    */
+   [[nodiscard]] virtual contomap::model::TopicNameIndex const &getTopicNameIndex() const = 0;
+
+   /**
+    * @return the locations of all occurrences, irrespective of scope.
+    */
+   [[nodiscard]] virtual contomap::model::CoordinateTable const &getOccurrenceLocations() const = 0;
+
+   /**
+    * @return the locations of all associations, irrespective of scope.
+    */
+   [[nodiscard]] virtual contomap::model::CoordinateTable const &getAssociationLocations() const = 0;
+
+   /**
+    * @return the distinct scopes of all items.
+    */
+   [[nodiscard]] virtual contomap::model::ScopeTable const &getScopes() const = 0;
+
    /**
     * Find associations that match a certain filter.
     *
@@ -59,6 +106,19 @@ public:
       std::shared_ptr<contomap::model::Filter<contomap::model::Association>> filter) const = 0;
    // clang-format on
 
+   /**
+    * Find associations that match a filter expression.
+    *
+    * @tparam Expression the type of the expression.
+    * @param expression the expression to evaluate.
+    * @return a Search instance that can be iterated once.
+    */
+   template <contomap::model::filters::FilterExpressionFor<contomap::model::Association> Expression>
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Association const> find(Expression expression) const
+   {
+      return find(std::shared_ptr<Filter<Association>>(Filter<Association>::of(std::move(expression))));
+   }
+
    /**
     * Find a association with a specific identifier.
     *
@@ -82,6 +142,29 @@ public:
     * @return a Search instance that can be iterated once.
     */
    [[nodiscard]] virtual contomap::infrastructure::Search<contomap::model::Role const> findRoles(contomap::model::Identifiers const &ids) const = 0;
+
+protected:
+   /**
+    * Determines the candidates for a name search from the name index.
+    *
+    * @param nameSearch the search value of a filter expression, if it has one.
+    * @return the identifiers of all topics with a matching name, in ascending order; nothing if there is no search.
+    */
+   [[nodiscard]] std::optional<std::vector<contomap::model::Identifier>> topicsNamedLike(std::optional<std::string_view> nameSearch) const;
+
+private:
+   template <class Expression>
+   contomap::infrastructure::Search<contomap::model::Topic const> findAmong(std::vector<contomap::model::Identifier> ids, Expression expression) const // NOLINT
+   {
+      for (auto id : ids)
+      {
+         auto topic = findTopic(id);
+         if (topic.has_value() && expression.matches(topic->get(), *this))
+         {
+            co_yield topic->get();
+         }
+      }
+   }
 };
 
 }
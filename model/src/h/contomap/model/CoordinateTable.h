@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "contomap/model/Identifier.h"
+#include "contomap/model/InternedScope.h"
+#include "contomap/model/ScopeTable.h"
+#include "contomap/model/SpacialCoordinate.h"
+
+namespace contomap::model
+{
+
+class Coordinates;
+
+/**
+ * CoordinateTable holds the spacial locations of many map elements next to each other, as a structure of arrays.
+ *
+ * Each row belongs to the Coordinates of one map element, and captures its absolute point, its scope, and its identifier.
+ * The scopes are the handles of the ScopeTable of the map, so that rows are filtered with the selections of that table.
+ * The rows are kept dense: Removing a row moves the last one into its place. Passes over all locations, such as determining
+ * the bounds, culling, or moving everything, therefore run through plain arrays, and process several rows at once where
+ * the platform supports it.
+ *
+ * Rows are added and updated only through Coordinates. Row numbers are valid until the next row is removed.
+ */
+class CoordinateTable
+{
+public:
+   /**
+    * Bounds describe an axis-aligned rectangle. Both minimum and maximum values are inclusive.
+    */
+   struct Bounds
+   {
+      /** The smallest X coordinate. */
+      contomap::model::SpacialCoordinate::CoordinateType minX;
+      /** The smallest Y coordinate. */
+      contomap::model::SpacialCoordinate::CoordinateType minY;
+      /** The largest X coordinate. */
+      contomap::model::SpacialCoordinate::CoordinateType maxX;
+      /** The largest Y coordinate. */
+      contomap::model::SpacialCoordinate::CoordinateType maxY;
+   };
+
+   /**
+    * Default constructor.
+    */
+   CoordinateTable() = default;
+   /**
+    * Deleted copy constructor.
+    */
+   CoordinateTable(CoordinateTable const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   CoordinateTable(CoordinateTable &&) = delete;
+   ~CoordinateTable() = default;
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   CoordinateTable &operator=(CoordinateTable const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   CoordinateTable &operator=(CoordinateTable &&) = delete;
+
+   /**
+    * @return the number of rows.
+    */
+   [[nodiscard]] size_t size() const noexcept;
+
+   /**
+    * @param row the row to look at.
+    * @return the absolute point of the given row.
+    */
+   [[nodiscard]] contomap::model::SpacialCoordinate::AbsolutePoint pointAt(size_t row) const;
+
+   /**
+    * @param row the row to look at.
+    * @return the identifier of the map element of the given row.
+    */
+   [[nodiscard]] contomap::model::Identifier idAt(size_t row) const;
+
+   /**
+    * @param row the row to look at.
+    * @return the scope of the map element of the given row.
+    */
+   [[nodiscard]] contomap::model::InternedScope const &scopeAt(size_t row) const;
+
+   /**
+    * @return the bounds of all points, or nothing if the table is empty.
+    */
+   [[nodiscard]] std::optional<Bounds> bounds() const;
+
+   /**
+    * Determines all rows with a point within given area.
+    *
+    * @param area the area to test.
+    * @param rows the list to append the matching rows to, in ascending order.
+    */
+   void collectWithin(Bounds const &area, std::vector<size_t> &rows) const;
+
+   /**
+    * Determines all rows that are valid in the view scope of a given selection.
+    *
+    * @param selection the selection to filter for.
+    * @param rows the list to append the matching rows to, in ascending order.
+    */
+   void collectIn(contomap::model::ScopeTable::Selection const &selection, std::vector<size_t> &rows) const;
+
+   /**
+    * Moves all points by given offset.
+    *
+    * @param offset the offset to apply.
+    */
+   void translateAll(contomap::model::SpacialCoordinate::Offset offset);
+
+private:
+   friend Coordinates;
+
+   [[nodiscard]] size_t add(Coordinates &owner, contomap::model::Identifier id, contomap::model::SpacialCoordinate::AbsolutePoint point,
+      contomap::model::InternedScope const &scope);
+   void remove(size_t row);
+   void setPoint(size_t row, contomap::model::SpacialCoordinate::AbsolutePoint point);
+   void setScope(size_t row, contomap::model::InternedScope const &scope);
+
+   std::vector<contomap::model::SpacialCoordinate::CoordinateType> xs;
+   std::vector<contomap::model::SpacialCoordinate::CoordinateType> ys;
+   std::vector<contomap::model::InternedScope> scopes;
+   std::vector<contomap::model::Identifier> ids;
+   std::vector<Coordinates *> owners;
+};
+
+}
@@ -2,13 +2,20 @@
 
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
+#include "contomap/model/Identifier.h"
+#include "contomap/model/InternedScope.h"
 #include "contomap/model/SpacialCoordinate.h"
 
 namespace contomap::model
 {
 
+class CoordinateTable;
+
 /**
  * Coordinate describes when and where a map element shall be shown.
+ *
+ * Once placed in a CoordinateTable, the values are kept in a row of the table, next to those of other map elements.
+ * Otherwise, they are kept with this instance. As the table refers back to the instance, it is neither copied nor moved.
  */
 class Coordinates
 {
@@ -23,6 +30,42 @@ public:
     * @param spacial the initial coordinates
     */
    explicit Coordinates(contomap::model::SpacialCoordinate spacial);
+   /**
+    * Deleted copy constructor.
+    */
+   Coordinates(Coordinates const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   Coordinates(Coordinates &&) = delete;
+   ~Coordinates();
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   Coordinates &operator=(Coordinates const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   Coordinates &operator=(Coordinates &&) = delete;
+
+   /**
+    * Moves the current values into a row of given table, which holds them from then on.
+    *
+    * @param coordinateTable the table to place the values in. May be nullptr to keep them with this instance.
+    * @param owner the identifier of the map element these coordinates belong to.
+    * @param scope the scope within which the map element is valid.
+    */
+   void placeIn(contomap::model::CoordinateTable *coordinateTable, contomap::model::Identifier owner, contomap::model::InternedScope const &scope);
+
+   /**
+    * Updates the scope of the map element in the table, if placed in one.
+    *
+    * @param scope the scope within which the map element is valid.
+    */
+   void setScope(contomap::model::InternedScope const &scope);
 
    /**
     * Serializes the coordinates.
@@ -58,6 +101,10 @@ public:
    void moveBy(contomap::model::SpacialCoordinate::Offset offset);
 
 private:
+   friend contomap::model::CoordinateTable;
+
+   contomap::model::CoordinateTable *table = nullptr;
+   size_t row = 0;
    contomap::model::SpacialCoordinate spacial;
 };
 
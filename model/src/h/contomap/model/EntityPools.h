@@ -0,0 +1,59 @@
+#pragma once
+
+#include "contomap/infrastructure/MemoryAccount.h"
+#include "contomap/infrastructure/SlabPool.h"
+#include "contomap/model/Association.h"
+#include "contomap/model/CoordinateTable.h"
+#include "contomap/model/Occurrence.h"
+#include "contomap/model/Role.h"
+#include "contomap/model/ScopeTable.h"
+#include "contomap/model/Topic.h"
+
+namespace contomap::model
+{
+
+/**
+ * EntityPools holds the memory of all entities of one map, with one pool per entity type.
+ *
+ * Entities of a map are placed next to each other, instead of being scattered across the heap.
+ * Once the entities are gone, all of their memory is released with the pools.
+ * The locations of occurrences and associations are further kept in tables, one for each type,
+ * and the scopes of all items are interned in one table.
+ * The slabs of the pools are charged to the memory account of the model.
+ */
+class EntityPools
+{
+public:
+   /**
+    * MemoryTag identifies the memory account of the model.
+    */
+   struct MemoryTag
+   {
+      /** The name of the account. */
+      static char const *const NAME;
+   };
+
+   /**
+    * Default constructor.
+    */
+   EntityPools();
+
+   /** The pool for all topics. */
+   contomap::infrastructure::SlabPool<contomap::model::Topic> topics;
+   /** The pool for all associations. */
+   contomap::infrastructure::SlabPool<contomap::model::Association> associations;
+   /** The pool for all occurrences. */
+   contomap::infrastructure::SlabPool<contomap::model::Occurrence> occurrences;
+   /** The pool for all roles. */
+   contomap::infrastructure::SlabPool<contomap::model::Role> roles;
+
+   /** The locations of all occurrences. */
+   contomap::model::CoordinateTable occurrenceLocations;
+   /** The locations of all associations. */
+   contomap::model::CoordinateTable associationLocations;
+
+   /** The distinct scopes of all items. */
+   contomap::model::ScopeTable scopes;
+};
+
+}
@@ -3,6 +3,7 @@
 #include <functional>
 #include <memory>
 
+#include "contomap/model/Filters.h"
 #include "contomap/model/Topic.h"
 
 namespace contomap::model
@@ -12,6 +13,8 @@ class ContomapView;
 
 /**
  * Filter is used to query things with specific properties.
+ *
+ * Filter is the type-erased counterpart of the filter expressions, for predicates that are only known at runtime.
  */
 template <class FilteredType> class Filter
 {
@@ -33,6 +36,19 @@ public:
       return std::make_unique<FunctionFilter<FilteredType>>(std::move(fn));
    }
 
+   /**
+    * Factory function for creating a Filter that is based on a filter expression.
+    * Use this variant in case an expression needs to be passed where only a Filter is accepted.
+    *
+    * @param expression the expression to evaluate for each item.
+    * @return a Filter based on provided expression.
+    */
+   template <contomap::model::filters::FilterExpressionFor<FilteredType> Expression>
+   [[nodiscard]] static std::unique_ptr<Filter<FilteredType>> of(Expression expression)
+   {
+      return std::make_unique<ExpressionFilter<FilteredType, Expression>>(std::move(expression));
+   }
+
    /**
     * Test whether a specific instance is passing the filter.
     *
@@ -64,6 +80,28 @@ private:
    private:
       Filter<Type>::Function fn;
    };
+
+   template <class Type, class Expression> class ExpressionFilter : public Filter<Type>
+   {
+   public:
+      /**
+       * Constructor.
+       *
+       * @param expression the expression to wrap.
+       */
+      explicit ExpressionFilter(Expression expression)
+         : expression(std::move(expression))
+      {
+      }
+
+      [[nodiscard]] bool matches(Type const &instance, contomap::model::ContomapView const &view) const override
+      {
+         return expression.matches(instance, view);
+      }
+
+   private:
+      Expression expression;
+   };
 };
 
 }
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "contomap/model/Identifiers.h"
+#include "contomap/model/ScopeTable.h"
+
+namespace contomap::model
+{
+
+class Association;
+class ContomapView;
+class Topic;
+
+}
+
+namespace contomap::model::filters
+{
+
+/**
+ * A FilterExpression is a predicate on items of its FilteredType that is known at compile time.
+ *
+ * Contrary to the virtual Filter, expressions are values: They are composed with the operators
+ * <code>&&</code>, <code>||</code>, and <code>!</code>, and evaluating them is inlined into the loop that iterates the items.
+ * Expressions can further be inspected, so that a query can use an index instead of testing every item.
+ *
+ * @tparam Expression the type to verify.
+ */
+template <class Expression>
+concept FilterExpression = requires(Expression const &expression, typename Expression::FilteredType const &item, contomap::model::ContomapView const &view) {
+   {
+      expression.matches(item, view)
+   } -> std::convertible_to<bool>;
+   {
+      expression.nameSearch()
+   } -> std::same_as<std::optional<std::string_view>>;
+};
+
+/**
+ * Verifies whether a FilterExpression applies to a given type of items.
+ *
+ * @tparam Expression the type to verify.
+ * @tparam Item the type of the items that the expression shall test.
+ */
+template <class Expression, class Item>
+concept FilterExpressionFor = FilterExpression<Expression> && std::same_as<typename Expression::FilteredType, Item>;
+
+/**
+ * ScopeSelector provides the selection of one fixed scope among the scopes of a view.
+ * The selection is requested once, on first use, and kept for all further tests against the same view.
+ *
+ * An expression may be evaluated from several threads at once. The selection is therefore published atomically,
+ * and tests against the published view only read it. Selections for other views are kept until the selector is destroyed,
+ * as other threads may still refer to them.
+ */
+class ScopeSelector
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param scope the scope to select for.
+    */
+   explicit ScopeSelector(contomap::model::Identifiers scope);
+
+   /**
+    * Copy constructor. Only the scope is copied, the copy selects on its own.
+    *
+    * @param other the selector to copy from.
+    */
+   ScopeSelector(ScopeSelector const &other);
+   /**
+    * Move constructor. Only the scope is taken over, the instance selects on its own.
+    *
+    * @param other the selector to move from.
+    */
+   ScopeSelector(ScopeSelector &&other) noexcept;
+   ~ScopeSelector() = default;
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   ScopeSelector &operator=(ScopeSelector const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   ScopeSelector &operator=(ScopeSelector &&) = delete;
+
+   /**
+    * @param view the view to select the scopes in.
+    * @return the selection of all scopes of the view that are within the scope of this selector.
+    */
+   [[nodiscard]] contomap::model::ScopeTable::Selection const &within(contomap::model::ContomapView const &view) const;
+
+private:
+   struct Selected
+   {
+      contomap::model::ScopeTable const *table;
+      std::shared_ptr<contomap::model::ScopeTable::Selection const> selection;
+   };
+
+   contomap::model::Identifiers scope;
+   mutable std::atomic<Selected const *> current = nullptr;
+   mutable std::mutex selectingMutex;
+   mutable std::vector<std::unique_ptr<Selected const>> selections;
+};
+
+/**
+ * InScope matches items that are valid in a given scope.
+ *
+ * @tparam Item either Topic or Association.
+ */
+template <class Item> class InScope
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = Item;
+
+   /**
+    * Constructor.
+    *
+    * @param scope the scope to filter for.
+    */
+   explicit InScope(contomap::model::Identifiers scope)
+      : selector(std::move(scope))
+   {
+   }
+
+   /**
+    * @param item the item to test.
+    * @param view the view the item is part of.
+    * @return true if the item is in the scope.
+    */
+   [[nodiscard]] bool matches(Item const &item, contomap::model::ContomapView const &view) const
+   {
+      return item.isIn(selector.within(view));
+   }
+
+   /**
+    * @return nothing, as scopes are not indexed.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const
+   {
+      return {};
+   }
+
+private:
+   ScopeSelector selector;
+};
+
+/**
+ * OccursAs matches topics that have at least one of the given occurrences.
+ */
+class OccursAs
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = contomap::model::Topic;
+
+   /**
+    * Constructor.
+    *
+    * @param occurrences the identifiers of the occurrences to look for.
+    */
+   explicit OccursAs(contomap::model::Identifiers occurrences);
+
+   /**
+    * @param topic the topic to test.
+    * @return true if the topic has one of the occurrences.
+    */
+   [[nodiscard]] bool matches(contomap::model::Topic const &topic, contomap::model::ContomapView const &) const;
+
+   /**
+    * @return nothing, as occurrences are not indexed.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const;
+
+private:
+   contomap::model::Identifiers occurrences;
+};
+
+/**
+ * NameLike matches topics with a name that contains a search value, ignoring case.
+ * Case is folded as in TopicNameIndex, so that a full scan matches the same topics as an index lookup.
+ * An empty search value matches topics without any name.
+ */
+class NameLike
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = contomap::model::Topic;
+
+   /**
+    * Constructor.
+    *
+    * @param searchValue the content to look for.
+    */
+   explicit NameLike(std::string searchValue);
+
+   /**
+    * @param topic the topic to test.
+    * @return true if one of the names of the topic contains the search value.
+    */
+   [[nodiscard]] bool matches(contomap::model::Topic const &topic, contomap::model::ContomapView const &) const;
+
+   /**
+    * @return the search value, which can be looked up in the topic name index.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const;
+
+private:
+   [[nodiscard]] bool contains(std::string const &value) const;
+
+   std::string searchValue;
+   std::string foldedSearchValue;
+};
+
+/**
+ * And matches items that match both of its operands. The right operand is only evaluated if the left one matched.
+ *
+ * @tparam Left the type of the left operand.
+ * @tparam Right the type of the right operand.
+ */
+template <FilterExpression Left, FilterExpressionFor<typename Left::FilteredType> Right> class And
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = typename Left::FilteredType;
+
+   /**
+    * Constructor.
+    *
+    * @param left the left operand.
+    * @param right the right operand.
+    */
+   And(Left left, Right right)
+      : left(std::move(left))
+      , right(std::move(right))
+   {
+   }
+
+   /**
+    * @param item the item to test.
+    * @param view the view within to verify indirect properties.
+    * @return true if both operands match.
+    */
+   [[nodiscard]] bool matches(FilteredType const &item, contomap::model::ContomapView const &view) const
+   {
+      return left.matches(item, view) && right.matches(item, view);
+   }
+
+   /**
+    * @return the name search of either operand, as each one restricts the result.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const
+   {
+      auto leftSearch = left.nameSearch();
+      return leftSearch.has_value() ? leftSearch : right.nameSearch();
+   }
+
+private:
+   Left left;
+   Right right;
+};
+
+/**
+ * Or matches items that match at least one of its operands. The right operand is only evaluated if the left one did not match.
+ *
+ * @tparam Left the type of the left operand.
+ * @tparam Right the type of the right operand.
+ */
+template <FilterExpression Left, FilterExpressionFor<typename Left::FilteredType> Right> class Or
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = typename Left::FilteredType;
+
+   /**
+    * Constructor.
+    *
+    * @param left the left operand.
+    * @param right the right operand.
+    */
+   Or(Left left, Right right)
+      : left(std::move(left))
+      , right(std::move(right))
+   {
+   }
+
+   /**
+    * @param item the item to test.
+    * @param view the view within to verify indirect properties.
+    * @return true if either operand matches.
+    */
+   [[nodiscard]] bool matches(FilteredType const &item, contomap::model::ContomapView const &view) const
+   {
+      return left.matches(item, view) || right.matches(item, view);
+   }
+
+   /**
+    * @return nothing, as either operand may match items outside of the other's index lookup.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const
+   {
+      return {};
+   }
+
+private:
+   Left left;
+   Right right;
+};
+
+/**
+ * Not matches items that its operand does not match.
+ *
+ * @tparam Operand the type of the negated expression.
+ */
+template <FilterExpression Operand> class Not
+{
+public:
+   /** The type of items this expression tests. */
+   using FilteredType = typename Operand::FilteredType;
+
+   /**
+    * Constructor.
+    *
+    * @param operand the expression to negate.
+    */
+   explicit Not(Operand operand)
+      : operand(std::move(operand))
+   {
+   }
+
+   /**
+    * @param item the item to test.
+    * @param view the view within to verify indirect properties.
+    * @return true if the operand does not match.
+    */
+   [[nodiscard]] bool matches(FilteredType const &item, contomap::model::ContomapView const &view) const
+   {
+      return !operand.matches(item, view);
+   }
+
+   /**
+    * @return nothing, as a negation can not be looked up.
+    */
+   [[nodiscard]] std::optional<std::string_view> nameSearch() const
+   {
+      return {};
+   }
+
+private:
+   Operand operand;
+};
+
+/**
+ * Combines two expressions to match only if both match.
+ *
+ * @param left the left operand.
+ * @param right the right operand.
+ * @return the combined expression.
+ */
+template <FilterExpression Left, FilterExpressionFor<typename Left::FilteredType> Right> [[nodiscard]] And<Left, Right> operator&&(Left left, Right right)
+{
+   return And<Left, Right>(std::move(left), std::move(right));
+}
+
+/**
+ * Combines two expressions to match if either matches.
+ *
+ * @param left the left operand.
+ * @param right the right operand.
+ * @return the combined expression.
+ */
+template <FilterExpression Left, FilterExpressionFor<typename Left::FilteredType> Right> [[nodiscard]] Or<Left, Right> operator||(Left left, Right right)
+{
+   return Or<Left, Right>(std::move(left), std::move(right));
+}
+
+/**
+ * Negates an expression.
+ *
+ * @param operand the expression to negate.
+ * @return the negated expression.
+ */
+template <FilterExpression Operand> [[nodiscard]] Not<Operand> operator!(Operand operand)
+{
+   return Not<Operand>(std::move(operand));
+}
+
+}
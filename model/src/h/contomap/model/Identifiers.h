@@ -35,6 +35,11 @@ public:
     */
    std::strong_ordering operator<=>(Identifiers const &other) const noexcept = default;
 
+   /**
+    * @return a hash value of this collection, which is equal for equal collections.
+    */
+   [[nodiscard]] size_t hash() const noexcept;
+
    /**
     * @return start operator for iteration.
     */
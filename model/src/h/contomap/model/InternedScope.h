@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "contomap/model/Identifier.h"
+#include "contomap/model/Identifiers.h"
+
+namespace contomap::model
+{
+
+class ScopeTable;
+
+/**
+ * An InternedScope is a handle to a scope that is shared by all items with the same scope.
+ *
+ * Handles are created by a ScopeTable, which numbers each distinct scope, or as detached handles for items
+ * that do not belong to a map. The default instance represents the empty scope.
+ */
+class InternedScope
+{
+public:
+   /**
+    * Default constructor, for the empty scope.
+    */
+   InternedScope() = default;
+
+   /**
+    * Creates a handle that is not part of any table.
+    *
+    * @param identifiers the identifiers of the scope.
+    * @return a new instance.
+    */
+   [[nodiscard]] static InternedScope detached(contomap::model::Identifiers identifiers);
+
+   /**
+    * @return the identifiers of the scope.
+    */
+   [[nodiscard]] contomap::model::Identifiers const &identifiers() const noexcept;
+
+   /**
+    * @return the hash value of the identifiers.
+    */
+   [[nodiscard]] size_t hash() const noexcept;
+
+   /**
+    * @return the number of identifiers in the scope.
+    */
+   [[nodiscard]] size_t size() const noexcept;
+
+   /**
+    * @return true if the scope has no identifiers.
+    */
+   [[nodiscard]] bool empty() const noexcept;
+
+   /**
+    * @param id the identifier to look for.
+    * @return true if the scope contains the given identifier.
+    */
+   [[nodiscard]] bool contains(contomap::model::Identifier id) const;
+
+   /**
+    * @param viewScope the scope to test against.
+    * @return true if all identifiers of this scope are part of the given view scope.
+    */
+   [[nodiscard]] bool isIn(contomap::model::Identifiers const &viewScope) const;
+
+   /**
+    * @param other the other scope to compare against.
+    * @return true if this scope has more identifiers than the other. For the same size, the smaller identifiers are narrower.
+    */
+   [[nodiscard]] bool isNarrowerThan(InternedScope const &other) const;
+
+   /**
+    * Two scopes of the same table are equal only if they share their entry.
+    *
+    * @param other the other scope to compare against.
+    * @return true if both scopes have the same identifiers.
+    */
+   [[nodiscard]] bool operator==(InternedScope const &other) const;
+
+private:
+   friend ScopeTable;
+
+   static uint32_t constexpr DETACHED_KEY = UINT32_MAX;
+
+   struct Entry
+   {
+      contomap::model::Identifiers identifiers;
+      size_t hash;
+      ScopeTable const *table;
+      uint32_t key;
+      uint64_t revision;
+   };
+
+   explicit InternedScope(std::shared_ptr<Entry const> entry);
+
+   std::shared_ptr<Entry const> entry;
+};
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "contomap/model/Association.h"
+#include "contomap/model/Contomap.h"
+#include "contomap/model/Topic.h"
+
+namespace contomap::model
+{
+
+/**
+ * MapImporter creates topics and associations of a map in bulk, from rows of a text input.
+ *
+ * The input is read as a stream, one row at a time. Only the keys of the created items are kept,
+ * so that later rows can refer to them. Each row has a "kind" field, and further fields depending on it:
+ * - "topic": a topic with "key", an optional default "name", and an occurrence at "x" and "y".
+ * - "occurrence": a further occurrence of the topic with key "topic", at "x" and "y".
+ * - "association": an association with "key", at "x" and "y".
+ * - "role": a role between the topic with key "topic" and the association with key "association".
+ *
+ * Occurrences and associations are created in the default scope of the map. Roles may refer to items of later rows;
+ * such roles are kept until finish() resolves them. For bounded memory, items should come before the roles that refer to them.
+ *
+ * Malformed input is reported with a std::runtime_error, naming the line. Items of previous rows remain in the map.
+ */
+class MapImporter
+{
+public:
+   /**
+    * Format describes the encoding of the rows.
+    */
+   enum class Format
+   {
+      /** Comma separated values, with quotes as per RFC 4180. The first row names the fields. */
+      Csv,
+      /** One JSON object per line, with the fields as its members. Members must be strings or numbers. */
+      JsonLines,
+   };
+
+   /**
+    * Statistics counts the processed rows and created items.
+    */
+   struct Statistics
+   {
+      /** The number of processed rows, without the header. */
+      size_t rows = 0;
+      /** The number of created topics. */
+      size_t topics = 0;
+      /** The number of created occurrences. */
+      size_t occurrences = 0;
+      /** The number of created associations. */
+      size_t associations = 0;
+      /** The number of created roles. */
+      size_t roles = 0;
+   };
+
+   /**
+    * Constructor.
+    *
+    * @param map the map to create the items in.
+    */
+   explicit MapImporter(contomap::model::Contomap &map);
+
+   /**
+    * Reads all rows of given input and creates the respective items.
+    *
+    * @param input the stream to read from.
+    * @param format the encoding of the rows.
+    */
+   void read(std::istream &input, Format format);
+
+   /**
+    * Resolves the roles that referred to items of later rows. This is called once, after all input was read.
+    */
+   void finish();
+
+   /**
+    * @return the counts of what was imported so far.
+    */
+   [[nodiscard]] Statistics const &getStatistics() const;
+
+private:
+   class Row;
+
+   struct PendingRole
+   {
+      size_t lineNumber;
+      std::string topicKey;
+      std::string associationKey;
+   };
+
+   void readCsv(std::istream &input);
+   void readJsonLines(std::istream &input);
+   void add(Row const &row);
+   void addTopic(Row const &row);
+   void addOccurrence(Row const &row);
+   void addAssociation(Row const &row);
+   void addRole(Row const &row);
+   void link(contomap::model::Topic &topic, contomap::model::Association &association);
+
+   [[nodiscard]] contomap::model::Topic &topicFor(Row const &row, std::string_view key);
+
+   contomap::model::Contomap &map;
+   contomap::model::Identifiers scope;
+   std::unordered_map<std::string, std::reference_wrapper<contomap::model::Topic>> topicsByKey;
+   std::unordered_map<std::string, std::reference_wrapper<contomap::model::Association>> associationsByKey;
+   std::vector<PendingRole> pendingRoles;
+   Statistics statistics;
+};
+
+}
@@ -2,13 +2,17 @@
 
 #include <memory>
 
+#include "contomap/infrastructure/SlabPool.h"
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
+#include "contomap/model/CoordinateTable.h"
 #include "contomap/model/Coordinates.h"
 #include "contomap/model/Identifier.h"
 #include "contomap/model/Identifiers.h"
+#include "contomap/model/InternedScope.h"
 #include "contomap/model/OptionalIdentifier.h"
 #include "contomap/model/Reifiable.h"
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/Style.h"
 
 namespace contomap::model
@@ -29,8 +33,10 @@ public:
     * @param topic the reference to the topic this occurrence represents.
     * @param scope the scope within which this occurrence is valid.
     * @param spacial the known, initial point where the occurrence is happening.
+    * @param coordinateTable the table to keep the location in. May be nullptr to keep it with the instance.
     */
-   Occurrence(contomap::model::Identifier id, contomap::model::Topic &topic, contomap::model::Identifiers scope, contomap::model::SpacialCoordinate spacial);
+   Occurrence(contomap::model::Identifier id, contomap::model::Topic &topic, contomap::model::InternedScope scope, contomap::model::SpacialCoordinate spacial,
+      contomap::model::CoordinateTable *coordinateTable);
 
    /**
     * Deserializes the occurrence.
@@ -40,10 +46,14 @@ public:
     * @param id the primary identifier of this occurrence.
     * @param topic the topic this occurrence represents.
     * @param topicResolver the function to use for resolving topic references.
+    * @param pool the pool to create the instance in. May be nullptr to allocate it from the heap.
+    * @param coordinateTable the table to keep the location in. May be nullptr to keep it with the instance.
+    * @param scopeTable the table to intern the scope in. May be nullptr to keep it detached.
     * @return the decoded instance.
     */
-   [[nodiscard]] static std::unique_ptr<Occurrence> from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id,
-      Topic &topic, std::function<Topic &(contomap::model::Identifier)> const &topicResolver);
+   [[nodiscard]] static contomap::infrastructure::SlabPool<Occurrence>::Pointer from(contomap::infrastructure::serial::Decoder &coder, uint8_t version,
+      contomap::model::Identifier id, Topic &topic, std::function<Topic &(contomap::model::Identifier)> const &topicResolver,
+      contomap::infrastructure::SlabPool<Occurrence> *pool, contomap::model::CoordinateTable *coordinateTable, contomap::model::ScopeTable *scopeTable);
 
    /**
     * Serializes the occurrence.
@@ -80,6 +90,14 @@ public:
     */
    [[nodiscard]] bool isIn(contomap::model::Identifiers const &thatScope) const;
 
+   /**
+    * Return true if this instance is in the view scope of given selection.
+    *
+    * @param selection the selection of scopes to look up.
+    * @return true if the occurrence is in the selected view scope.
+    */
+   [[nodiscard]] bool isIn(contomap::model::ScopeTable::Selection const &selection) const;
+
    /**
     * Return true if the scope contains the given identifier.
     *
@@ -137,11 +155,13 @@ public:
    void moveBy(contomap::model::SpacialCoordinate::Offset offset);
 
 private:
-   Occurrence(contomap::model::Identifier id, contomap::model::Topic &topic);
+   friend contomap::infrastructure::SlabPool<Occurrence>;
+
+   Occurrence(contomap::model::Identifier id, contomap::model::Topic &topic, contomap::model::CoordinateTable *coordinateTable);
 
    contomap::model::Identifier id;
    contomap::model::Topic &topic;
-   contomap::model::Identifiers scope;
+   contomap::model::InternedScope scope;
 
    contomap::model::Coordinates location;
 
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "contomap/infrastructure/Link.h"
+#include "contomap/infrastructure/SlabPool.h"
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
 #include "contomap/model/Identifier.h"
@@ -41,11 +42,12 @@ public:
     * @param id the unique identifier of the role.
     * @param topicResolver the function to use for resolving topic references.
     * @param associationResolver the function to use for resolving association references.
+    * @param pool the pool to create the role in. May be nullptr to allocate it from the heap.
     * @return the decoded role.
     */
-   [[nodiscard]] static std::unique_ptr<Role> from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id,
-      std::function<Topic &(contomap::model::Identifier)> const &topicResolver,
-      std::function<Association &(contomap::model::Identifier)> const &associationResolver);
+   [[nodiscard]] static contomap::infrastructure::SlabPool<Role>::Pointer from(contomap::infrastructure::serial::Decoder &coder, uint8_t version,
+      contomap::model::Identifier id, std::function<Topic &(contomap::model::Identifier)> const &topicResolver,
+      std::function<Association &(contomap::model::Identifier)> const &associationResolver, contomap::infrastructure::SlabPool<Role> *pool);
 
    /**
     * Serializes the role.
@@ -98,8 +100,8 @@ private:
    contomap::model::OptionalIdentifier type;
    contomap::model::Style appearance;
 
-   std::unique_ptr<contomap::infrastructure::Link<contomap::model::Topic>> topic;
-   std::unique_ptr<contomap::infrastructure::Link<contomap::model::Association>> association;
+   contomap::infrastructure::Link<contomap::model::Topic> topic;
+   contomap::infrastructure::Link<contomap::model::Association> association;
 };
 
 }
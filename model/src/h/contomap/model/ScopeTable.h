@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "contomap/model/Identifiers.h"
+#include "contomap/model/InternedScope.h"
+
+namespace contomap::model
+{
+
+/**
+ * ScopeTable interns the distinct scopes of the items of one map.
+ *
+ * A map typically has few distinct scopes, shared by many items. Each scope is numbered once, and
+ * a Selection then captures for all numbered scopes whether they are within a particular view scope.
+ * Testing an item against a selection is an array lookup instead of a comparison of identifier sets.
+ *
+ * A scope is released once no handle refers to it anymore, and its number is then reused for later scopes.
+ * Selections are cached for the most recently requested view scopes, and are renewed once further scopes were added.
+ * Interning scopes and requesting selections is safe from several threads at once.
+ */
+class ScopeTable
+{
+public:
+   /**
+    * A Selection describes which scopes of a table are within one view scope.
+    */
+   class Selection
+   {
+   public:
+      /**
+       * @param scope the scope to test.
+       * @return true if the given scope is within the view scope of this selection.
+       */
+      [[nodiscard]] bool contains(contomap::model::InternedScope const &scope) const;
+
+      /**
+       * @return the view scope this selection was made for.
+       */
+      [[nodiscard]] contomap::model::Identifiers const &getViewScope() const noexcept;
+
+   private:
+      friend ScopeTable;
+
+      Selection(ScopeTable const *table, contomap::model::Identifiers viewScope, uint64_t revision);
+
+      ScopeTable const *table;
+      contomap::model::Identifiers viewScope;
+      uint64_t revision;
+      std::vector<bool> within;
+   };
+
+   /**
+    * Default constructor.
+    */
+   ScopeTable() = default;
+   /**
+    * Deleted copy constructor.
+    */
+   ScopeTable(ScopeTable const &) = delete;
+   /**
+    * Deleted move constructor.
+    */
+   ScopeTable(ScopeTable &&) = delete;
+   ~ScopeTable() = default;
+
+   /**
+    * Deleted copy assignment operator.
+    * @return this.
+    */
+   ScopeTable &operator=(ScopeTable const &) = delete;
+   /**
+    * Deleted move assignment operator.
+    * @return this.
+    */
+   ScopeTable &operator=(ScopeTable &&) = delete;
+
+   /**
+    * Interns given scope in the provided table, or creates a detached scope if there is no table.
+    *
+    * @param table the table to use. May be nullptr.
+    * @param scope the identifiers of the scope.
+    * @return the handle to the scope.
+    */
+   [[nodiscard]] static contomap::model::InternedScope intern(ScopeTable *table, contomap::model::Identifiers scope);
+
+   /**
+    * @param scope the identifiers of the scope.
+    * @return the handle to the scope, shared with all previous requests for the same identifiers.
+    */
+   [[nodiscard]] contomap::model::InternedScope intern(contomap::model::Identifiers scope);
+
+   /**
+    * @return the number of distinct, non-empty scopes that are still referred to.
+    */
+   [[nodiscard]] size_t size() const;
+
+   /**
+    * @param viewScope the view scope to select for.
+    * @return the selection of all scopes within given view scope.
+    */
+   [[nodiscard]] std::shared_ptr<Selection const> selectWithin(contomap::model::Identifiers const &viewScope) const;
+
+private:
+   static size_t constexpr CACHED_SELECTIONS_LIMIT = 4;
+   static size_t constexpr MINIMUM_SWEEP_SIZE = 64;
+
+   [[nodiscard]] std::shared_ptr<contomap::model::InternedScope::Entry const> createEntry(uint32_t key, contomap::model::Identifiers scope);
+   void sweepReleased();
+
+   mutable std::mutex lock;
+   std::vector<std::weak_ptr<contomap::model::InternedScope::Entry const>> entries;
+   std::map<contomap::model::Identifiers, uint32_t> keysByScope;
+   std::vector<uint32_t> releasedKeys;
+   size_t nextSweepSize = MINIMUM_SWEEP_SIZE;
+   uint64_t revision = 0;
+   mutable std::vector<std::shared_ptr<Selection const>> cachedSelections;
+};
+
+}
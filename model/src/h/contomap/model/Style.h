@@ -1,7 +1,7 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <map>
 #include <vector>
 
 #include "contomap/infrastructure/serial/Decoder.h"
@@ -12,6 +12,9 @@ namespace contomap::model
 
 /**
  * A Style contains information on how to present things.
+ *
+ * A style is a small value of fixed size: one slot per color type, and a mask of which slots are set.
+ * Unset slots are kept at DEFAULT_COLOR, so that styles can be copied and compared without any indirection.
  */
 class Style
 {
@@ -66,6 +69,12 @@ public:
        * @param name the name for the scope.
        */
       void encode(contomap::infrastructure::serial::Encoder &coder, std::string const &name) const;
+
+      /**
+       * @param other the color to compare against.
+       * @return true if all channels are equal.
+       */
+      [[nodiscard]] bool operator==(Color const &other) const noexcept = default;
    };
 
    /** The default value returned if not specified. */
@@ -135,11 +144,22 @@ public:
     */
    [[nodiscard]] Color get(ColorType type, Color defaultValue = DEFAULT_COLOR) const;
 
+   /**
+    * @param other the style to compare against.
+    * @return true if both styles have the same colors set, with the same values.
+    */
+   [[nodiscard]] bool operator==(Style const &other) const noexcept = default;
+
 private:
+   static size_t constexpr COLOR_TYPE_COUNT = 3;
+
    [[nodiscard]] static ColorType typeFromSerial(uint8_t value);
    [[nodiscard]] static uint8_t typeToSerial(ColorType type);
+   [[nodiscard]] static size_t indexOf(ColorType type) noexcept;
+   [[nodiscard]] static uint8_t bitOf(ColorType type) noexcept;
 
-   std::map<ColorType, Color> colors;
+   std::array<Color, COLOR_TYPE_COUNT> colors {};
+   uint8_t presence = 0x00;
 };
 
 }
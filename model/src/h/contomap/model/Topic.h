@@ -4,7 +4,9 @@
 #include <memory>
 
 #include "contomap/infrastructure/Generator.h"
+#include "contomap/infrastructure/InlineMap.h"
 #include "contomap/infrastructure/Link.h"
+#include "contomap/infrastructure/SlabPool.h"
 #include "contomap/infrastructure/serial/Encoder.h"
 #include "contomap/model/Association.h"
 #include "contomap/model/Identifier.h"
@@ -13,10 +15,13 @@
 #include "contomap/model/Reifier.h"
 #include "contomap/model/Role.h"
 #include "contomap/model/TopicName.h"
+#include "contomap/model/TopicNameIndex.h"
 
 namespace contomap::model
 {
 
+class EntityPools;
+
 /**
  * A Topic captures the information about a particular subject.
  */
@@ -29,6 +34,16 @@ public:
     * @param id the primary identifier of this name.
     */
    explicit Topic(contomap::model::Identifier id);
+
+   /**
+    * Constructor for a topic of a map, which keeps its names in given index and its related items in given pools.
+    * Index and pools must outlive the topic, and the owner of the topic is responsible to remove the topic from the index.
+    *
+    * @param id the primary identifier of this name.
+    * @param nameIndex the index to maintain with the names of this topic.
+    * @param pools the pools to create occurrences and roles in.
+    */
+   Topic(contomap::model::Identifier id, contomap::model::TopicNameIndex &nameIndex, contomap::model::EntityPools &pools);
    ~Topic() override;
 
    Topic &refine() override;
@@ -58,7 +73,7 @@ public:
     *
     * @param scope the scope within which the name is valid.
     * @param value the value of the name to add.
-    * @return the created instance.
+    * @return the created instance, which is valid until the names of the topic change.
     */
    [[nodiscard]] contomap::model::TopicName &newName(contomap::model::Identifiers scope, contomap::model::TopicNameValue const &value);
 
@@ -91,10 +106,9 @@ public:
     * Establishes a link with given role.
     *
     * @param role the role instance to link with.
-    * @param topicUnlinked the function to pass on to the returned link.
-    * @return the link that refers to this instance.
+    * @param topicLink the link of the role that shall refer to this instance.
     */
-   [[nodiscard]] std::unique_ptr<contomap::infrastructure::Link<Topic>> link(contomap::model::Role &role, std::function<void()> topicUnlinked);
+   void link(contomap::model::Role &role, contomap::infrastructure::Link<Topic> &topicLink);
 
    /**
     * Remove all the roles for given association.
@@ -138,6 +152,14 @@ public:
     */
    [[nodiscard]] bool isIn(contomap::model::Identifiers const &scope) const;
 
+   /**
+    * Return true if this instance has at least one occurrence that is in the view scope of given selection.
+    *
+    * @param selection the selection of scopes to look up.
+    * @return true if the topic is in the selected view scope.
+    */
+   [[nodiscard]] bool isIn(contomap::model::ScopeTable::Selection const &selection) const;
+
    /**
     * Return true if this instance has at least one occurrence that is in given list.
     *
@@ -159,6 +181,21 @@ public:
     */
    [[nodiscard]] contomap::infrastructure::Search<contomap::model::Occurrence const> occurrencesIn(contomap::model::Identifiers scope) const;
 
+   /**
+    * Return a Search for all occurrences that are in the view scope of given selection.
+    * The selection must remain valid while the search is used.
+    *
+    * @param selection the selection of scopes to look up.
+    * @return a Search matching the selected view scope.
+    */
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Occurrence const> occurrencesIn(
+      contomap::model::ScopeTable::Selection const &selection) const;
+
+   /**
+    * @return a Search for all occurrences of the topic.
+    */
+   [[nodiscard]] contomap::infrastructure::Search<contomap::model::Occurrence const> allOccurrences() const;
+
    /**
     * Tries to find an occurrence that ideally is closest to the provided scope.
     *
@@ -245,33 +282,71 @@ private:
    class RoleEntry
    {
    public:
-      RoleEntry(std::unique_ptr<contomap::infrastructure::Link<contomap::model::Role>> link)
-         : link(std::move(link))
+      RoleEntry(Topic &owner, contomap::model::Identifier roleId)
+         : owner(owner)
+         , roleId(roleId)
+         , link(contomap::infrastructure::LinkCallback::to<&RoleEntry::unlinked>(*this))
+      {
+      }
+
+      RoleEntry(RoleEntry &&other) noexcept
+         : owner(other.owner)
+         , roleId(other.roleId)
+         , ownedRole(std::move(other.ownedRole))
+         , link(contomap::infrastructure::LinkCallback::to<&RoleEntry::unlinked>(*this))
       {
+         link.takeOver(other.link);
       }
 
-      contomap::model::Role &role()
+      RoleEntry(RoleEntry const &) = delete;
+      ~RoleEntry() = default;
+      RoleEntry &operator=(RoleEntry const &) = delete;
+      RoleEntry &operator=(RoleEntry &&) = delete;
+
+      void linkWith(contomap::model::Role &role, contomap::infrastructure::Link<Topic> &topicLink)
+      {
+         contomap::infrastructure::Links::between(topicLink, owner, link, role);
+      }
+
+      [[nodiscard]] contomap::model::Role &role() const
       {
-         return link->getLinked();
+         return link.getLinked();
       }
 
-      void own(std::unique_ptr<contomap::model::Role> role)
+      void own(contomap::infrastructure::SlabPool<contomap::model::Role>::Pointer role)
       {
          ownedRole = std::move(role);
       }
 
    private:
-      std::unique_ptr<contomap::model::Role> ownedRole;
-      std::unique_ptr<contomap::infrastructure::Link<contomap::model::Role>> link;
+      void unlinked()
+      {
+         owner.removeRole(roleId);
+      }
+
+      Topic &owner;
+      contomap::model::Identifier roleId;
+      contomap::infrastructure::SlabPool<contomap::model::Role>::Pointer ownedRole;
+      // The link is declared last, so that it is detached before the owned role is destroyed.
+      contomap::infrastructure::Link<contomap::model::Role> link;
    };
 
    [[nodiscard]] std::optional<std::reference_wrapper<contomap::model::TopicName>> findNameByScope(contomap::model::Identifiers const &scope);
+   void indexName(contomap::model::TopicName const &name);
+   void unindexName(contomap::model::Identifier nameId);
+   [[nodiscard]] contomap::infrastructure::SlabPool<contomap::model::Occurrence> *occurrencePool() const;
+   [[nodiscard]] contomap::infrastructure::SlabPool<contomap::model::Role> *rolePool() const;
+   [[nodiscard]] contomap::model::CoordinateTable *occurrenceLocations() const;
+   [[nodiscard]] contomap::model::ScopeTable *scopeTable() const;
 
    contomap::model::Identifier id;
+   std::optional<std::reference_wrapper<contomap::model::TopicNameIndex>> nameIndex;
+   contomap::model::EntityPools *pools = nullptr;
 
-   std::map<contomap::model::Identifier, contomap::model::TopicName> names;
-   std::map<contomap::model::Identifier, std::unique_ptr<contomap::model::Occurrence>> occurrences;
-   std::map<contomap::model::Identifier, std::unique_ptr<RoleEntry>> roles;
+   // A typical topic has one name, one or two occurrences, and a few roles, which are then kept without further allocation.
+   contomap::infrastructure::InlineMap<contomap::model::Identifier, contomap::model::TopicName, 1> names;
+   contomap::infrastructure::InlineMap<contomap::model::Identifier, contomap::infrastructure::SlabPool<contomap::model::Occurrence>::Pointer, 2> occurrences;
+   contomap::infrastructure::InlineMap<contomap::model::Identifier, RoleEntry, 3> roles;
 
    std::optional<std::reference_wrapper<contomap::model::Reified>> reified;
 };
@@ -4,7 +4,9 @@
 #include "contomap/infrastructure/serial/Encoder.h"
 #include "contomap/model/Identifier.h"
 #include "contomap/model/Identifiers.h"
+#include "contomap/model/InternedScope.h"
 #include "contomap/model/OptionalIdentifier.h"
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/TopicNameValue.h"
 
 namespace contomap::model
@@ -23,7 +25,7 @@ public:
     * @param scope the scope within which this name is valid.
     * @param value the human readable name.
     */
-   TopicName(contomap::model::Identifier id, contomap::model::Identifiers scope, contomap::model::TopicNameValue value);
+   TopicName(contomap::model::Identifier id, contomap::model::InternedScope scope, contomap::model::TopicNameValue value);
 
    /**
     * Deserialize the topic name value.
@@ -31,9 +33,11 @@ public:
     * @param coder the decoder to use.
     * @param version the version to consider.
     * @param id the identifier of the instance.
+    * @param scopeTable the table to intern the scope in. May be nullptr to keep it detached.
     * @return the decoded instance
     */
-   [[nodiscard]] static TopicName from(contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id);
+   [[nodiscard]] static TopicName from(
+      contomap::infrastructure::serial::Decoder &coder, uint8_t version, contomap::model::Identifier id, contomap::model::ScopeTable *scopeTable);
 
    /**
     * Serialize the topic name.
@@ -57,7 +61,7 @@ public:
    /**
     * @return the current value of this name.
     */
-   [[nodiscard]] contomap::model::TopicNameValue getValue() const;
+   [[nodiscard]] contomap::model::TopicNameValue const &getValue() const;
 
    /**
     * Return true if this instance is in the given scope.
@@ -67,6 +71,14 @@ public:
     */
    [[nodiscard]] bool isIn(contomap::model::Identifiers const &thatScope) const;
 
+   /**
+    * Return true if this instance is in the view scope of given selection.
+    *
+    * @param selection the selection of scopes to look up.
+    * @return true if the name is in the selected view scope.
+    */
+   [[nodiscard]] bool isIn(contomap::model::ScopeTable::Selection const &selection) const;
+
    /**
     * Return true if the scope contains the given identifier.
     *
@@ -83,6 +95,11 @@ public:
     */
    [[nodiscard]] bool scopeEquals(contomap::model::Identifiers const &thatScope) const;
 
+   /**
+    * @return the hash value of the scope, which allows to skip comparing unequal scopes.
+    */
+   [[nodiscard]] size_t scopeHash() const;
+
    /**
     * Use this method to sort names according to scope.
     *
@@ -100,7 +117,7 @@ public:
 
 private:
    contomap::model::Identifier id;
-   contomap::model::Identifiers scope;
+   contomap::model::InternedScope scope;
 
    contomap::model::TopicNameValue value;
 };
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "contomap/model/Identifier.h"
+
+namespace contomap::model
+{
+
+/**
+ * TopicNameIndex provides a full-text search over the names of topics.
+ *
+ * Names are case-folded and split into trigrams, which are kept as posting lists.
+ * A search only verifies the names of the shortest posting list of the search value, instead of all names.
+ * The index is maintained incrementally by the topics as their names are changed.
+ */
+class TopicNameIndex
+{
+public:
+   /**
+    * Relevance describes how well a name matches a search value. Lower values are more relevant.
+    */
+   enum class Relevance
+   {
+      /** The name equals the search value. */
+      Exact,
+      /** The name starts with the search value. */
+      Prefix,
+      /** A word within the name starts with the search value. */
+      WordStart,
+      /** The search value is somewhere within the name. */
+      Substring,
+   };
+
+   /**
+    * Result is the ranked outcome of a search, which can be refined.
+    */
+   class Result
+   {
+   public:
+      /**
+       * @return the raw search value that produced this result.
+       */
+      [[nodiscard]] std::string const &getSearchValue() const;
+
+      /**
+       * @return the revision of the index this result was produced from.
+       */
+      [[nodiscard]] uint64_t getRevision() const;
+
+      /**
+       * @return the identifiers of all matching topics, ordered by relevance.
+       */
+      [[nodiscard]] std::vector<contomap::model::Identifier> const &getTopics() const;
+
+      /**
+       * @return the number of matching topics.
+       */
+      [[nodiscard]] size_t size() const;
+
+   private:
+      friend TopicNameIndex;
+
+      std::string searchValue;
+      std::string foldedSearchValue;
+      uint64_t revision = 0;
+      std::vector<contomap::model::Identifier> nameIds;
+      std::vector<contomap::model::Identifier> topicIds;
+   };
+
+   /**
+    * Case-fold given UTF-8 text. Besides ASCII, this covers the Latin-1, Greek, and basic Cyrillic capital letters.
+    *
+    * @param text the text to fold.
+    * @return the folded text, still encoded as UTF-8.
+    */
+   [[nodiscard]] static std::string fold(std::string_view text);
+
+   /**
+    * Determines whether given text contains a search value, with the text case-folded as by fold().
+    * The text is folded while it is searched, without allocating memory.
+    *
+    * @param text the UTF-8 text to search in.
+    * @param foldedSearchValue the value to search for, already folded.
+    * @return true in case the folded text contains the search value.
+    */
+   [[nodiscard]] static bool foldedContains(std::string_view text, std::string_view foldedSearchValue);
+
+   /**
+    * Registers a topic, which starts without any name.
+    *
+    * @param topicId the identifier of the topic.
+    */
+   void addTopic(contomap::model::Identifier topicId);
+
+   /**
+    * Removes a topic and all of its names.
+    *
+    * @param topicId the identifier of the topic.
+    */
+   void removeTopic(contomap::model::Identifier topicId);
+
+   /**
+    * Adds or replaces a name of a topic.
+    *
+    * @param topicId the identifier of the topic the name belongs to.
+    * @param nameId the identifier of the name.
+    * @param value the raw value of the name.
+    */
+   void setName(contomap::model::Identifier topicId, contomap::model::Identifier nameId, std::string_view value);
+
+   /**
+    * Removes a name.
+    *
+    * @param nameId the identifier of the name to remove.
+    */
+   void removeName(contomap::model::Identifier nameId);
+
+   /**
+    * Removes all topics and names.
+    */
+   void clear();
+
+   /**
+    * Defers the maintenance of the posting lists, for setting many names at once.
+    * The deferred names are collected and added in order, which avoids most of the cost of random insertions.
+    * Searches do not find the deferred names until flushPostings() is called.
+    */
+   void deferPostings();
+
+   /**
+    * Adds the deferred names to the posting lists, and ends the deferral.
+    */
+   void flushPostings();
+
+   /**
+    * @return a counter that changes with every modification of the index.
+    */
+   [[nodiscard]] uint64_t getRevision() const;
+
+   /**
+    * Searches for all topics with a name that contains the search value, regardless of case.
+    * An empty search value matches all topics without a name.
+    *
+    * @param searchValue the raw text to search for.
+    * @return the ranked result.
+    */
+   [[nodiscard]] Result find(std::string const &searchValue) const;
+
+   /**
+    * Searches like find(), yet reuses a previous result if the new search value only narrows it down
+    * and the index has not changed since.
+    *
+    * @param searchValue the raw text to search for.
+    * @param previous a previous result of this index.
+    * @return the ranked result.
+    */
+   [[nodiscard]] Result find(std::string const &searchValue, Result const &previous) const;
+
+private:
+   using Trigram = uint32_t;
+
+   struct NameEntry
+   {
+      contomap::model::Identifier topicId;
+      std::string folded;
+   };
+
+   [[nodiscard]] static size_t foldUnitAt(std::string_view text, size_t index, std::array<char, 2> &folded);
+   [[nodiscard]] static std::vector<Trigram> trigramsOf(std::string_view folded);
+   [[nodiscard]] static Relevance relevanceOf(std::string_view folded, std::string_view foldedSearchValue);
+
+   [[nodiscard]] Result findUnnamed(std::string const &searchValue) const;
+   [[nodiscard]] Result rank(std::string const &searchValue, std::string foldedSearchValue, std::vector<contomap::model::Identifier> const &candidates) const;
+   [[nodiscard]] std::set<contomap::model::Identifier> const *shortestPostingsFor(std::string_view foldedSearchValue) const;
+   void unlinkName(std::map<contomap::model::Identifier, NameEntry>::iterator it);
+   void applyPendingPostings();
+
+   static size_t const PENDING_POSTINGS_LIMIT;
+
+   std::map<contomap::model::Identifier, NameEntry> names;
+   std::map<contomap::model::Identifier, std::set<contomap::model::Identifier>> namesByTopic;
+   std::map<Trigram, std::set<contomap::model::Identifier>> postings;
+   bool deferringPostings = false;
+   std::vector<std::pair<Trigram, contomap::model::Identifier>> pendingPostings;
+   uint64_t revision = 0;
+};
+
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <variant>
 
+#include "contomap/infrastructure/InternedString.h"
 #include "contomap/infrastructure/serial/Decoder.h"
 #include "contomap/infrastructure/serial/Encoder.h"
 
@@ -11,6 +12,7 @@ namespace contomap::model
 
 /**
  * TopicName is the primary, human readable identifier of a topic.
+ * Values are interned, as the same names tend to be repeated throughout a map.
  */
 class TopicNameValue
 {
@@ -58,12 +60,17 @@ public:
    /**
     * @return the raw text from this value.
     */
-   [[nodiscard]] std::string raw() const;
+   [[nodiscard]] std::string const &raw() const;
+
+   /**
+    * @return the shared handle of the text.
+    */
+   [[nodiscard]] contomap::infrastructure::InternedString const &interned() const;
 
 private:
-   explicit TopicNameValue(std::string value);
+   explicit TopicNameValue(contomap::infrastructure::InternedString value);
 
-   std::string value;
+   contomap::infrastructure::InternedString value;
 };
 
 }
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <memory>
+#include <string>
 
-#include "contomap/model/Filter.h"
+#include "contomap/model/Filters.h"
 #include "contomap/model/Topic.h"
 
 namespace contomap::model
@@ -19,28 +19,28 @@ public:
    Topics() = delete;
 
    /**
-    * Factory function for creating a Filter for topics.
+    * Factory function for creating a filter expression for topics.
     *
     * @param scope the view scope to filter for.
-    * @return a Filter instance that matches all topics with a least one occurrence in given scope.
+    * @return an expression that matches all topics with a least one occurrence in given scope.
     */
-   static std::unique_ptr<contomap::model::Filter<contomap::model::Topic>> thatAreIn(contomap::model::Identifiers const &scope);
+   [[nodiscard]] static contomap::model::filters::InScope<contomap::model::Topic> thatAreIn(contomap::model::Identifiers const &scope);
 
    /**
-    * Factory function for creating a Filter for topics.
+    * Factory function for creating a filter expression for topics.
     *
     * @param occurrences the identifiers of occurrences that the topics should have.
-    * @return a Filter instance that matches all topics with a least one occurrence in given list.
+    * @return an expression that matches all topics with a least one occurrence in given list.
     */
-   static std::unique_ptr<contomap::model::Filter<contomap::model::Topic>> thatOccurAs(contomap::model::Identifiers const &occurrences);
+   [[nodiscard]] static contomap::model::filters::OccursAs thatOccurAs(contomap::model::Identifiers const &occurrences);
 
    /**
-    * Factory function for creating a Filter for topics.
+    * Factory function for creating a filter expression for topics.
     *
     * @param searchValue the content to look for.
-    * @return a Filter instance that matches all topics with a name that matches the given value.
+    * @return an expression that matches all topics with a name that matches the given value.
     */
-   static std::unique_ptr<contomap::model::Filter<contomap::model::Topic>> withANameLike(std::string const &searchValue);
+   [[nodiscard]] static contomap::model::filters::NameLike withANameLike(std::string const &searchValue);
 };
 
 }
@@ -1,6 +1,9 @@
 #include <gmock/gmock.h>
 
+#include <memory>
+
 #include "contomap/model/Association.h"
+#include "contomap/model/Topic.h"
 
 #include "contomap/test/matchers/Coordinates.h"
 #include "contomap/test/printers/model.h"
@@ -10,7 +13,9 @@
 using contomap::model::Association;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
+using contomap::model::InternedScope;
 using contomap::model::SpacialCoordinate;
+using contomap::model::Topic;
 
 using contomap::test::matchers::isCloseTo;
 using contomap::test::samples::someNonEmptyScope;
@@ -21,9 +26,28 @@ TEST(AssociationTest, baseProperties)
    auto id = Identifier::random();
    Identifiers scope = someNonEmptyScope();
    auto position = someSpacialCoordinate();
-   Association a(id, scope, position);
+   Association a(id, InternedScope::detached(scope), position, nullptr);
    EXPECT_EQ(id, a.getId());
    EXPECT_TRUE(a.isIn(scope));
    EXPECT_FALSE(a.isIn({}));
    EXPECT_THAT(a.getLocation().getSpacial(), isCloseTo(position));
 }
+
+TEST(AssociationTest, rolesAreUnlinkedFromBothSides)
+{
+   Topic topic(Identifier::random());
+   auto association = std::make_unique<Association>(Identifier::random(), InternedScope::detached(someNonEmptyScope()), someSpacialCoordinate(), nullptr);
+   auto associationId = association->getId();
+   auto roleId = topic.newRole(*association).getId();
+   EXPECT_TRUE(association->hasRoles());
+
+   topic.removeRole(roleId);
+   EXPECT_FALSE(association->hasRoles()) << "association should lose the role removed from the topic";
+
+   static_cast<void>(topic.newRole(*association));
+   static_cast<void>(topic.newRole(*association));
+
+   association.reset();
+   EXPECT_EQ(0, std::ranges::distance(std::ranges::common_view(topic.rolesAssociatedWith(Identifiers::ofSingle(associationId)))))
+      << "topic should lose the roles of the destroyed association";
+}
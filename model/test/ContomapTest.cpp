@@ -1,19 +1,28 @@
 #include <gmock/gmock.h>
 
+#include "contomap/infrastructure/CoroutineFramePool.h"
+#include "contomap/infrastructure/MemoryAccount.h"
+#include "contomap/model/Associations.h"
 #include "contomap/model/Contomap.h"
 #include "contomap/model/Filter.h"
+#include "contomap/model/Topics.h"
 
 #include "contomap/test/fixtures/ContomapViewFixture.h"
 #include "contomap/test/samples/CoordinateSamples.h"
 
+using contomap::infrastructure::CoroutineFramePool;
+using contomap::infrastructure::MemoryAccount;
 using contomap::model::Association;
+using contomap::model::Associations;
 using contomap::model::Contomap;
+using contomap::model::EntityPools;
 using contomap::model::ContomapView;
 using contomap::model::Filter;
 using contomap::model::Identifier;
 using contomap::model::Identifiers;
 using contomap::model::Role;
 using contomap::model::Topic;
+using contomap::model::Topics;
 
 using contomap::test::fixtures::ContomapViewFixture;
 using contomap::test::samples::someSpacialCoordinate;
@@ -186,3 +195,56 @@ TEST_F(ContomapTest, rolesCanBeRemoved)
 
    EXPECT_TRUE(association.hasRoles()) << "Association should still have roles";
 }
+
+TEST_F(ContomapTest, repeatedTraversalsAllocateNoCoroutineFrames)
+{
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   auto &association = map.newAssociation(scope, someSpacialCoordinate());
+   for (int i = 0; i < 10; i++)
+   {
+      auto &topic = map.newTopic();
+      static_cast<void>(topic.newOccurrence(scope, someSpacialCoordinate()));
+      static_cast<void>(topic.newRole(association));
+   }
+   auto traverse = [this, &scope, &association]() {
+      size_t count = 0;
+      ContomapView const &view = map;
+      for (Association const &visible : view.find(Associations::thatAreIn(scope)))
+      {
+         count += visible.hasRoles() ? 1 : 0;
+      }
+      for (Topic const &topic : view.find(Topics::thatAreIn(scope)))
+      {
+         count += std::ranges::distance(std::ranges::common_view(topic.occurrencesIn(scope)));
+         count += std::ranges::distance(std::ranges::common_view(topic.allNames()));
+         count += std::ranges::distance(std::ranges::common_view(topic.rolesAssociatedWith(Identifiers::ofSingle(association.getId()))));
+      }
+      return count;
+   };
+
+   auto warmUp = traverse();
+   auto before = CoroutineFramePool::statistics();
+   auto steady = traverse();
+   auto after = CoroutineFramePool::statistics();
+
+   EXPECT_EQ(warmUp, steady);
+   EXPECT_EQ(before.heapAllocationCount, after.heapAllocationCount) << "Frames should be taken from the pool";
+   EXPECT_LT(before.recycledCount, after.recycledCount);
+}
+
+TEST(ContomapMemoryTest, modelMemoryStaysWithinBudgetAndIsReleased)
+{
+   auto &account = MemoryAccount::of<EntityPools::MemoryTag>();
+   auto before = account.snapshot();
+   {
+      auto map = Contomap::newMap();
+      for (size_t i = 0; i < 1000; i++)
+      {
+         auto &topic = map.newTopic();
+         static_cast<void>(topic.newOccurrence(Identifiers::ofSingle(map.getDefaultScope()), someSpacialCoordinate()));
+      }
+      auto held = account.snapshot().liveBytes - before.liveBytes;
+      EXPECT_LE(held / 1000, 2048) << "a topic with an occurrence should take at most 2 KiB of pooled memory";
+   }
+   EXPECT_EQ(before.liveBytes, account.snapshot().liveBytes);
+}
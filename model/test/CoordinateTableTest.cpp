@@ -0,0 +1,137 @@
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include "contomap/model/Contomap.h"
+#include "contomap/model/CoordinateTable.h"
+#include "contomap/model/Coordinates.h"
+
+#include "contomap/test/matchers/Coordinates.h"
+#include "contomap/test/samples/CoordinateSamples.h"
+
+using contomap::model::Contomap;
+using contomap::model::Coordinates;
+using contomap::model::CoordinateTable;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::ScopeTable;
+using contomap::model::SpacialCoordinate;
+
+using contomap::test::matchers::isCloseTo;
+using contomap::test::samples::someSpacialCoordinate;
+
+class CoordinateTableTest : public testing::Test
+{
+public:
+   Coordinates &placedAt(float x, float y, Identifiers const &scope = {})
+   {
+      auto &coordinates = placed.emplace_back(std::make_unique<Coordinates>(SpacialCoordinate::absoluteAt(x, y)));
+      coordinates->placeIn(&table, Identifier::random(), scopes.intern(scope));
+      return *coordinates;
+   }
+
+protected:
+   ScopeTable scopes;
+   CoordinateTable table;
+   std::vector<std::unique_ptr<Coordinates>> placed;
+};
+
+TEST_F(CoordinateTableTest, boundsCoverAllPoints)
+{
+   EXPECT_FALSE(table.bounds().has_value());
+
+   // Seven points cover both the full lanes and the remainder of the kernels.
+   static_cast<void>(placedAt(1.0f, 2.0f));
+   static_cast<void>(placedAt(-5.0f, 3.0f));
+   static_cast<void>(placedAt(4.0f, -1.0f));
+   static_cast<void>(placedAt(0.0f, 0.0f));
+   static_cast<void>(placedAt(2.0f, 8.0f));
+   static_cast<void>(placedAt(3.0f, 1.0f));
+   static_cast<void>(placedAt(9.0f, -7.0f));
+   auto bounds = table.bounds();
+   ASSERT_TRUE(bounds.has_value());
+   EXPECT_FLOAT_EQ(-5.0f, bounds->minX);
+   EXPECT_FLOAT_EQ(-7.0f, bounds->minY);
+   EXPECT_FLOAT_EQ(9.0f, bounds->maxX);
+   EXPECT_FLOAT_EQ(8.0f, bounds->maxY);
+}
+
+TEST_F(CoordinateTableTest, removedRowsAreReplacedByTheLastOne)
+{
+   auto &first = placedAt(1.0f, 1.0f);
+   static_cast<void>(placedAt(2.0f, 2.0f));
+   auto &last = placedAt(3.0f, 3.0f);
+   placed.erase(placed.begin() + 1);
+   ASSERT_EQ(2, table.size());
+
+   last.moveBy(SpacialCoordinate::Offset::of(10.0f, 0.0f));
+   EXPECT_THAT(first.getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(1.0f, 1.0f)));
+   EXPECT_THAT(last.getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(13.0f, 3.0f)));
+   EXPECT_FLOAT_EQ(13.0f, table.bounds()->maxX);
+}
+
+TEST_F(CoordinateTableTest, rowsCanBeCulledByArea)
+{
+   for (int i = 0; i < 9; i++)
+   {
+      static_cast<void>(placedAt(static_cast<float>(i), static_cast<float>(i % 3)));
+   }
+   std::vector<size_t> rows;
+   table.collectWithin(CoordinateTable::Bounds { .minX = 2.0f, .minY = 0.0f, .maxX = 7.0f, .maxY = 1.0f }, rows);
+   EXPECT_THAT(rows, testing::ElementsAre(3, 4, 6, 7));
+}
+
+TEST_F(CoordinateTableTest, rowsCanBeFilteredByScope)
+{
+   auto scopeA = Identifiers::ofSingle(Identifier::random());
+   auto scopeB = Identifiers::ofSingle(Identifier::random());
+   static_cast<void>(placedAt(0.0f, 0.0f, scopeA));
+   static_cast<void>(placedAt(0.0f, 0.0f, scopeB));
+   static_cast<void>(placedAt(0.0f, 0.0f, {}));
+   auto &moving = placedAt(0.0f, 0.0f, scopeB);
+
+   std::vector<size_t> rows;
+   table.collectIn(*scopes.selectWithin(scopeA), rows);
+   EXPECT_THAT(rows, testing::ElementsAre(0, 2));
+
+   moving.setScope(scopes.intern(scopeA));
+   rows.clear();
+   table.collectIn(*scopes.selectWithin(scopeA), rows);
+   EXPECT_THAT(rows, testing::ElementsAre(0, 2, 3));
+}
+
+TEST_F(CoordinateTableTest, translatingAllMovesEveryPoint)
+{
+   auto &a = placedAt(1.0f, 2.0f);
+   for (int i = 0; i < 4; i++)
+   {
+      static_cast<void>(placedAt(0.0f, 0.0f));
+   }
+   auto &b = placedAt(-3.0f, 4.0f);
+   table.translateAll(SpacialCoordinate::Offset::of(10.0f, -1.0f));
+   EXPECT_THAT(a.getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(11.0f, 1.0f)));
+   EXPECT_THAT(b.getSpacial(), isCloseTo(SpacialCoordinate::absoluteAt(7.0f, 3.0f)));
+}
+
+TEST(CoordinateTableMapTest, locationsOfMapElementsAreKeptInTables)
+{
+   auto map = Contomap::newMap();
+   auto &scopeTopic = map.newTopic();
+   auto scopeOccurrenceId = scopeTopic.newOccurrence(Identifiers::ofSingle(map.getDefaultScope()), someSpacialCoordinate()).getId();
+   auto position = SpacialCoordinate::absoluteAt(5.0f, 6.0f);
+   auto &association = map.newAssociation(Identifiers::ofSingle(scopeTopic.getId()), position);
+   auto const &locations = map.getAssociationLocations();
+   ASSERT_EQ(1, locations.size());
+   EXPECT_EQ(association.getId(), locations.idAt(0));
+   EXPECT_THAT(association.getLocation().getSpacial(), isCloseTo(position));
+   EXPECT_EQ(1, map.getOccurrenceLocations().size());
+
+   std::vector<size_t> rows;
+   locations.collectIn(*map.getScopes().selectWithin(Identifiers::ofSingle(map.getDefaultScope())), rows);
+   EXPECT_TRUE(rows.empty());
+
+   map.deleteOccurrences(Identifiers::ofSingle(scopeOccurrenceId));
+   EXPECT_EQ(0, map.getOccurrenceLocations().size());
+   EXPECT_EQ(0, locations.size()) << "association should have been deleted with the topic of its scope";
+}
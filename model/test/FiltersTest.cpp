@@ -0,0 +1,173 @@
+#include <atomic>
+#include <thread>
+
+#include <gmock/gmock.h>
+
+#include "contomap/model/Associations.h"
+#include "contomap/model/Contomap.h"
+#include "contomap/model/Topics.h"
+
+#include "contomap/test/samples/CoordinateSamples.h"
+
+using contomap::model::Association;
+using contomap::model::Associations;
+using contomap::model::Contomap;
+using contomap::model::ContomapView;
+using contomap::model::Filter;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::Topic;
+using contomap::model::TopicNameValue;
+using contomap::model::Topics;
+
+using contomap::test::samples::someSpacialCoordinate;
+
+class FiltersTest : public testing::Test
+{
+public:
+   FiltersTest()
+      : map(Contomap::newMap())
+      , otherScope(map.newTopic().getId())
+   {
+   }
+
+   Identifier topicNamed(std::string const &name, Identifiers const &scope)
+   {
+      auto &topic = map.newTopic();
+      static_cast<void>(topic.newOccurrence(scope, someSpacialCoordinate()));
+      if (!name.empty())
+      {
+         static_cast<void>(topic.newName(Identifiers::ofSingle(map.getDefaultScope()), std::get<TopicNameValue>(TopicNameValue::from(name))));
+      }
+      return topic.getId();
+   }
+
+   template <class Expression> std::vector<Identifier> idsOf(Expression expression)
+   {
+      std::vector<Identifier> ids;
+      for (Topic const &topic : map.find(std::move(expression)))
+      {
+         ids.emplace_back(topic.getId());
+      }
+      std::sort(ids.begin(), ids.end());
+      return ids;
+   }
+
+   static std::vector<Identifier> sorted(std::vector<Identifier> ids)
+   {
+      std::sort(ids.begin(), ids.end());
+      return ids;
+   }
+
+protected:
+   Contomap map;
+   Identifier otherScope;
+};
+
+TEST_F(FiltersTest, expressionsCanBeCombined)
+{
+   auto defaultScope = Identifiers::ofSingle(map.getDefaultScope());
+   auto apple = topicNamed("Apple", defaultScope);
+   auto pineapple = topicNamed("Pineapple", Identifiers::ofSingle(otherScope));
+   auto banana = topicNamed("Banana", defaultScope);
+
+   EXPECT_THAT(idsOf(Topics::thatAreIn(defaultScope) && Topics::withANameLike("apple")), testing::ElementsAre(apple));
+   EXPECT_THAT(idsOf(Topics::withANameLike("apple") || Topics::withANameLike("nan")), testing::ElementsAreArray(sorted({ apple, pineapple, banana })));
+   EXPECT_THAT(idsOf(Topics::withANameLike("a") && !Topics::thatAreIn(defaultScope)), testing::ElementsAre(pineapple));
+}
+
+TEST_F(FiltersTest, nameSearchIsExposedOnlyWhereItRestrictsTheResult)
+{
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   EXPECT_EQ("abc", (Topics::thatAreIn(scope) && Topics::withANameLike("abc")).nameSearch());
+   EXPECT_EQ("abc", (Topics::withANameLike("abc") && Topics::thatAreIn(scope)).nameSearch());
+   EXPECT_FALSE((Topics::thatAreIn(scope) || Topics::withANameLike("abc")).nameSearch().has_value());
+   EXPECT_FALSE((!Topics::withANameLike("abc")).nameSearch().has_value());
+   EXPECT_FALSE(Topics::thatOccurAs(scope).nameSearch().has_value());
+}
+
+TEST_F(FiltersTest, nameSearchThroughIndexMatchesFullScan)
+{
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   static_cast<void>(topicNamed("Alpha", scope));
+   static_cast<void>(topicNamed("alphabet", scope));
+   static_cast<void>(topicNamed("ALPHA CENTAURI", scope));
+   static_cast<void>(topicNamed("Beta", scope));
+   static_cast<void>(topicNamed("", scope));
+   static_cast<void>(topicNamed("Ärger", scope));
+   static_cast<void>(topicNamed("Σοφία", scope));
+
+   for (std::string search : { "alpha", "PHA", "ta", "a", "", "gamma", "ärg", "ÄRG", "ΣΟΦ" })
+   {
+      auto scanFilter
+         = Filter<Topic>::of([&search](Topic const &topic, ContomapView const &view) { return Topics::withANameLike(search).matches(topic, view); });
+      std::vector<Identifier> scanned;
+      for (Topic const &topic : map.find(std::shared_ptr<Filter<Topic>>(std::move(scanFilter))))
+      {
+         scanned.emplace_back(topic.getId());
+      }
+      EXPECT_EQ(sorted(scanned), idsOf(Topics::withANameLike(search))) << "Search: " << search;
+   }
+}
+
+TEST_F(FiltersTest, viewQueriesYieldTopicsInScanOrder)
+{
+   auto scope = Identifiers::ofSingle(map.getDefaultScope());
+   auto shortName = topicNamed("ox", scope);
+   auto longName = topicNamed("box of oxen", scope);
+   ContomapView const &view = map;
+
+   std::vector<Identifier> found;
+   for (Topic const &topic : view.find(Topics::withANameLike("ox")))
+   {
+      found.emplace_back(topic.getId());
+   }
+   EXPECT_EQ(sorted({ shortName, longName }), found);
+}
+
+TEST_F(FiltersTest, expressionsCanServeAsFilter)
+{
+   auto defaultScope = Identifiers::ofSingle(map.getDefaultScope());
+   auto &association = map.newAssociation(defaultScope, someSpacialCoordinate());
+   static_cast<void>(map.newAssociation(Identifiers::ofSingle(otherScope), someSpacialCoordinate()));
+
+   auto filter = Filter<Association>::of(Associations::thatAreIn(defaultScope));
+   EXPECT_TRUE(filter->matches(association, map));
+
+   std::vector<Identifier> found;
+   ContomapView const &view = map;
+   for (Association const &visible : view.find(Associations::thatAreIn(defaultScope)))
+   {
+      found.emplace_back(visible.getId());
+   }
+   EXPECT_THAT(found, testing::ElementsAre(association.getId()));
+}
+
+TEST_F(FiltersTest, expressionsCanBeEvaluatedFromSeveralThreads)
+{
+   auto defaultScope = Identifiers::ofSingle(map.getDefaultScope());
+   std::vector<std::reference_wrapper<Topic const>> topics;
+   for (size_t i = 0; i < 100; i++)
+   {
+      auto id = topicNamed("", ((i % 2) == 0) ? defaultScope : Identifiers::ofSingle(otherScope));
+      topics.emplace_back(map.findTopic(id).value());
+   }
+   auto expression = Topics::thatAreIn(defaultScope);
+   std::atomic<size_t> matchCount = 0;
+
+   std::vector<std::thread> threads;
+   for (size_t i = 0; i < 4; i++)
+   {
+      threads.emplace_back([&expression, &topics, &matchCount, this]() {
+         for (Topic const &topic : topics)
+         {
+            matchCount += expression.matches(topic, map) ? 1 : 0;
+         }
+      });
+   }
+   for (auto &thread : threads)
+   {
+      thread.join();
+   }
+   EXPECT_EQ(4 * 50, matchCount.load());
+}
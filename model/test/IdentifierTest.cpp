@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <random>
 #include <regex>
 #include <sstream>
 
@@ -22,6 +24,39 @@ TEST(IdentifierTest, randomIdentifierAreUnique)
    EXPECT_EQ(attempts, created.size());
 }
 
+TEST(IdentifierTest, bulkAllocatedIdentifiersAreUniqueAndAscending)
+{
+   std::vector<Identifier> created;
+   {
+      Identifier::BulkAllocation bulkAllocation;
+      for (size_t i = 0; i < 1000; i++)
+      {
+         created.emplace_back(Identifier::random());
+      }
+   }
+   EXPECT_TRUE(std::is_sorted(created.begin(), created.end()));
+   EXPECT_EQ(created.end(), std::adjacent_find(created.begin(), created.end()));
+}
+
+TEST(IdentifierTest, seededGeneratorRepeatsItsSequence)
+{
+   auto createSome = []() {
+      std::vector<Identifier> created;
+      for (size_t i = 0; i < 10; i++)
+      {
+         created.emplace_back(Identifier::random());
+      }
+      return created;
+   };
+   Identifier::seedRandom(1234);
+   auto first = createSome();
+   Identifier::seedRandom(1234);
+   auto second = createSome();
+   Identifier::seedRandom(std::random_device {}());
+
+   EXPECT_EQ(first, second);
+}
+
 TEST(IdentifierTest, shiftToOutputStream)
 {
    std::regex pattern("^[a-zA-Z0-9]{12}$");
@@ -0,0 +1,159 @@
+#include <sstream>
+#include <stdexcept>
+
+#include <gmock/gmock.h>
+
+#include "contomap/model/Associations.h"
+#include "contomap/model/Contomap.h"
+#include "contomap/model/MapImporter.h"
+#include "contomap/model/Topics.h"
+
+#include "contomap/test/fixtures/ContomapViewFixture.h"
+
+using contomap::model::Association;
+using contomap::model::Associations;
+using contomap::model::Contomap;
+using contomap::model::Identifiers;
+using contomap::model::MapImporter;
+using contomap::model::Occurrence;
+using contomap::model::Role;
+using contomap::model::Topic;
+using contomap::model::Topics;
+
+using contomap::test::fixtures::ContomapViewFixture;
+
+class MapImporterTest : public testing::Test
+{
+public:
+   MapImporterTest()
+      : map(Contomap::newMap())
+      , importer(map)
+      , viewFixture(map)
+   {
+   }
+
+   void importFrom(std::string const &text, MapImporter::Format format)
+   {
+      std::istringstream input(text);
+      importer.read(input, format);
+      importer.finish();
+   }
+
+   ContomapViewFixture &view()
+   {
+      return viewFixture;
+   }
+
+   Topic const &topicNamed(std::string const &name)
+   {
+      std::vector<std::reference_wrapper<Topic const>> topics;
+      std::ranges::copy(std::as_const(map).find(Topics::withANameLike(name)), std::back_inserter(topics));
+      EXPECT_EQ(1, topics.size()) << "no single topic named " << name;
+      return topics.at(0);
+   }
+
+   void shouldFail(std::string const &text, MapImporter::Format format, std::string const &expectedMessage)
+   {
+      try
+      {
+         importFrom(text, format);
+         FAIL() << "import did not fail";
+      }
+      catch (std::runtime_error const &e)
+      {
+         EXPECT_THAT(e.what(), testing::HasSubstr(expectedMessage));
+      }
+   }
+
+protected:
+   Contomap map;
+   MapImporter importer;
+   ContomapViewFixture viewFixture;
+};
+
+TEST_F(MapImporterTest, csvCreatesTopicsAssociationsAndRoles)
+{
+   importFrom("kind,key,name,x,y,topic,association\n"
+              "topic,a,Alpha,10,20,,\n"
+              "topic,b,Beta,30,40,,\n"
+              "association,ab,,20,30,,\n"
+              "role,,,,,a,ab\n"
+              "role,,,,,b,ab\n",
+      MapImporter::Format::Csv);
+
+   auto const &statistics = importer.getStatistics();
+   EXPECT_EQ(5, statistics.rows);
+   EXPECT_EQ(2, statistics.topics);
+   EXPECT_EQ(2, statistics.occurrences);
+   EXPECT_EQ(1, statistics.associations);
+   EXPECT_EQ(2, statistics.roles);
+   view().shouldHaveTopicCountOf(3);
+   view().shouldHaveAssociationCountOf(1);
+
+   Topic const &alpha = topicNamed("Alpha");
+   auto occurrences = alpha.occurrencesIn(Identifiers::ofSingle(map.getDefaultScope()));
+   Occurrence const &occurrence = *occurrences.begin();
+   EXPECT_FLOAT_EQ(10.0f, occurrence.getLocation().getSpacial().getAbsoluteReference().X());
+   EXPECT_FLOAT_EQ(20.0f, occurrence.getLocation().getSpacial().getAbsoluteReference().Y());
+
+   Association const &association = *map.find(Associations::thatAreIn(Identifiers::ofSingle(map.getDefaultScope()))).begin();
+   auto roles = alpha.rolesAssociatedWith(Identifiers::ofSingle(association.getId()));
+   EXPECT_EQ(1, std::ranges::distance(roles.begin(), roles.end()));
+}
+
+TEST_F(MapImporterTest, jsonLinesCreateTheSameItems)
+{
+   importFrom("{\"kind\": \"topic\", \"key\": \"a\", \"name\": \"Caf\\u00e9 \\\"Alpha\\\"\", \"x\": 10, \"y\": -20.5}\n"
+              "\n"
+              "{\"kind\": \"occurrence\", \"topic\": \"a\", \"x\": 1e2, \"y\": 0}\n"
+              "{\"kind\": \"association\", \"key\": \"ab\", \"x\": \"20\", \"y\": \"30\"}\n"
+              "{\"kind\": \"role\", \"topic\": \"a\", \"association\": \"ab\", \"comment\": null}\n",
+      MapImporter::Format::JsonLines);
+
+   auto const &statistics = importer.getStatistics();
+   EXPECT_EQ(4, statistics.rows);
+   EXPECT_EQ(2, statistics.occurrences);
+   EXPECT_EQ(1, statistics.roles);
+   Topic const &topic = topicNamed("Caf\xC3\xA9 \"Alpha\"");
+   auto occurrences = topic.occurrencesIn(Identifiers::ofSingle(map.getDefaultScope()));
+   EXPECT_EQ(2, std::ranges::distance(occurrences.begin(), occurrences.end()));
+}
+
+TEST_F(MapImporterTest, quotedCsvFieldsMayContainSeparatorsAndLineBreaks)
+{
+   importFrom("x,y,kind,key,name\r\n"
+              "1,2,topic,a,\"Alpha, \"\"first\"\"\r\nof all\"\r\n",
+      MapImporter::Format::Csv);
+
+   static_cast<void>(topicNamed("Alpha, \"first\"\nof all"));
+}
+
+TEST_F(MapImporterTest, rolesMayReferToLaterItems)
+{
+   std::istringstream input("kind,key,x,y,topic,association\n"
+                            "role,,,,a,ab\n"
+                            "topic,a,0,0,,\n"
+                            "association,ab,0,0,,\n");
+   importer.read(input, MapImporter::Format::Csv);
+   EXPECT_EQ(0, importer.getStatistics().roles);
+
+   importer.finish();
+   EXPECT_EQ(1, importer.getStatistics().roles);
+}
+
+TEST_F(MapImporterTest, unknownReferencesAreReportedWithTheirLine)
+{
+   shouldFail("kind,key,x,y,topic,association\n"
+              "association,ab,0,0,,\n"
+              "role,,,,missing,ab\n",
+      MapImporter::Format::Csv, "line 3: unknown topic \"missing\"");
+}
+
+TEST_F(MapImporterTest, malformedRowsAreReportedWithTheirLine)
+{
+   shouldFail("kind,key,x,y\ntopic,a,ten,0\n", MapImporter::Format::Csv, "line 2: invalid number for \"x\"");
+   shouldFail("kind,key,x,y\ntopic,a,0,0\ntopic,a,0,0\n", MapImporter::Format::Csv, "line 3: duplicate topic \"a\"");
+   shouldFail("{\"kind\": \"shape\"}\n", MapImporter::Format::JsonLines, "line 1: unknown kind \"shape\"");
+   shouldFail("{\"kind\": [\"topic\"]}\n", MapImporter::Format::JsonLines, "line 1: nested values are not supported");
+   shouldFail("{\"kind\": \"topic\"\n", MapImporter::Format::JsonLines, "line 1: expected '}'");
+}
@@ -0,0 +1,108 @@
+#include <initializer_list>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "contomap/model/Identifiers.h"
+#include "contomap/model/ScopeTable.h"
+
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::InternedScope;
+using contomap::model::ScopeTable;
+
+static Identifiers scopeOf(std::initializer_list<Identifier> ids)
+{
+   Identifiers scope;
+   for (auto id : ids)
+   {
+      scope.add(id);
+   }
+   return scope;
+}
+
+TEST(ScopeTableTest, equalScopesShareTheirEntry)
+{
+   ScopeTable table;
+   auto a = Identifier::random();
+   auto b = Identifier::random();
+   auto first = table.intern(scopeOf({ a, b }));
+   auto second = table.intern(scopeOf({ b, a }));
+   auto other = table.intern(scopeOf({ a }));
+   EXPECT_EQ(first, second);
+   EXPECT_NE(first, other);
+   EXPECT_EQ(2, table.size());
+   EXPECT_EQ(scopeOf({ a, b }), first.identifiers());
+
+   EXPECT_TRUE(table.intern({}).empty());
+   EXPECT_EQ(InternedScope(), table.intern({}));
+   EXPECT_EQ(2, table.size()) << "empty scope should not be numbered";
+}
+
+TEST(ScopeTableTest, detachedScopesCompareByIdentifiers)
+{
+   ScopeTable table;
+   auto id = Identifier::random();
+   EXPECT_EQ(InternedScope::detached(scopeOf({ id })), table.intern(scopeOf({ id })));
+   EXPECT_NE(InternedScope::detached(scopeOf({ id })), InternedScope::detached(scopeOf({ Identifier::random() })));
+   EXPECT_EQ(InternedScope(), ScopeTable::intern(nullptr, {}));
+}
+
+TEST(ScopeTableTest, selectionsTellWhichScopesAreWithinTheViewScope)
+{
+   ScopeTable table;
+   auto a = Identifier::random();
+   auto b = Identifier::random();
+   auto onlyA = table.intern(scopeOf({ a }));
+   auto both = table.intern(scopeOf({ a, b }));
+
+   auto selection = table.selectWithin(scopeOf({ a }));
+   EXPECT_TRUE(selection->contains(onlyA));
+   EXPECT_FALSE(selection->contains(both));
+   EXPECT_TRUE(selection->contains(InternedScope())) << "empty scope is within every view scope";
+   EXPECT_TRUE(selection->contains(InternedScope::detached(scopeOf({ a }))));
+
+   auto later = table.intern(scopeOf({ b }));
+   EXPECT_FALSE(selection->contains(later)) << "scopes added after the selection should still be tested";
+   EXPECT_TRUE(table.selectWithin(scopeOf({ b }))->contains(later));
+}
+
+TEST(ScopeTableTest, selectionsAreReusedUntilTheTableGrows)
+{
+   ScopeTable table;
+   auto a = Identifier::random();
+   static_cast<void>(table.intern(scopeOf({ a })));
+   auto first = table.selectWithin(scopeOf({ a }));
+   static_cast<void>(table.selectWithin(scopeOf({ Identifier::random() })));
+   EXPECT_EQ(first, table.selectWithin(scopeOf({ a })));
+
+   static_cast<void>(table.intern(scopeOf({ Identifier::random() })));
+   EXPECT_NE(first, table.selectWithin(scopeOf({ a })));
+}
+
+TEST(ScopeTableTest, releasedScopesAreSweptAndTheirNumbersReused)
+{
+   ScopeTable table;
+   auto a = Identifier::random();
+   auto b = Identifier::random();
+   auto kept = table.intern(scopeOf({ a }));
+   auto selection = table.selectWithin(scopeOf({ a, b }));
+   {
+      auto released = table.intern(scopeOf({ b }));
+      selection = table.selectWithin(scopeOf({ a, b }));
+      EXPECT_TRUE(selection->contains(released));
+   }
+   EXPECT_EQ(1, table.size());
+
+   std::vector<InternedScope> later;
+   for (int i = 0; i < 200; i++)
+   {
+      later.emplace_back(table.intern(scopeOf({ Identifier::random() })));
+   }
+   EXPECT_EQ(201, table.size());
+   EXPECT_TRUE(selection->contains(kept));
+   for (auto const &scope : later)
+   {
+      EXPECT_FALSE(selection->contains(scope)) << "a scope that reuses a released number should not inherit its selection";
+   }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "contomap/infrastructure/serial/BinaryDecoder.h"
+#include "contomap/infrastructure/serial/BinaryEncoder.h"
+#include "contomap/model/Style.h"
+
+using contomap::infrastructure::serial::BinaryDecoder;
+using contomap::infrastructure::serial::BinaryEncoder;
+using contomap::model::Style;
+
+static Style::Color const RED { .red = 0xFF, .green = 0x00, .blue = 0x00, .alpha = 0xFF };
+static Style::Color const BLUE { .red = 0x00, .green = 0x00, .blue = 0xFF, .alpha = 0x80 };
+
+TEST(StyleTest, colorsCanBeSetAndCleared)
+{
+   Style style = Style().with(Style::ColorType::Fill, RED);
+   EXPECT_TRUE(style.has(Style::ColorType::Fill));
+   EXPECT_FALSE(style.has(Style::ColorType::Line));
+   EXPECT_EQ(RED, style.get(Style::ColorType::Fill));
+   EXPECT_EQ(BLUE, style.get(Style::ColorType::Line, BLUE));
+
+   Style cleared = style.without(Style::ColorType::Fill);
+   EXPECT_FALSE(cleared.has(Style::ColorType::Fill));
+   EXPECT_EQ(Style(), cleared) << "cleared style should equal an empty one";
+}
+
+TEST(StyleTest, equalityConsidersPresence)
+{
+   EXPECT_EQ(Style().with(Style::ColorType::Text, RED), Style().with(Style::ColorType::Text, RED));
+   EXPECT_NE(Style().with(Style::ColorType::Text, RED), Style().with(Style::ColorType::Line, RED));
+   EXPECT_NE(Style().with(Style::ColorType::Text, Style::DEFAULT_COLOR), Style()) << "explicit default color is still set";
+}
+
+TEST(StyleTest, defaultsFillOnlyMissingColors)
+{
+   Style local = Style().with(Style::ColorType::Fill, RED);
+   Style defaults = Style().with(Style::ColorType::Fill, BLUE).with(Style::ColorType::Line, BLUE);
+   Style result = local.withDefaultsFrom(defaults);
+   EXPECT_EQ(RED, result.get(Style::ColorType::Fill));
+   EXPECT_EQ(BLUE, result.get(Style::ColorType::Line));
+   EXPECT_FALSE(result.has(Style::ColorType::Text));
+}
+
+TEST(StyleTest, averageConsidersOnlySetColors)
+{
+   Style a = Style().with(Style::ColorType::Fill, Style::Color { .red = 0x10, .green = 0x20, .blue = 0x30, .alpha = 0x40 });
+   Style b = Style()
+                .with(Style::ColorType::Fill, Style::Color { .red = 0x30, .green = 0x40, .blue = 0x50, .alpha = 0x60 })
+                .with(Style::ColorType::Text, RED);
+   Style average = Style::averageOf({ a, b, Style() });
+   EXPECT_EQ((Style::Color { .red = 0x20, .green = 0x30, .blue = 0x40, .alpha = 0x50 }), average.get(Style::ColorType::Fill));
+   EXPECT_EQ(RED, average.get(Style::ColorType::Text));
+   EXPECT_FALSE(average.has(Style::ColorType::Line));
+}
+
+TEST(StyleTest, serialization)
+{
+   Style source = Style().with(Style::ColorType::Text, RED).with(Style::ColorType::Fill, BLUE);
+   BinaryEncoder encoder;
+   source.encode(encoder, "style");
+   auto &data = encoder.getData();
+   BinaryDecoder decoder(data.data(), data.data() + data.size());
+   Style clone;
+   clone.decode(decoder, "style", 0);
+   EXPECT_EQ(source, clone);
+}
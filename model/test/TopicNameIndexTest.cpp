@@ -0,0 +1,179 @@
+#include <gmock/gmock.h>
+
+#include "contomap/model/Contomap.h"
+#include "contomap/model/TopicNameIndex.h"
+
+#include "contomap/test/samples/CoordinateSamples.h"
+
+using contomap::model::Contomap;
+using contomap::model::Identifier;
+using contomap::model::Identifiers;
+using contomap::model::TopicNameIndex;
+using contomap::model::TopicNameValue;
+
+using contomap::test::samples::someSpacialCoordinate;
+
+static TopicNameValue nameOf(std::string const &value)
+{
+   return std::get<TopicNameValue>(TopicNameValue::from(value));
+}
+
+TEST(TopicNameIndexTest, foldIgnoresCase)
+{
+   EXPECT_EQ("hello world", TopicNameIndex::fold("Hello WORLD"));
+   EXPECT_EQ("äöü é", TopicNameIndex::fold("ÄÖÜ É"));
+   EXPECT_EQ("αβγ москва", TopicNameIndex::fold("ΑΒΓ МОСКВА"));
+   EXPECT_EQ("1 × 2", TopicNameIndex::fold("1 × 2"));
+}
+
+TEST(TopicNameIndexTest, foldedContainsSearchesRegardlessOfCase)
+{
+   EXPECT_TRUE(TopicNameIndex::foldedContains("Hello WORLD", "o wor"));
+   EXPECT_TRUE(TopicNameIndex::foldedContains("Großer ÄRGER", "ärger"));
+   EXPECT_TRUE(TopicNameIndex::foldedContains("ΣΟΦΊΑ", "σοφ"));
+   EXPECT_TRUE(TopicNameIndex::foldedContains("abc", ""));
+   EXPECT_TRUE(TopicNameIndex::foldedContains("", ""));
+   EXPECT_FALSE(TopicNameIndex::foldedContains("Hello", "hello world"));
+   EXPECT_FALSE(TopicNameIndex::foldedContains("ÄRGER", "arger"));
+   EXPECT_FALSE(TopicNameIndex::foldedContains("", "a"));
+}
+
+TEST(TopicNameIndexTest, findsSubstringsRegardlessOfCase)
+{
+   TopicNameIndex index;
+   auto topicA = Identifier::random();
+   auto topicB = Identifier::random();
+   index.addTopic(topicA);
+   index.addTopic(topicB);
+   index.setName(topicA, Identifier::random(), "Alphabet Soup");
+   index.setName(topicB, Identifier::random(), "Beta");
+
+   EXPECT_THAT(index.find("BET").getTopics(), testing::ElementsAre(topicB, topicA));
+   EXPECT_THAT(index.find("soup").getTopics(), testing::ElementsAre(topicA));
+   EXPECT_THAT(index.find("ta").getTopics(), testing::ElementsAre(topicB));
+   EXPECT_EQ(0, index.find("gamma").size());
+}
+
+TEST(TopicNameIndexTest, deferredNamesAreFoundAfterFlush)
+{
+   TopicNameIndex index;
+   auto topicA = Identifier::random();
+   auto topicB = Identifier::random();
+   auto nameA = Identifier::random();
+   index.addTopic(topicA);
+   index.addTopic(topicB);
+   index.setName(topicA, nameA, "Alphabet Soup");
+
+   index.deferPostings();
+   index.setName(topicB, Identifier::random(), "Beta");
+   EXPECT_EQ(0, index.find("beta").size());
+   index.setName(topicA, nameA, "Alpha");
+
+   index.flushPostings();
+   EXPECT_THAT(index.find("beta").getTopics(), testing::ElementsAre(topicB));
+   EXPECT_THAT(index.find("alp").getTopics(), testing::ElementsAre(topicA));
+   EXPECT_EQ(0, index.find("soup").size());
+}
+
+TEST(TopicNameIndexTest, resultsAreRankedByRelevance)
+{
+   TopicNameIndex index;
+   auto substring = Identifier::random();
+   auto wordStart = Identifier::random();
+   auto prefix = Identifier::random();
+   auto exact = Identifier::random();
+   index.setName(substring, Identifier::random(), "catapult");
+   index.setName(wordStart, Identifier::random(), "big apple");
+   index.setName(prefix, Identifier::random(), "apple pie");
+   index.setName(exact, Identifier::random(), "Apple");
+
+   EXPECT_THAT(index.find("apple").getTopics(), testing::ElementsAre(exact, prefix, wordStart));
+   EXPECT_THAT(index.find("ap").getTopics(), testing::ElementsAre(exact, prefix, wordStart, substring)) << "shorter prefix match must come first";
+}
+
+TEST(TopicNameIndexTest, topicsAreListedOnceForMultipleMatchingNames)
+{
+   TopicNameIndex index;
+   auto topic = Identifier::random();
+   index.setName(topic, Identifier::random(), "river");
+   index.setName(topic, Identifier::random(), "riverside");
+
+   EXPECT_EQ(1, index.find("river").size());
+}
+
+TEST(TopicNameIndexTest, changedNamesAreReindexed)
+{
+   TopicNameIndex index;
+   auto topic = Identifier::random();
+   auto nameId = Identifier::random();
+   index.setName(topic, nameId, "first");
+   index.setName(topic, nameId, "second");
+
+   EXPECT_EQ(0, index.find("first").size());
+   EXPECT_EQ(1, index.find("second").size());
+
+   index.removeName(nameId);
+   EXPECT_EQ(0, index.find("second").size());
+}
+
+TEST(TopicNameIndexTest, emptySearchFindsUnnamedTopics)
+{
+   TopicNameIndex index;
+   auto named = Identifier::random();
+   auto unnamed = Identifier::random();
+   index.addTopic(named);
+   index.addTopic(unnamed);
+   index.setName(named, Identifier::random(), "named");
+
+   EXPECT_THAT(index.find("").getTopics(), testing::ElementsAre(unnamed));
+   index.removeTopic(named);
+   EXPECT_EQ(0, index.find("named").size());
+}
+
+TEST(TopicNameIndexTest, refinementNarrowsPreviousResult)
+{
+   TopicNameIndex index;
+   auto topicA = Identifier::random();
+   auto topicB = Identifier::random();
+   index.setName(topicA, Identifier::random(), "mountain");
+   index.setName(topicB, Identifier::random(), "mount");
+
+   auto coarse = index.find("moun");
+   ASSERT_EQ(2, coarse.size());
+   auto refined = index.find("mounta", coarse);
+   EXPECT_THAT(refined.getTopics(), testing::ElementsAre(topicA));
+   auto widened = index.find("mo", refined);
+   EXPECT_EQ(2, widened.size()) << "a search that is not a refinement must not be limited by the previous result";
+}
+
+TEST(TopicNameIndexTest, refinementConsidersChangesOfIndex)
+{
+   TopicNameIndex index;
+   index.setName(Identifier::random(), Identifier::random(), "lake");
+   auto coarse = index.find("la");
+   index.setName(Identifier::random(), Identifier::random(), "lakeside");
+
+   EXPECT_EQ(2, index.find("lak", coarse).size());
+}
+
+TEST(TopicNameIndexTest, mapMaintainsIndexWithTopicChanges)
+{
+   auto map = Contomap::newMap();
+   auto &topic = map.newTopic();
+   auto topicId = topic.getId();
+   auto &occurrence = topic.newOccurrence(Identifiers::ofSingle(map.getDefaultScope()), someSpacialCoordinate());
+   auto occurrenceId = occurrence.getId();
+   topic.setNameInScope(Identifiers {}, nameOf("Harbor"));
+   auto const &index = map.getTopicNameIndex();
+
+   EXPECT_THAT(index.find("harb").getTopics(), testing::ElementsAre(topicId));
+   topic.setNameInScope(Identifiers {}, nameOf("Port"));
+   EXPECT_EQ(0, index.find("harb").size());
+   EXPECT_THAT(index.find("port").getTopics(), testing::ElementsAre(topicId));
+   topic.removeNameInScope(Identifiers {});
+   EXPECT_EQ(0, index.find("port").size());
+
+   topic.setNameInScope(Identifiers {}, nameOf("Dock"));
+   map.deleteOccurrences(Identifiers::ofSingle(occurrenceId));
+   EXPECT_EQ(0, index.find("dock").size());
+}
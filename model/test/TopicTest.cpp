@@ -1,5 +1,6 @@
 #include <gmock/gmock.h>
 
+#include "contomap/model/ScopeTable.h"
 #include "contomap/model/Topic.h"
 
 #include "contomap/test/matchers/Coordinates.h"
@@ -9,6 +10,8 @@
 #include "contomap/test/samples/TopicNameSamples.h"
 #include "contomap/test/samples/TopicSamples.h"
 
+using contomap::model::Occurrence;
+using contomap::model::ScopeTable;
 using contomap::model::Topic;
 
 using contomap::test::matchers::isCloseTo;
@@ -93,3 +96,19 @@ TEST_F(TopicTest, occurrenceBaseProperties)
    EXPECT_FALSE(occurrence.isIn({}));
    EXPECT_THAT(occurrence.getLocation().getSpacial(), isCloseTo(position));
 }
+
+TEST_F(TopicTest, occurrencesAreFoundWithinSelection)
+{
+   auto topic = someTopic();
+   auto scope = someNonEmptyScope();
+   auto &inScope = topic.newOccurrence(scope, someSpacialCoordinate());
+   static_cast<void>(topic.newOccurrence(someNonEmptyScope(), someSpacialCoordinate()));
+   ScopeTable scopes;
+   auto selection = scopes.selectWithin(scope);
+
+   auto selectedView = std::ranges::common_view(topic.occurrencesIn(*selection));
+   std::vector<std::reference_wrapper<Occurrence const>> selected(selectedView.begin(), selectedView.end());
+   ASSERT_EQ(1, selected.size());
+   EXPECT_EQ(inScope.getId(), selected[0].get().getId());
+   EXPECT_EQ(2, std::ranges::distance(std::ranges::common_view(topic.allOccurrences())));
+}